@@ -8,6 +8,7 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 // Plugins for <T>LAPACK (must come before <T>LAPACK headers)
+#include <tlapack/plugins/legacyArray.hpp>
 #include <tlapack/plugins/starpu.hpp>
 
 // <T>LAPACK
@@ -17,6 +18,7 @@
 #include <tlapack/lapack/getrf_recursive.hpp>
 #include <tlapack/lapack/lacpy.hpp>
 #include <tlapack/lapack/lange.hpp>
+#include <tlapack/starpu/getrf.hpp>
 
 // C++ headers
 #include <iostream>
@@ -34,16 +36,17 @@ int main(int argc, char** argv)
     idx_t n = 7;
     idx_t r = 14;
     idx_t s = 7;
-    char method = '0';  // 'r' for recursive, '0' for level0
+    char method = '0';  // 'r' for recursive, '0' for level0, 't' for tiled
 
     if (argc > 1) m = atoi(argv[1]);
     if (argc > 2) n = atoi(argv[2]);
     if (argc > 3) r = atoi(argv[3]);
     if (argc > 4) s = atoi(argv[4]);
     if (argc > 5) method = tolower(argv[5][0]);
-    if (argc > 6 || (method != 'r' && method != '0') || (m % r != 0) ||
-        (n % s != 0) || (r > m) || (s > n) || (r == 0) || (s == 0) ||
-        (r != m && method == 'r') || (s != n && method == 'r')) {
+    if (argc > 6 || (method != 'r' && method != '0' && method != 't') ||
+        (m % r != 0) || (n % s != 0) || (r > m) || (s > n) || (r == 0) ||
+        (s == 0) || (r != m && method == 'r') || (s != n && method == 'r') ||
+        (r != s && method == 't')) {
         std::cout << "Usage: " << argv[0] << " [m] [n] [r] [s] [method]"
                   << std::endl;
         std::cout << "  m:      number of rows of A (default: 14)" << std::endl;
@@ -55,10 +58,11 @@ int main(int argc, char** argv)
                   << "Currently, m must be divisible by r." << std::endl;
         std::cout << "  s:      number of tiles in y (columns) direction "
                      "(default: 7)."
-                  << "s=n if method is recursive."
+                  << "s=n if method is recursive. r=s if method is tiled."
                   << "Currently, n must be divisible by s." << std::endl;
 
-        std::cout << "  method: 'r' for recursive, '0' for level0 (default: 0)"
+        std::cout << "  method: 'r' for recursive, '0' for level0, 't' for "
+                     "tiled (default: 0)"
 
                   << std::endl;
         return 1;
@@ -67,7 +71,10 @@ int main(int argc, char** argv)
     // Print input parameters
     std::cout << "m = " << m << std::endl;
     std::cout << "n = " << n << std::endl;
-    std::cout << "method = " << (method == 'r' ? "recursive" : "level0")
+    std::cout << "method = "
+              << (method == 'r'   ? "recursive"
+                  : method == 't' ? "tiled"
+                                  : "level0")
               << std::endl
               << std::endl;
 
@@ -122,6 +129,8 @@ int main(int argc, char** argv)
         /* LU factorization */
         if (method == '0')
             getrf_level0(Acopy, p);
+        else if (method == 't')
+            getrf(Acopy, p);
         else
             getrf_recursive(Acopy, p);
         std::cout << "LU = " << Acopy << std::endl;
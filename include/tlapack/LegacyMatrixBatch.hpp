@@ -0,0 +1,133 @@
+/// @file LegacyMatrixBatch.hpp Batches of legacy matrices with the same sizes.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LEGACY_MATRIX_BATCH_HH
+#define TLAPACK_LEGACY_MATRIX_BATCH_HH
+
+#include "tlapack/LegacyMatrix.hpp"
+
+namespace tlapack {
+
+/** Strided batch of legacy matrices.
+ *
+ * Matrix b, 0 <= b < count, is the m-by-n legacy matrix with leading dimension
+ * ldim that starts at ptr + b * stride.
+ *
+ * @tparam T Floating-point type
+ * @tparam idx_t Index type
+ * @tparam L Either Layout::ColMajor or Layout::RowMajor
+ */
+template <class T,
+          class idx_t = std::size_t,
+          Layout L = Layout::ColMajor,
+          std::enable_if_t<(L == Layout::RowMajor) || (L == Layout::ColMajor),
+                           int> = 0>
+struct LegacyStridedBatch {
+    idx_t m, n;    ///< Sizes of each matrix
+    T* ptr;        ///< Pointer to the first matrix
+    idx_t ldim;    ///< Leading dimension of each matrix
+    idx_t stride;  ///< Distance between two consecutive matrices
+    idx_t count;   ///< Number of matrices
+
+    static constexpr Layout layout = L;
+    using matrix_type = LegacyMatrix<T, idx_t, L>;
+
+    constexpr idx_t size() const noexcept { return count; }
+
+    constexpr matrix_type operator[](idx_t b) const noexcept
+    {
+        assert(b >= 0);
+        assert(b < count);
+        return matrix_type(m, n, ptr + b * stride, ldim);
+    }
+
+    constexpr LegacyStridedBatch(
+        idx_t m, idx_t n, T* ptr, idx_t ldim, idx_t stride, idx_t count)
+        : m(m), n(n), ptr(ptr), ldim(ldim), stride(stride), count(count)
+    {
+        tlapack_check(m >= 0);
+        tlapack_check(n >= 0);
+        tlapack_check(count >= 0);
+        tlapack_check(ldim >= ((layout == Layout::ColMajor) ? m : n));
+        tlapack_check(stride >= ((layout == Layout::ColMajor) ? ldim * n
+                                                              : ldim * m));
+    }
+
+    /// Batch of contiguous matrices without padding
+    constexpr LegacyStridedBatch(idx_t m, idx_t n, T* ptr, idx_t count)
+        : m(m),
+          n(n),
+          ptr(ptr),
+          ldim((layout == Layout::ColMajor) ? m : n),
+          stride(m * n),
+          count(count)
+    {
+        tlapack_check(m >= 0);
+        tlapack_check(n >= 0);
+        tlapack_check(count >= 0);
+    }
+};
+
+/** Pointer-array batch of legacy matrices.
+ *
+ * Matrix b, 0 <= b < count, is the m-by-n legacy matrix with leading dimension
+ * ldim that starts at ptrs[b].
+ *
+ * @tparam T Floating-point type
+ * @tparam idx_t Index type
+ * @tparam L Either Layout::ColMajor or Layout::RowMajor
+ */
+template <class T,
+          class idx_t = std::size_t,
+          Layout L = Layout::ColMajor,
+          std::enable_if_t<(L == Layout::RowMajor) || (L == Layout::ColMajor),
+                           int> = 0>
+struct LegacyPointerBatch {
+    idx_t m, n;      ///< Sizes of each matrix
+    T* const* ptrs;  ///< Array with the first entry of each matrix
+    idx_t ldim;      ///< Leading dimension of each matrix
+    idx_t count;     ///< Number of matrices
+
+    static constexpr Layout layout = L;
+    using matrix_type = LegacyMatrix<T, idx_t, L>;
+
+    constexpr idx_t size() const noexcept { return count; }
+
+    constexpr matrix_type operator[](idx_t b) const noexcept
+    {
+        assert(b >= 0);
+        assert(b < count);
+        return matrix_type(m, n, ptrs[b], ldim);
+    }
+
+    constexpr LegacyPointerBatch(
+        idx_t m, idx_t n, T* const* ptrs, idx_t ldim, idx_t count)
+        : m(m), n(n), ptrs(ptrs), ldim(ldim), count(count)
+    {
+        tlapack_check(m >= 0);
+        tlapack_check(n >= 0);
+        tlapack_check(count >= 0);
+        tlapack_check(ldim >= ((layout == Layout::ColMajor) ? m : n));
+    }
+
+    constexpr LegacyPointerBatch(idx_t m, idx_t n, T* const* ptrs, idx_t count)
+        : m(m),
+          n(n),
+          ptrs(ptrs),
+          ldim((layout == Layout::ColMajor) ? m : n),
+          count(count)
+    {
+        tlapack_check(m >= 0);
+        tlapack_check(n >= 0);
+        tlapack_check(count >= 0);
+    }
+};
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LEGACY_MATRIX_BATCH_HH
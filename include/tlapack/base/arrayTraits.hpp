@@ -76,6 +76,23 @@ namespace traits {
         static constexpr Layout value = Layout::Unspecified;
     };
 
+    /**
+     * @brief Trait to determine the extents of a matrix known at compile time.
+     *
+     * The extents are defined on @c static_extents_trait<matrix_t,int>::nrows
+     * and @c static_extents_trait<matrix_t,int>::ncols. The value -1 means
+     * that the extent is only known at runtime. Use the tlapack::static_nrows
+     * and tlapack::static_ncols aliases instead.
+     *
+     * @tparam matrix_t Data structure.
+     * @tparam class If this is not an int, then the trait is not defined.
+     */
+    template <class matrix_t, class = int>
+    struct static_extents_trait {
+        static constexpr int nrows = -1;
+        static constexpr int ncols = -1;
+    };
+
     /**
      * @brief Functor for data creation
      *
@@ -231,6 +248,30 @@ using size_type = typename traits::size_type_trait<T, int>::type;
 template <class array_t>
 constexpr Layout layout = traits::layout_trait<array_t, int>::value;
 
+/// Number of rows of a matrix known at compile time, or -1.
+template <class matrix_t>
+constexpr int static_nrows = traits::static_extents_trait<matrix_t, int>::nrows;
+
+/// Number of columns of a matrix known at compile time, or -1.
+template <class matrix_t>
+constexpr int static_ncols = traits::static_extents_trait<matrix_t, int>::ncols;
+
+/// True if the number of rows and columns of all matrices are known at compile
+/// time.
+template <class... matrix_t>
+constexpr bool has_static_extents =
+    ((static_nrows<matrix_t> >= 0 && static_ncols<matrix_t> >= 0) && ...);
+
+/// True if the extents of all matrices are known at compile time and each
+/// matrix has between 1 and 32*32 entries, so that it can be copied to the
+/// stack.
+template <class... matrix_t>
+constexpr bool has_small_static_extents =
+    has_static_extents<matrix_t...> &&
+    ((static_nrows<matrix_t> * static_ncols<matrix_t> > 0 &&
+      static_nrows<matrix_t> * static_ncols<matrix_t> <= 1024) &&
+     ...);
+
 /**
  * @brief Alias for @c traits::CreateFunctor<,int>.
  *
@@ -0,0 +1,113 @@
+/// @file simd.hpp Runtime selection of the instruction set used by the
+/// vectorized kernels.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_SIMD_HH
+#define TLAPACK_SIMD_HH
+
+#include <ostream>
+
+// The vectorized kernels use GCC vector extensions and, on x86-64, function
+// target attributes. Both are supported by GCC and Clang.
+#if !defined(TLAPACK_DISABLE_SIMD) && defined(__GNUC__)
+    #if defined(__x86_64__)
+        #define TLAPACK_SIMD_X86
+    #elif defined(__aarch64__) && defined(__ARM_NEON)
+        #define TLAPACK_SIMD_NEON
+    #endif
+#endif
+
+#if defined(TLAPACK_SIMD_X86) || defined(TLAPACK_SIMD_NEON)
+    #define TLAPACK_SIMD
+#endif
+
+namespace tlapack {
+
+/// @brief Instruction sets for which <T>LAPACK has vectorized kernels.
+enum class SimdIsa : char {
+    Generic = 'G',  ///< Plain loops, for any scalar type.
+    SSE2 = 'S',     ///< 128-bit vectors, x86-64 baseline.
+    NEON = 'N',     ///< 128-bit vectors, AArch64 baseline.
+    AVX2 = '2',     ///< 256-bit vectors with FMA.
+    AVX512 = '5'    ///< 512-bit vectors (AVX-512F).
+};
+inline std::ostream& operator<<(std::ostream& out, const SimdIsa v)
+{
+    if (v == SimdIsa::Generic) return out << "Generic";
+    if (v == SimdIsa::SSE2) return out << "SSE2";
+    if (v == SimdIsa::NEON) return out << "NEON";
+    if (v == SimdIsa::AVX2) return out << "AVX2";
+    if (v == SimdIsa::AVX512) return out << "AVX512";
+    return out << "<Invalid>";
+}
+
+/**
+ * @brief Detects the widest instruction set supported by the running CPU.
+ *
+ * On x86-64, the detection uses the CPUID instruction through
+ * @c __builtin_cpu_supports. Returns SimdIsa::Generic if the vectorized
+ * kernels are disabled, either by the macro @c TLAPACK_DISABLE_SIMD or because
+ * the compiler does not support them.
+ */
+inline SimdIsa detect_simd_isa() noexcept
+{
+#if defined(TLAPACK_SIMD_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return SimdIsa::AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return SimdIsa::AVX2;
+    return SimdIsa::SSE2;
+#elif defined(TLAPACK_SIMD_NEON)
+    return SimdIsa::NEON;
+#else
+    return SimdIsa::Generic;
+#endif
+}
+
+/// @brief True if the running CPU can execute the kernels for isa.
+inline bool is_simd_isa_supported(SimdIsa isa) noexcept
+{
+    const SimdIsa detected = detect_simd_isa();
+    switch (isa) {
+        case SimdIsa::Generic:
+            return true;
+        case SimdIsa::SSE2:
+            return detected == SimdIsa::SSE2 || detected == SimdIsa::AVX2 ||
+                   detected == SimdIsa::AVX512;
+        case SimdIsa::NEON:
+            return detected == SimdIsa::NEON;
+        case SimdIsa::AVX2:
+            return detected == SimdIsa::AVX2 || detected == SimdIsa::AVX512;
+        case SimdIsa::AVX512:
+            return detected == SimdIsa::AVX512;
+    }
+    return false;
+}
+
+/**
+ * @brief Instruction set used by the vectorized kernels.
+ *
+ * It is initialized with detect_simd_isa() on the first call. The returned
+ * reference can be assigned to restrict the kernels to a narrower instruction
+ * set, e.g., SimdIsa::Generic to disable vectorization at runtime. It must
+ * never be set to an instruction set that is not supported by the CPU. The
+ * assignment is not thread-safe.
+ *
+ * @code{.cpp}
+ * tlapack::simd_isa() = tlapack::SimdIsa::AVX2; // Skip AVX-512 kernels
+ * @endcode
+ */
+inline SimdIsa& simd_isa() noexcept
+{
+    static SimdIsa isa = detect_simd_isa();
+    return isa;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_SIMD_HH
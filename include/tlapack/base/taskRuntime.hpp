@@ -0,0 +1,317 @@
+/// @file taskRuntime.hpp Lightweight task runtime with dependency tracking
+/// and work stealing.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TASK_RUNTIME_HH
+#define TLAPACK_TASK_RUNTIME_HH
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "tlapack/base/threads.hpp"
+
+namespace tlapack {
+
+/**
+ * @brief Pool of worker threads that runs a graph of tasks.
+ *
+ * Tasks are submitted in a sequential order, together with the data they
+ * access. The runtime infers the dependencies from the order of submission
+ * and from the access modes, like a sequential task flow:
+ *  - a task that reads some data waits for the last task that wrote it;
+ *  - a task that writes some data waits for the last task that wrote it and
+ *    for all tasks that read it since.
+ *
+ * Data is identified by an address, e.g., the address of the first entry of
+ * a tile. Tasks whose dependencies are satisfied are pushed to the deque of
+ * the worker that released them. Each worker pops tasks from the back of its
+ * own deque and, when it is empty, steals from the front of the deques of
+ * the other workers.
+ *
+ * The level-3 BLAS templates run serially inside the tasks, see
+ * tlapack::internal::blas3_serial_region.
+ *
+ * @note submit() and wait() must be called by a single thread, which must not
+ * be one of the workers of the runtime. Threads that share a runtime must
+ * hold caller_mutex() from their first submit() to their wait(), as the
+ * tiled routines do.
+ *
+ * @code{.cpp}
+ * tlapack::TaskRuntime rt(4);
+ * rt.submit([&] { f(A); }, {{&A, TaskRuntime::Access::Write}});
+ * rt.submit([&] { g(A, B); }, {{&A, TaskRuntime::Access::Read},
+ *                              {&B, TaskRuntime::Access::ReadWrite}});
+ * rt.wait();
+ * @endcode
+ */
+class TaskRuntime {
+   public:
+    /// Access mode of a task to some data
+    enum class Access : char { Read = 'R', Write = 'W', ReadWrite = 'X' };
+
+    /// Data accessed by a task
+    struct Dependency {
+        const void* data;  ///< Address that identifies the data
+        Access mode;       ///< Access mode
+    };
+
+    /**
+     * @brief Starts the worker threads.
+     *
+     * @param[in] nthreads Number of worker threads. If nthreads <= 0, use
+     *      std::thread::hardware_concurrency().
+     */
+    explicit TaskRuntime(int nthreads = 0)
+    {
+        if (nthreads <= 0) nthreads = (int)std::thread::hardware_concurrency();
+        if (nthreads <= 0) nthreads = 1;
+
+        for (int w = 0; w < nthreads; ++w)
+            workers.emplace_back(new Worker);
+        for (int w = 0; w < nthreads; ++w)
+            threads.emplace_back([this, w] { worker_loop(w); });
+    }
+
+    /// Waits for the submitted tasks and stops the worker threads.
+    ~TaskRuntime()
+    {
+        {
+            std::unique_lock<std::mutex> lk(done_mutex);
+            done_cv.wait(lk, [this] { return nunfinished == 0; });
+        }
+        {
+            std::lock_guard<std::mutex> lk(sleep_mutex);
+            stop = true;
+        }
+        sleep_cv.notify_all();
+        for (auto& t : threads)
+            t.join();
+    }
+
+    TaskRuntime(const TaskRuntime&) = delete;
+    TaskRuntime& operator=(const TaskRuntime&) = delete;
+
+    /// Number of worker threads
+    int num_threads() const noexcept { return (int)threads.size(); }
+
+    /// Mutex that serializes the threads that submit tasks to the runtime
+    std::mutex& caller_mutex() noexcept { return callers; }
+
+    /**
+     * @brief Submits a task.
+     *
+     * @param[in] f Callable object with signature void().
+     * @param[in] deps Data accessed by f.
+     */
+    template <class F>
+    void submit(F&& f, const std::vector<Dependency>& deps)
+    {
+        tasks.emplace_back(new Task(std::forward<F>(f)));
+        Task* t = tasks.back().get();
+        {
+            std::lock_guard<std::mutex> lk(done_mutex);
+            ++nunfinished;
+        }
+
+        for (const Dependency& d : deps) {
+            Handle& h = handles[d.data];
+            if (h.writer && h.writer != t) add_edge(h.writer, t);
+            if (d.mode == Access::Read) {
+                h.readers.push_back(t);
+            }
+            else {
+                for (Task* r : h.readers)
+                    if (r != t) add_edge(r, t);
+                h.readers.clear();
+                h.writer = t;
+            }
+        }
+
+        // Release the submission guard
+        if (--t->npred == 0) push(t, next_worker++ % workers.size());
+    }
+
+    /**
+     * @brief Waits for all submitted tasks to finish.
+     *
+     * If a task throws an exception, the first one is rethrown here after
+     * all tasks finished. The tasks that depend on the failed task still
+     * run.
+     */
+    void wait()
+    {
+        {
+            std::unique_lock<std::mutex> lk(done_mutex);
+            done_cv.wait(lk, [this] { return nunfinished == 0; });
+        }
+        handles.clear();
+        tasks.clear();
+        if (error) std::rethrow_exception(std::exchange(error, nullptr));
+    }
+
+   private:
+    struct Task {
+        std::function<void()> f;
+        std::atomic<int> npred{1};  ///< Unfinished predecessors + 1 guard
+        std::mutex mutex;           ///< Protects finished and succ
+        bool finished = false;
+        std::vector<Task*> succ;
+
+        template <class F>
+        explicit Task(F&& f) : f(std::forward<F>(f))
+        {}
+    };
+
+    struct Handle {
+        Task* writer = nullptr;
+        std::vector<Task*> readers;
+    };
+
+    struct Worker {
+        std::mutex mutex;
+        std::deque<Task*> queue;
+    };
+
+    /// Makes t wait for pred if pred has not finished yet
+    static void add_edge(Task* pred, Task* t)
+    {
+        std::lock_guard<std::mutex> lk(pred->mutex);
+        if (!pred->finished) {
+            pred->succ.push_back(t);
+            ++t->npred;
+        }
+    }
+
+    /// Pushes a ready task to the deque of worker w
+    void push(Task* t, size_t w)
+    {
+        // Count the task before publishing it, so that the worker that pops
+        // it never decrements nready below zero
+        {
+            std::lock_guard<std::mutex> lk(sleep_mutex);
+            ++nready;
+        }
+        {
+            std::lock_guard<std::mutex> lk(workers[w]->mutex);
+            workers[w]->queue.push_back(t);
+        }
+        sleep_cv.notify_one();
+    }
+
+    /// Pops a task from the deque of worker w or steals one from the others
+    Task* pop(size_t w)
+    {
+        const size_t p = workers.size();
+        for (size_t k = 0; k < p; ++k) {
+            Worker& q = *workers[(w + k) % p];
+            std::lock_guard<std::mutex> lk(q.mutex);
+            if (!q.queue.empty()) {
+                Task* t;
+                if (k == 0) {
+                    t = q.queue.back();
+                    q.queue.pop_back();
+                }
+                else {
+                    t = q.queue.front();
+                    q.queue.pop_front();
+                }
+                return t;
+            }
+        }
+        return nullptr;
+    }
+
+    /// Runs t on worker w and releases its successors
+    void run(Task* t, size_t w)
+    {
+        try {
+            t->f();
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lk(done_mutex);
+            if (!error) error = std::current_exception();
+        }
+
+        std::vector<Task*> succ;
+        {
+            std::lock_guard<std::mutex> lk(t->mutex);
+            t->finished = true;
+            succ.swap(t->succ);
+        }
+        for (Task* s : succ)
+            if (--s->npred == 0) push(s, w);
+
+        std::lock_guard<std::mutex> lk(done_mutex);
+        if (--nunfinished == 0) done_cv.notify_all();
+    }
+
+    void worker_loop(size_t w)
+    {
+        internal::blas3_serial_region serial;
+        while (true) {
+            if (Task* t = pop(w)) {
+                {
+                    std::lock_guard<std::mutex> lk(sleep_mutex);
+                    --nready;
+                }
+                run(t, w);
+                continue;
+            }
+            std::unique_lock<std::mutex> lk(sleep_mutex);
+            sleep_cv.wait(lk, [this] { return stop || nready > 0; });
+            if (stop && nready == 0) return;
+        }
+    }
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+
+    // Used by the submitting thread only, see caller_mutex()
+    std::mutex callers;
+    std::vector<std::unique_ptr<Task>> tasks;
+    std::unordered_map<const void*, Handle> handles;
+    size_t next_worker = 0;
+
+    // Ready tasks and sleeping workers
+    std::mutex sleep_mutex;
+    std::condition_variable sleep_cv;
+    size_t nready = 0;
+    bool stop = false;
+
+    // Unfinished tasks
+    std::mutex done_mutex;
+    std::condition_variable done_cv;
+    size_t nunfinished = 0;
+    std::exception_ptr error;
+};
+
+/**
+ * @brief Task runtime shared by the tiled routines that do not receive one.
+ *
+ * Created on the first call with std::thread::hardware_concurrency() worker
+ * threads. The tiled routines lock its caller_mutex(), so that threads that
+ * call them concurrently run one after the other.
+ */
+inline TaskRuntime& default_task_runtime()
+{
+    static TaskRuntime rt;
+    return rt;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_TASK_RUNTIME_HH
@@ -0,0 +1,123 @@
+/// @file threads.hpp Multithreading settings for the level-3 BLAS templates.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_THREADS_HH
+#define TLAPACK_THREADS_HH
+
+#include <cstddef>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+/// Stringifies its arguments, used by TLAPACK_OMP
+#define TLAPACK_OMP_STRINGIFY(...) #__VA_ARGS__
+
+/**
+ * @brief OpenMP directive that is only emitted when OpenMP is enabled.
+ *
+ * TLAPACK_OMP(parallel for num_threads(nt)) expands to
+ * _Pragma("omp parallel for num_threads(nt)") when _OPENMP is defined, and to
+ * nothing otherwise. This keeps builds without OpenMP free of
+ * -Wunknown-pragmas warnings.
+ */
+#ifdef _OPENMP
+    #define TLAPACK_OMP(...) _Pragma(TLAPACK_OMP_STRINGIFY(omp __VA_ARGS__))
+#else
+    #define TLAPACK_OMP(...)
+#endif
+
+namespace tlapack {
+
+/**
+ * @brief Options for the multithreaded level-3 BLAS templates.
+ *
+ * gemm, trsm, trmm, syrk, herk, syr2k, her2k, symm and hemm split the columns
+ * (or rows) of their output matrix among OpenMP threads when <T>LAPACK is
+ * compiled with OpenMP support, e.g., with the CMake option
+ * TLAPACK_USE_OPENMP. Without OpenMP, these options have no effect.
+ */
+struct Blas3ThreadOpts {
+    /// Maximum number of threads. If nthreads <= 0, use omp_get_max_threads().
+    int nthreads = 0;
+
+    /// Calls with fewer than min_volume multiply-add operations stay serial.
+    std::size_t min_volume = std::size_t(1) << 18;
+};
+
+/**
+ * @brief Options used by the multithreaded level-3 BLAS templates.
+ *
+ * The returned reference can be modified to change the number of threads or
+ * the size threshold for all subsequent calls. The modification is not
+ * thread-safe.
+ *
+ * @code{.cpp}
+ * tlapack::blas3_thread_opts().nthreads = 16;
+ * tlapack::blas3_thread_opts().min_volume = 64 * 64 * 64;
+ * @endcode
+ */
+inline Blas3ThreadOpts& blas3_thread_opts() noexcept
+{
+    static Blas3ThreadOpts opts;
+    return opts;
+}
+
+namespace internal {
+
+    /// Depth of nested blas3_serial_region objects in the calling thread
+    inline int& blas3_serial_depth() noexcept
+    {
+        thread_local int depth = 0;
+        return depth;
+    }
+
+    /**
+     * @brief Keeps the level-3 BLAS templates serial in the calling thread
+     * while the object is alive.
+     *
+     * Used by the workers of tlapack::TaskRuntime, whose tasks already run in
+     * parallel.
+     */
+    struct blas3_serial_region {
+        blas3_serial_region() noexcept { ++blas3_serial_depth(); }
+        ~blas3_serial_region() { --blas3_serial_depth(); }
+
+        blas3_serial_region(const blas3_serial_region&) = delete;
+        blas3_serial_region& operator=(const blas3_serial_region&) = delete;
+    };
+
+    /**
+     * @brief Number of threads for a level-3 operation with a given number of
+     * multiply-add operations.
+     *
+     * Returns 1 if OpenMP is not enabled, if the operation is smaller than
+     * blas3_thread_opts().min_volume, if the call is already inside a
+     * parallel region, or if it is inside a blas3_serial_region.
+     */
+    inline int blas3_num_threads(std::size_t volume) noexcept
+    {
+#ifdef _OPENMP
+        const Blas3ThreadOpts& opts = blas3_thread_opts();
+        if (volume < opts.min_volume || omp_in_parallel() ||
+            blas3_serial_depth() > 0)
+            return 1;
+        const int nt =
+            (opts.nthreads > 0) ? opts.nthreads : omp_get_max_threads();
+        return (nt > 1) ? nt : 1;
+#else
+        (void)volume;
+        return 1;
+#endif
+    }
+
+}  // namespace internal
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_THREADS_HH
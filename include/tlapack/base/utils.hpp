@@ -21,6 +21,7 @@
 #include "tlapack/base/exceptionHandling.hpp"
 #include "tlapack/base/types.hpp"
 #include "tlapack/base/workspace.hpp"
+#include "tlapack/base/workspaceArena.hpp"
 
 #ifdef TLAPACK_USE_LAPACKPP
     #include "lapack.hh"  // from LAPACK++
@@ -164,6 +165,30 @@ namespace traits {
 
         template <class T>
         constexpr bool is_vector = has_operator_brackets_with_1_index<T>::value;
+
+        template <class T, typename = int>
+        struct has_legacy_matrix : std::false_type {};
+
+        // True if legacy_matrix(const T&) can be called from the namespace
+        // tlapack.
+        template <class T>
+        struct has_legacy_matrix<
+            T,
+            enable_if_t<!is_same_v<decltype(legacy_matrix(std::declval<T>())),
+                                   void>,
+                        int>> : std::true_type {};
+
+        template <class T, typename = int>
+        struct has_legacy_vector : std::false_type {};
+
+        // True if legacy_vector(const T&) can be called from the namespace
+        // tlapack.
+        template <class T>
+        struct has_legacy_vector<
+            T,
+            enable_if_t<!is_same_v<decltype(legacy_vector(std::declval<T>())),
+                                   void>,
+                        int>> : std::true_type {};
     }  // namespace internal
 }  // namespace traits
 
@@ -0,0 +1,142 @@
+/// @file workspaceArena.hpp Reusable workspace for the routines that allocate
+/// their own workspace.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_WORKSPACE_ARENA_HH
+#define TLAPACK_WORKSPACE_ARENA_HH
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "tlapack/base/workspace.hpp"
+
+namespace tlapack {
+
+/**
+ * @brief Pool of reusable workspace buffers with entries of type T.
+ *
+ * The overloads without the suffix @c _work, e.g., geqrf(A, tau), take their
+ * workspace from the arena of the calling thread, see
+ * tlapack::workspace_arena(). A buffer is checked out with get() and returns
+ * to the arena when the WorkspaceArena::Buffer object is destroyed. Returned
+ * buffers keep their memory, and every new buffer reserves the largest size
+ * requested so far. Therefore, after the first call, repeated calls with
+ * problems of the same size do not allocate memory.
+ *
+ * Nested calls check out different buffers, so the arena can be used by
+ * routines that call other routines using the arena.
+ *
+ * @note Matrix types whose tlapack::Create functor ignores the std::vector
+ * argument, e.g., Eigen matrices, still allocate their own memory.
+ *
+ * @tparam T Entry type.
+ */
+template <class T>
+class WorkspaceArena {
+   public:
+    /// Workspace buffer checked out from a WorkspaceArena
+    class Buffer {
+       public:
+        Buffer(const Buffer&) = delete;
+        Buffer& operator=(const Buffer&) = delete;
+
+        Buffer(Buffer&& other) noexcept
+            : arena(std::exchange(other.arena, nullptr)),
+              v(std::move(other.v))
+        {}
+
+        ~Buffer()
+        {
+            if (arena) arena->release(std::move(v));
+        }
+
+        /// Empty vector with enough capacity for the requested workspace
+        std::vector<T>& vector() noexcept { return v; }
+
+       private:
+        friend class WorkspaceArena;
+
+        Buffer(WorkspaceArena* arena, std::vector<T>&& v) noexcept
+            : arena(arena), v(std::move(v))
+        {}
+
+        WorkspaceArena* arena;
+        std::vector<T> v;
+    };
+
+    /**
+     * @brief Checks out a buffer with capacity for the workspace described by
+     * @c workinfo.
+     *
+     * The capacity of the buffer is at least the largest size requested from
+     * this arena since the last call to reset().
+     */
+    Buffer get(const WorkInfo& workinfo)
+    {
+        if (workinfo.size() > maxSize) maxSize = workinfo.size();
+
+        std::vector<T> v;
+        if (!idle.empty()) {
+            v = std::move(idle.back());
+            idle.pop_back();
+        }
+        v.reserve(maxSize);
+
+        return Buffer(this, std::move(v));
+    }
+
+    /// Checks out a buffer with capacity for n entries
+    Buffer get(std::size_t n) { return get(WorkInfo(n)); }
+
+    /**
+     * @brief Frees the memory of all buffers that are not checked out.
+     *
+     * Buffers checked out at the moment of the call are kept until they are
+     * returned.
+     */
+    void reset() noexcept
+    {
+        idle.clear();
+        idle.shrink_to_fit();
+        maxSize = 0;
+    }
+
+    /// Largest workspace size, in entries, requested since the last reset()
+    std::size_t max_size() const noexcept { return maxSize; }
+
+   private:
+    void release(std::vector<T>&& v)
+    {
+        v.clear();
+        idle.push_back(std::move(v));
+    }
+
+    std::vector<std::vector<T>> idle;  ///< Buffers that are not checked out
+    std::size_t maxSize = 0;
+};
+
+/**
+ * @brief Workspace arena of the calling thread for entries of type T.
+ *
+ * Call @c reset() on the returned object to release the memory kept between
+ * calls, e.g.,
+ * @code{.cpp}
+ * tlapack::workspace_arena<double>().reset();
+ * @endcode
+ */
+template <class T>
+WorkspaceArena<T>& workspace_arena() noexcept
+{
+    thread_local WorkspaceArena<T> arena;
+    return arena;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_WORKSPACE_ARENA_HH
@@ -0,0 +1,128 @@
+/// @file accumulation.hpp Summation algorithms for the accumulations in dot,
+/// gemv and gemm.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BLAS_ACCUMULATION_HH
+#define TLAPACK_BLAS_ACCUMULATION_HH
+
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/// @brief Summation algorithm used to accumulate products.
+enum class AccumulationVariant : char {
+    Sequential = 'S',   ///< One running sum. Error bound O(n u).
+    Compensated = 'C',  ///< Kahan summation. Error bound O(u) + O(n u^2).
+    Pairwise = 'P',     ///< Sum of the halves, recursively. Error bound
+                        ///< O(log(n) u).
+};
+
+/**
+ * @brief Options for the accumulations in dot(), gemv() and gemm().
+ *
+ * The products are accumulated in the type
+ * accumulator_type<accum_t, TA, TB>, i.e., in the highest precision among
+ * accum_t and the types of the data. Use accum_t = void to accumulate in the
+ * precision of the data.
+ *
+ * @code{.cpp}
+ * // Compensated sum in double of vectors of float
+ * double d = tlapack::dot(x, y, tlapack::AccumulationOpts<double>{
+ *     tlapack::AccumulationVariant::Compensated});
+ * @endcode
+ *
+ * @note The compensated summation needs IEEE arithmetic. Flags that allow the
+ * compiler to reassociate floating-point sums, e.g., -ffast-math, turn it into
+ * the sequential summation.
+ *
+ * @tparam accum_t Type of the accumulator, or void.
+ */
+template <class accum_t = void>
+struct AccumulationOpts {
+    /// Summation algorithm
+    AccumulationVariant variant = AccumulationVariant::Sequential;
+
+    /// Pairwise summation: length of the blocks summed sequentially
+    std::size_t nb = 8;
+};
+
+namespace internal {
+
+    template <class accum_t, class... Ts>
+    struct accumulator_type_traits {
+        using type = scalar_type<accum_t, Ts...>;
+    };
+
+    template <class... Ts>
+    struct accumulator_type_traits<void, Ts...> {
+        using type = scalar_type<Ts...>;
+    };
+
+}  // namespace internal
+
+/// Type of the accumulator for products of Ts... with AccumulationOpts<accum_t>
+template <class accum_t, class... Ts>
+using accumulator_type =
+    typename internal::accumulator_type_traits<accum_t, Ts...>::type;
+
+namespace internal {
+
+    /**
+     * Pairwise sum of term(l) for l in [l0, l1).
+     */
+    template <class T, class idx_t, class term_t>
+    T pairwise_sum(idx_t l0, idx_t l1, const term_t& term, idx_t nb)
+    {
+        if (l1 - l0 <= nb) {
+            T s(0);
+            for (idx_t l = l0; l < l1; ++l)
+                s += term(l);
+            return s;
+        }
+        const idx_t lm = l0 + (l1 - l0) / 2;
+        return pairwise_sum<T>(l0, lm, term, nb) +
+               pairwise_sum<T>(lm, l1, term, nb);
+    }
+
+    /**
+     * Sum of term(l) for l in [0, n) with the algorithm in opts.
+     *
+     * @tparam T Type of the accumulator. term(l) must return T.
+     */
+    template <class T, class idx_t, class term_t, class accum_t>
+    T accumulate(idx_t n,
+                 const term_t& term,
+                 const AccumulationOpts<accum_t>& opts)
+    {
+        if (opts.variant == AccumulationVariant::Compensated) {
+            T s(0), c(0);
+            for (idx_t l = 0; l < n; ++l) {
+                const T y = term(l) - c;
+                const T t = s + y;
+                c = (t - s) - y;
+                s = t;
+            }
+            return s;
+        }
+        else if (opts.variant == AccumulationVariant::Pairwise) {
+            return pairwise_sum<T>(idx_t(0), n, term,
+                                   max(idx_t(1), (idx_t)opts.nb));
+        }
+        else {
+            T s(0);
+            for (idx_t l = 0; l < n; ++l)
+                s += term(l);
+            return s;
+        }
+    }
+
+}  // namespace internal
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BLAS_ACCUMULATION_HH
@@ -12,6 +12,7 @@
 #define TLAPACK_BLAS_AXPY_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/simd_kernels.hpp"
 
 namespace tlapack {
 
@@ -41,6 +42,17 @@ void axpy(const alpha_t& alpha, const vectorX_t& x, vectorY_t& y)
     // check arguments
     tlapack_check_false((idx_t)size(y) < n);
 
+    // Contiguous vectors of float or double use the vectorized kernel
+    if constexpr (traits::internal::is_simd_vector<vectorX_t, T> &&
+                  traits::internal::is_simd_vector<vectorY_t, T> &&
+                  !is_same_v<alpha_t, StrongZero> &&
+                  std::is_constructible<T, alpha_t>::value) {
+        auto x_ = legacy_vector(x);
+        auto y_ = legacy_vector(y);
+        if (x_.inc == 1 && y_.inc == 1)
+            return internal::simd_axpy<T>(n, T(alpha), x_.ptr, y_.ptr);
+    }
+
     for (idx_t i = 0; i < n; ++i)
         y[i] += alpha * x[i];
 }
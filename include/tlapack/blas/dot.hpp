@@ -12,6 +12,8 @@
 #define TLAPACK_BLAS_DOT_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/accumulation.hpp"
+#include "tlapack/blas/simd_kernels.hpp"
 
 namespace tlapack {
 
@@ -40,6 +42,15 @@ auto dot(const vectorX_t& x, const vectorY_t& y)
     // check arguments
     tlapack_check_false(size(y) != n);
 
+    // Contiguous vectors of float or double use the vectorized kernel
+    if constexpr (traits::internal::is_simd_vector<vectorX_t, T> &&
+                  traits::internal::is_simd_vector<vectorY_t, T>) {
+        auto x_ = legacy_vector(x);
+        auto y_ = legacy_vector(y);
+        if (x_.inc == 1 && y_.inc == 1)
+            return internal::simd_dot<T>(n, x_.ptr, y_.ptr);
+    }
+
     return_t result(0);
     for (idx_t i = 0; i < n; ++i)
         result += conj(x[i]) * y[i];
@@ -47,6 +58,38 @@ auto dot(const vectorX_t& x, const vectorY_t& y)
     return result;
 }
 
+/**
+ * @return dot product, $x^H y$, accumulated with the algorithm and in the
+ * precision given by opts.
+ *
+ * The result has type accumulator_type<accum_t, TX, TY>, so that a sum
+ * accumulated in a wider type is not rounded back to the type of the data.
+ *
+ * @param[in] x A n-element vector.
+ * @param[in] y A n-element vector.
+ * @param[in] opts Options. See AccumulationOpts.
+ *
+ * @ingroup blas1
+ */
+template <TLAPACK_VECTOR vectorX_t, TLAPACK_VECTOR vectorY_t, class accum_t>
+auto dot(const vectorX_t& x,
+         const vectorY_t& y,
+         const AccumulationOpts<accum_t>& opts)
+{
+    using sum_t =
+        accumulator_type<accum_t, type_t<vectorX_t>, type_t<vectorY_t> >;
+    using idx_t = size_type<vectorX_t>;
+
+    // constants
+    const idx_t n = size(x);
+
+    // check arguments
+    tlapack_check_false(size(y) != n);
+
+    return internal::accumulate<sum_t>(
+        n, [&](idx_t i) { return conj(sum_t(x[i])) * sum_t(y[i]); }, opts);
+}
+
 #ifdef TLAPACK_USE_LAPACKPP
 
 template <
@@ -11,10 +11,73 @@
 #ifndef TLAPACK_BLAS_GEMM_HH
 #define TLAPACK_BLAS_GEMM_HH
 
+#include "tlapack/base/threads.hpp"
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/accumulation.hpp"
+#include "tlapack/blas/gemm_packed.hpp"
 
 namespace tlapack {
 
+namespace internal {
+
+    /**
+     * gemm() for tiny matrices whose extents are known at compile time.
+     *
+     * $op(A)$ and $op(B)$ are copied to local arrays, so that all loops have
+     * constant bounds and can be fully unrolled.
+     *
+     * @tparam K Number of columns of $op(A)$.
+     */
+    template <int K,
+              class matrixA_t,
+              class matrixB_t,
+              class matrixC_t,
+              class alpha_t,
+              class beta_t>
+    void gemm_static(Op transA,
+                     Op transB,
+                     const alpha_t& alpha,
+                     const matrixA_t& A,
+                     const matrixB_t& B,
+                     const beta_t& beta,
+                     matrixC_t& C)
+    {
+        using TA = type_t<matrixA_t>;
+        using TB = type_t<matrixB_t>;
+        using scalar_t = scalar_type<TA, TB>;
+        using idx_t = size_type<matrixC_t>;
+
+        // constants
+        constexpr idx_t m = static_nrows<matrixC_t>;
+        constexpr idx_t n = static_ncols<matrixC_t>;
+        constexpr idx_t k = K;
+
+        // a := op(A) and b := op(B), both column-major
+        TA a[m * k];
+        TB b[k * n];
+        for (idx_t l = 0; l < k; ++l)
+            for (idx_t i = 0; i < m; ++i)
+                a[i + l * m] = (transA == Op::NoTrans) ? A(i, l)
+                               : (transA == Op::Trans) ? A(l, i)
+                                                       : conj(A(l, i));
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t l = 0; l < k; ++l)
+                b[l + j * k] = (transB == Op::NoTrans) ? B(l, j)
+                               : (transB == Op::Trans) ? B(j, l)
+                                                       : conj(B(j, l));
+
+        for (idx_t j = 0; j < n; ++j) {
+            for (idx_t i = 0; i < m; ++i) {
+                scalar_t sum(0);
+                for (idx_t l = 0; l < k; ++l)
+                    sum += a[i + l * m] * b[l + j * k];
+                C(i, j) = alpha * sum + beta * C(i, j);
+            }
+        }
+    }
+
+}  // namespace internal
+
 /**
  * General matrix-matrix multiply:
  * \[
@@ -45,6 +108,13 @@ namespace tlapack {
  * @param[in] beta Scalar.
  * @param[in,out] C A m-by-n matrix.
  *
+ * @note Large products of row- or column-major matrices of float, double,
+ * std::complex<float> or std::complex<double> are forwarded to gemm_packed().
+ * With OpenMP, large products split the columns of C among threads, see
+ * tlapack::blas3_thread_opts().
+ * Products of tiny matrices with extents known at compile time are computed on
+ * copies of A and B in the stack, with constant loop bounds.
+ *
  * @ingroup blas3
  */
 template <TLAPACK_MATRIX matrixA_t,
@@ -86,10 +156,33 @@ void gemm(Op transA,
     tlapack_check_false(
         (idx_t)((transB == Op::NoTrans) ? nrows(B) : ncols(B)) != k);
 
+    // Tiny products with compile-time extents have constant loop bounds
+    if constexpr (has_small_static_extents<matrixA_t, matrixB_t, matrixC_t>) {
+        if (transA == Op::NoTrans)
+            return internal::gemm_static<static_ncols<matrixA_t>>(
+                transA, transB, alpha, A, B, beta, C);
+        else
+            return internal::gemm_static<static_nrows<matrixA_t>>(
+                transA, transB, alpha, A, B, beta, C);
+    }
+
+    // Large products of contiguous matrices use the packed engine
+    if constexpr (traits::allow_gemm_packed<matrixA_t, matrixB_t, matrixC_t,
+                                            alpha_t, beta_t>) {
+        if ((std::size_t)m * n * k >=
+            traits::gemm_blocking_trait<T, int>::min_volume)
+            return gemm_packed(transA, transB, alpha, A, B, beta, C);
+    }
+
+    // Columns of C are computed in parallel for large products
+    [[maybe_unused]] const int nt =
+        internal::blas3_num_threads((std::size_t)m * n * k);
+
     if (transA == Op::NoTrans) {
         using scalar_t = scalar_type<alpha_t, TB>;
 
         if (transB == Op::NoTrans) {
+            TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = 0; i < m; ++i)
                     C(i, j) *= beta;
@@ -101,6 +194,7 @@ void gemm(Op transA,
             }
         }
         else if (transB == Op::Trans) {
+            TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = 0; i < m; ++i)
                     C(i, j) *= beta;
@@ -112,6 +206,7 @@ void gemm(Op transA,
             }
         }
         else {  // transB == Op::ConjTrans
+            TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = 0; i < m; ++i)
                     C(i, j) *= beta;
@@ -127,6 +222,7 @@ void gemm(Op transA,
         using scalar_t = scalar_type<TA, TB>;
 
         if (transB == Op::NoTrans) {
+            TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = 0; i < m; ++i) {
                     scalar_t sum(0);
@@ -137,6 +233,7 @@ void gemm(Op transA,
             }
         }
         else if (transB == Op::Trans) {
+            TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = 0; i < m; ++i) {
                     scalar_t sum(0);
@@ -147,6 +244,7 @@ void gemm(Op transA,
             }
         }
         else {  // transB == Op::ConjTrans
+            TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = 0; i < m; ++i) {
                     scalar_t sum(0);
@@ -162,6 +260,7 @@ void gemm(Op transA,
         using scalar_t = scalar_type<TA, TB>;
 
         if (transB == Op::NoTrans) {
+            TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = 0; i < m; ++i) {
                     scalar_t sum(0);
@@ -172,6 +271,7 @@ void gemm(Op transA,
             }
         }
         else if (transB == Op::Trans) {
+            TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = 0; i < m; ++i) {
                     scalar_t sum(0);
@@ -182,6 +282,7 @@ void gemm(Op transA,
             }
         }
         else {  // transB == Op::ConjTrans
+            TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = 0; i < m; ++i) {
                     scalar_t sum(0);
@@ -355,6 +456,88 @@ void gemm(Op transA,
     return gemm(transA, transB, alpha, A, B, StrongZero(), C);
 }
 
+/**
+ * General matrix-matrix multiply:
+ * \[
+ *     C := \alpha op(A) \times op(B) + \beta C,
+ * \]
+ * with each entry of $op(A) \times op(B)$ accumulated with the algorithm and
+ * in the precision given by opts. See gemm() for the description of the
+ * arguments.
+ *
+ * The entries of $op(A) \times op(B)$ are computed as dot products, without
+ * the packed engine. With OpenMP, the columns of C are split among threads,
+ * see tlapack::blas3_thread_opts().
+ *
+ * @param[in] opts Options. See AccumulationOpts.
+ *
+ * @ingroup blas3
+ */
+template <TLAPACK_MATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_MATRIX matrixC_t,
+          TLAPACK_SCALAR alpha_t,
+          TLAPACK_SCALAR beta_t,
+          class accum_t>
+void gemm(Op transA,
+          Op transB,
+          const alpha_t& alpha,
+          const matrixA_t& A,
+          const matrixB_t& B,
+          const beta_t& beta,
+          matrixC_t& C,
+          const AccumulationOpts<accum_t>& opts)
+{
+    // data traits
+    using TA = type_t<matrixA_t>;
+    using TB = type_t<matrixB_t>;
+    using TC = type_t<matrixC_t>;
+    using sum_t = accumulator_type<accum_t, TA, TB>;
+    using out_t = scalar_type<alpha_t, sum_t>;
+    using idx_t = size_type<matrixA_t>;
+
+    // constants
+    const idx_t m = (transA == Op::NoTrans) ? nrows(A) : ncols(A);
+    const idx_t n = (transB == Op::NoTrans) ? ncols(B) : nrows(B);
+    const idx_t k = (transA == Op::NoTrans) ? ncols(A) : nrows(A);
+
+    // check arguments
+    tlapack_check_false(transA != Op::NoTrans && transA != Op::Trans &&
+                        transA != Op::ConjTrans);
+    tlapack_check_false(transB != Op::NoTrans && transB != Op::Trans &&
+                        transB != Op::ConjTrans);
+    tlapack_check_false((idx_t)nrows(C) != m);
+    tlapack_check_false((idx_t)ncols(C) != n);
+    tlapack_check_false(
+        (idx_t)((transB == Op::NoTrans) ? nrows(B) : ncols(B)) != k);
+
+    // Entries of op(A) and op(B) in the precision of the accumulator
+    auto opA = [&](idx_t i, idx_t l) {
+        return (transA == Op::NoTrans) ? sum_t(A(i, l))
+               : (transA == Op::Trans) ? sum_t(A(l, i))
+                                       : conj(sum_t(A(l, i)));
+    };
+    auto opB = [&](idx_t l, idx_t j) {
+        return (transB == Op::NoTrans) ? sum_t(B(l, j))
+               : (transB == Op::Trans) ? sum_t(B(j, l))
+                                       : conj(sum_t(B(j, l)));
+    };
+
+    // Columns of C are computed in parallel for large products
+    [[maybe_unused]] const int nt =
+        internal::blas3_num_threads((std::size_t)m * n * k);
+
+    TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
+    for (idx_t j = 0; j < n; ++j) {
+        for (idx_t i = 0; i < m; ++i) {
+            const sum_t s = internal::accumulate<sum_t>(
+                k, [&](idx_t l) { return opA(i, l) * opB(l, j); }, opts);
+            C(i, j) *= beta;
+            C(i, j) += TC(out_t(alpha) * out_t(s));
+        }
+    }
+}
+
 }  // namespace tlapack
 
 #endif  //  #ifndef TLAPACK_BLAS_GEMM_HH
@@ -0,0 +1,632 @@
+/// @file gemm_packed.hpp Cache-blocked general matrix-matrix multiply with
+/// packed panels and a register-tiled micro-kernel.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BLAS_GEMM_PACKED_HH
+#define TLAPACK_BLAS_GEMM_PACKED_HH
+
+#include <complex>
+#include <vector>
+
+#include "tlapack/base/threads.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/simd_kernels.hpp"
+
+namespace tlapack {
+
+namespace traits {
+
+    /**
+     * @brief Blocking parameters of the generic micro-kernel of gemm_packed()
+     * for the entry type T.
+     *
+     * The vectorized micro-kernels used for float and double have their own
+     * blocking parameters. See tlapack::simd_isa().
+     *
+     * - mr and nr are the dimensions of the register tile computed by the
+     * micro-kernel.
+     * - kc is the depth of the packed panels. A kc-by-nr sliver of B is meant
+     * to stay in the L1 cache.
+     * - mc is the number of rows of the packed block of A. An mc-by-kc block
+     * of A is meant to stay in the L2 cache.
+     * - nc is the number of columns of the packed block of B. A kc-by-nc
+     * block of B is meant to stay in the L3 cache.
+     * - min_volume is the minimum value of m*n*k for which gemm() uses
+     * gemm_packed(). Smaller products are not worth the packing.
+     *
+     * @tparam T Entry type.
+     * @tparam class If this is not an int, then the trait is not defined.
+     */
+    template <class T, class = int>
+    struct gemm_blocking_trait {
+        static constexpr int mr = 4;
+        static constexpr int nr = 4;
+        static constexpr std::size_t mc = 64;
+        static constexpr std::size_t kc = 128;
+        static constexpr std::size_t nc = 2048;
+        static constexpr std::size_t min_volume = 32768;
+    };
+
+    template <>
+    struct gemm_blocking_trait<float, int> {
+        static constexpr int mr = 8;
+        static constexpr int nr = 4;
+        static constexpr std::size_t mc = 128;
+        static constexpr std::size_t kc = 384;
+        static constexpr std::size_t nc = 4096;
+        static constexpr std::size_t min_volume = 32768;
+    };
+
+    template <>
+    struct gemm_blocking_trait<double, int> {
+        static constexpr int mr = 4;
+        static constexpr int nr = 8;
+        static constexpr std::size_t mc = 96;
+        static constexpr std::size_t kc = 256;
+        static constexpr std::size_t nc = 4096;
+        static constexpr std::size_t min_volume = 32768;
+    };
+
+    template <>
+    struct gemm_blocking_trait<std::complex<float>, int> {
+        static constexpr int mr = 8;
+        static constexpr int nr = 2;
+        static constexpr std::size_t mc = 96;
+        static constexpr std::size_t kc = 256;
+        static constexpr std::size_t nc = 4096;
+        static constexpr std::size_t min_volume = 8192;
+    };
+
+    template <>
+    struct gemm_blocking_trait<std::complex<double>, int> {
+        static constexpr int mr = 4;
+        static constexpr int nr = 2;
+        static constexpr std::size_t mc = 64;
+        static constexpr std::size_t kc = 192;
+        static constexpr std::size_t nc = 4096;
+        static constexpr std::size_t min_volume = 8192;
+    };
+
+    namespace internal {
+
+        /// True if T is one of the entry types handled by gemm_packed().
+        template <class T>
+        constexpr bool is_gemm_packed_type =
+            is_same_v<T, float> || is_same_v<T, double> ||
+            is_same_v<T, std::complex<float>> ||
+            is_same_v<T, std::complex<double>>;
+
+        /// True if matrix_t is a row- or column-major matrix with entries of
+        /// type T that can be converted to a legacy matrix.
+        template <class matrix_t, class T>
+        constexpr bool is_gemm_packed_matrix =
+            has_legacy_matrix<matrix_t>::value &&
+            is_same_v<type_t<matrix_t>, T> &&
+            (layout<matrix_t> == Layout::ColMajor ||
+             layout<matrix_t> == Layout::RowMajor);
+    }  // namespace internal
+
+    /// True if gemm() may forward the computation to gemm_packed().
+    template <class matrixA_t,
+              class matrixB_t,
+              class matrixC_t,
+              class alpha_t,
+              class beta_t,
+              class T = type_t<matrixC_t>>
+    constexpr bool allow_gemm_packed =
+        internal::is_gemm_packed_type<T> &&
+        internal::is_gemm_packed_matrix<matrixA_t, T> &&
+        internal::is_gemm_packed_matrix<matrixB_t, T> &&
+        internal::is_gemm_packed_matrix<matrixC_t, T> &&
+        !is_same_v<alpha_t, StrongZero> &&
+        std::is_constructible<T, alpha_t>::value &&
+        (is_same_v<beta_t, StrongZero> ||
+         std::is_constructible<T, beta_t>::value);
+
+}  // namespace traits
+
+namespace internal {
+
+    /**
+     * Packs the mb-by-kb block $op(A)$ into micro-panels of mr rows.
+     *
+     * Entry (i,l) of $op(A)$ is A[i*rsA + l*csA], conjugated if conjA is
+     * true. The last micro-panel is padded with zeros.
+     *
+     * @param[out] Ap Packed buffer with at least ceil(mb/mr)*mr*kb entries.
+     */
+    template <int mr, class T, class idx_t>
+    void gemm_pack_A(idx_t mb,
+                     idx_t kb,
+                     const T* A,
+                     idx_t rsA,
+                     idx_t csA,
+                     bool conjA,
+                     T* Ap)
+    {
+        for (idx_t ir = 0; ir < mb; ir += mr) {
+            const idx_t ib = min<idx_t>(mr, mb - ir);
+            const T* Ai = A + ir * rsA;
+            for (idx_t l = 0; l < kb; ++l) {
+                const T* Ail = Ai + l * csA;
+                idx_t i = 0;
+                if (conjA)
+                    for (; i < ib; ++i)
+                        Ap[i] = conj(Ail[i * rsA]);
+                else
+                    for (; i < ib; ++i)
+                        Ap[i] = Ail[i * rsA];
+                for (; i < mr; ++i)
+                    Ap[i] = T(0);
+                Ap += mr;
+            }
+        }
+    }
+
+    /**
+     * Packs the kb-by-nb block $op(B)$ into micro-panels of nr columns.
+     *
+     * Entry (l,j) of $op(B)$ is B[l*rsB + j*csB], conjugated if conjB is
+     * true. The last micro-panel is padded with zeros.
+     *
+     * @param[out] Bp Packed buffer with at least ceil(nb/nr)*nr*kb entries.
+     */
+    template <int nr, class T, class idx_t>
+    void gemm_pack_B(idx_t kb,
+                     idx_t nb,
+                     const T* B,
+                     idx_t rsB,
+                     idx_t csB,
+                     bool conjB,
+                     T* Bp)
+    {
+        for (idx_t jr = 0; jr < nb; jr += nr) {
+            const idx_t jb = min<idx_t>(nr, nb - jr);
+            const T* Bj = B + jr * csB;
+            for (idx_t l = 0; l < kb; ++l) {
+                const T* Blj = Bj + l * rsB;
+                idx_t j = 0;
+                if (conjB)
+                    for (; j < jb; ++j)
+                        Bp[j] = conj(Blj[j * csB]);
+                else
+                    for (; j < jb; ++j)
+                        Bp[j] = Blj[j * csB];
+                for (; j < nr; ++j)
+                    Bp[j] = T(0);
+                Bp += nr;
+            }
+        }
+    }
+
+    /**
+     * Generic micro-kernel of gemm_packed() and its blocking parameters.
+     *
+     * run() computes
+     * \[
+     *     C := C + \alpha A_p B_p,
+     * \]
+     * where $A_p$ is a packed mr-by-kb micro-panel, $B_p$ is a packed
+     * kb-by-nr micro-panel and C is the leading ib-by-jb part of an mr-by-nr
+     * tile with entry (i,j) at C[i*rsC + j*csC].
+     *
+     * The mr-by-nr accumulator has compile-time sizes so that the compiler
+     * can keep it in registers.
+     */
+    template <class T>
+    struct gemm_generic_kernel {
+        using blocking = traits::gemm_blocking_trait<T, int>;
+        static constexpr int mr = blocking::mr;
+        static constexpr int nr = blocking::nr;
+        static constexpr std::size_t mc = blocking::mc;
+        static constexpr std::size_t kc = blocking::kc;
+        static constexpr std::size_t nc = blocking::nc;
+
+        template <class idx_t>
+        static void run(idx_t kb,
+                        const T& alpha,
+                        const T* Ap,
+                        const T* Bp,
+                        idx_t ib,
+                        idx_t jb,
+                        T* C,
+                        idx_t rsC,
+                        idx_t csC)
+        {
+            T ab[nr][mr] = {};
+
+            for (idx_t l = 0; l < kb; ++l) {
+                for (int j = 0; j < nr; ++j) {
+                    const T b = Bp[j];
+                    for (int i = 0; i < mr; ++i)
+                        ab[j][i] += Ap[i] * b;
+                }
+                Ap += mr;
+                Bp += nr;
+            }
+
+            for (idx_t j = 0; j < jb; ++j)
+                for (idx_t i = 0; i < ib; ++i)
+                    C[i * rsC + j * csC] += alpha * ab[j][i];
+        }
+    };
+
+#ifdef TLAPACK_SIMD
+
+    /// Blocking parameters of the vectorized micro-kernels for vectors of W
+    /// bytes.
+    template <class T, int W>
+    struct gemm_simd_blocking {
+        static constexpr int mr = 2 * W / sizeof(T);
+        static constexpr int nr = (W == 16) ? 4 : (W == 32) ? 6 : 8;
+        static constexpr std::size_t mc = 96 * (8 / sizeof(T));
+        static constexpr std::size_t kc = 256;
+        static constexpr std::size_t nc = 4096;
+    };
+
+    /// Micro-kernel of gemm_packed() for 128-bit vectors.
+    /// @see gemm_generic_kernel
+    template <class T>
+    struct gemm_vec128_kernel : gemm_simd_blocking<T, 16> {
+        template <class idx_t>
+        static void run(idx_t kb,
+                        const T& alpha,
+                        const T* Ap,
+                        const T* Bp,
+                        idx_t ib,
+                        idx_t jb,
+                        T* C,
+                        idx_t rsC,
+                        idx_t csC)
+        {
+            gemm_kernel_vec<T, 16, gemm_simd_blocking<T, 16>::nr>(
+                kb, alpha, Ap, Bp, ib, jb, C, rsC, csC);
+        }
+    };
+
+    #ifdef TLAPACK_SIMD_X86
+
+    /// Micro-kernel of gemm_packed() for AVX2.
+    /// @see gemm_generic_kernel
+    template <class T>
+    struct gemm_avx2_kernel : gemm_simd_blocking<T, 32> {
+        template <class idx_t>
+        TLAPACK_TARGET_AVX2 static void run(idx_t kb,
+                                            const T& alpha,
+                                            const T* Ap,
+                                            const T* Bp,
+                                            idx_t ib,
+                                            idx_t jb,
+                                            T* C,
+                                            idx_t rsC,
+                                            idx_t csC)
+        {
+            gemm_kernel_vec<T, 32, gemm_simd_blocking<T, 32>::nr>(
+                kb, alpha, Ap, Bp, ib, jb, C, rsC, csC);
+        }
+    };
+
+    /// Micro-kernel of gemm_packed() for AVX-512.
+    /// @see gemm_generic_kernel
+    template <class T>
+    struct gemm_avx512_kernel : gemm_simd_blocking<T, 64> {
+        template <class idx_t>
+        TLAPACK_TARGET_AVX512 static void run(idx_t kb,
+                                              const T& alpha,
+                                              const T* Ap,
+                                              const T* Bp,
+                                              idx_t ib,
+                                              idx_t jb,
+                                              T* C,
+                                              idx_t rsC,
+                                              idx_t csC)
+        {
+            gemm_kernel_vec<T, 64, gemm_simd_blocking<T, 64>::nr>(
+                kb, alpha, Ap, Bp, ib, jb, C, rsC, csC);
+        }
+    };
+
+    #endif  // TLAPACK_SIMD_X86
+
+#endif  // TLAPACK_SIMD
+
+    /**
+     * Loop nest of gemm_packed() around the micro-kernel kernel_t::run().
+     *
+     * Computes C := alpha op(A) op(B) + C. The loop nest follows Goto and van
+     * de Geijn, "Anatomy of High-Performance Matrix Multiplication", ACM TOMS
+     * 34(3), 2008.
+     */
+    template <class kernel_t, class T, class idx_t>
+    void gemm_packed_loops(idx_t m,
+                           idx_t n,
+                           idx_t k,
+                           const T& alpha,
+                           const T* A,
+                           idx_t rsA,
+                           idx_t csA,
+                           bool conjA,
+                           const T* B,
+                           idx_t rsB,
+                           idx_t csB,
+                           bool conjB,
+                           T* C,
+                           idx_t rsC,
+                           idx_t csC)
+    {
+        constexpr int mr = kernel_t::mr;
+        constexpr int nr = kernel_t::nr;
+
+        // Block sizes rounded to multiples of the register tile
+        const idx_t mc = min<idx_t>(kernel_t::mc, ((m + mr - 1) / mr) * mr);
+        const idx_t nc = min<idx_t>(kernel_t::nc, ((n + nr - 1) / nr) * nr);
+        const idx_t kc = min<idx_t>(kernel_t::kc, k);
+
+        // Packed buffers
+        std::vector<T> Ap_(mc * kc);
+        std::vector<T> Bp_(kc * nc);
+        T* Ap = Ap_.data();
+        T* Bp = Bp_.data();
+
+        for (idx_t jc = 0; jc < n; jc += nc) {
+            const idx_t nb = min(nc, n - jc);
+
+            for (idx_t pc = 0; pc < k; pc += kc) {
+                const idx_t kb = min(kc, k - pc);
+
+                gemm_pack_B<nr>(kb, nb, B + pc * rsB + jc * csB, rsB, csB,
+                                conjB, Bp);
+
+                for (idx_t ic = 0; ic < m; ic += mc) {
+                    const idx_t mb = min(mc, m - ic);
+
+                    gemm_pack_A<mr>(mb, kb, A + ic * rsA + pc * csA, rsA, csA,
+                                    conjA, Ap);
+
+                    for (idx_t jr = 0; jr < nb; jr += nr) {
+                        const idx_t jb = min<idx_t>(nr, nb - jr);
+                        for (idx_t ir = 0; ir < mb; ir += mr) {
+                            const idx_t ib = min<idx_t>(mr, mb - ir);
+                            kernel_t::run(kb, alpha, Ap + ir * kb,
+                                          Bp + jr * kb, ib, jb,
+                                          C + (ic + ir) * rsC + (jc + jr) * csC,
+                                          rsC, csC);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * Selects the micro-kernel for gemm_packed() and runs the loop nest.
+     *
+     * float and double use the vectorized micro-kernel for the instruction
+     * set in simd_isa(). All other types use gemm_generic_kernel.
+     */
+    template <class T, class idx_t>
+    void gemm_packed_dispatch(idx_t m,
+                              idx_t n,
+                              idx_t k,
+                              const T& alpha,
+                              const T* A,
+                              idx_t rsA,
+                              idx_t csA,
+                              bool conjA,
+                              const T* B,
+                              idx_t rsB,
+                              idx_t csB,
+                              bool conjB,
+                              T* C,
+                              idx_t rsC,
+                              idx_t csC)
+    {
+#ifdef TLAPACK_SIMD
+        if constexpr (traits::internal::is_simd_type<T>) {
+            switch (simd_isa()) {
+    #ifdef TLAPACK_SIMD_X86
+                case SimdIsa::AVX512:
+                    return gemm_packed_loops<gemm_avx512_kernel<T>>(
+                        m, n, k, alpha, A, rsA, csA, conjA, B, rsB, csB,
+                        conjB, C, rsC, csC);
+                case SimdIsa::AVX2:
+                    return gemm_packed_loops<gemm_avx2_kernel<T>>(
+                        m, n, k, alpha, A, rsA, csA, conjA, B, rsB, csB,
+                        conjB, C, rsC, csC);
+    #endif
+                case SimdIsa::SSE2:
+                case SimdIsa::NEON:
+                    return gemm_packed_loops<gemm_vec128_kernel<T>>(
+                        m, n, k, alpha, A, rsA, csA, conjA, B, rsB, csB,
+                        conjB, C, rsC, csC);
+                default:
+                    break;
+            }
+        }
+#endif
+
+        gemm_packed_loops<gemm_generic_kernel<T>>(m, n, k, alpha, A, rsA, csA,
+                                                  conjA, B, rsB, csB, conjB, C,
+                                                  rsC, csC);
+    }
+
+    /**
+     * Packed general matrix-matrix multiply on raw pointers:
+     * \[
+     *     C := \alpha op(A) op(B) + \beta C.
+     * \]
+     *
+     * Entry (i,l) of $op(A)$ is A[i*rsA + l*csA], entry (l,j) of $op(B)$ is
+     * B[l*rsB + j*csB] and entry (i,j) of C is C[i*rsC + j*csC].
+     *
+     * Large products are split among threads by columns of C, or by rows if
+     * C has more rows than columns. See tlapack::blas3_thread_opts().
+     */
+    template <class T, class idx_t, class beta_t>
+    void gemm_packed(idx_t m,
+                     idx_t n,
+                     idx_t k,
+                     const T& alpha,
+                     const T* A,
+                     idx_t rsA,
+                     idx_t csA,
+                     bool conjA,
+                     const T* B,
+                     idx_t rsB,
+                     idx_t csB,
+                     bool conjB,
+                     const beta_t& beta,
+                     T* C,
+                     idx_t rsC,
+                     idx_t csC)
+    {
+        // Quick return
+        if (m <= 0 || n <= 0) return;
+
+        // C := beta C
+        if constexpr (is_same_v<beta_t, StrongZero>) {
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < m; ++i)
+                    C[i * rsC + j * csC] = T(0);
+        }
+        else if (beta != beta_t(1)) {
+            const T beta_ = T(beta);
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < m; ++i)
+                    C[i * rsC + j * csC] *= beta_;
+        }
+
+        if (k <= 0) return;
+
+        const int nt = blas3_num_threads((std::size_t)m * n * k);
+        if (nt > 1) {
+            // Blocks of C have a multiple of 8 rows or columns so that they
+            // align with the register tiles of all micro-kernels
+            const bool by_cols = (n >= m);
+            const idx_t len = by_cols ? n : m;
+            const idx_t units = (len + 7) / 8;
+            TLAPACK_OMP(parallel for num_threads(nt))
+            for (int t = 0; t < nt; ++t) {
+                const idx_t b0 = min<idx_t>(len, 8 * ((units * t) / nt));
+                const idx_t b1 = min<idx_t>(len, 8 * ((units * (t + 1)) / nt));
+                if (b0 >= b1) continue;
+                if (by_cols)
+                    gemm_packed_dispatch(m, b1 - b0, k, alpha, A, rsA, csA,
+                                         conjA, B + b0 * csB, rsB, csB, conjB,
+                                         C + b0 * csC, rsC, csC);
+                else
+                    gemm_packed_dispatch(b1 - b0, n, k, alpha, A + b0 * rsA,
+                                         rsA, csA, conjA, B, rsB, csB, conjB,
+                                         C + b0 * rsC, rsC, csC);
+            }
+        }
+        else
+            gemm_packed_dispatch(m, n, k, alpha, A, rsA, csA, conjA, B, rsB,
+                                 csB, conjB, C, rsC, csC);
+    }
+
+}  // namespace internal
+
+/**
+ * General matrix-matrix multiply using packed panels:
+ * \[
+ *     C := \alpha op(A) \times op(B) + \beta C,
+ * \]
+ * where $op(X)$ is one of
+ *     $op(X) = X$,
+ *     $op(X) = X^T$, or
+ *     $op(X) = X^H$,
+ * alpha and beta are scalars, and A, B, and C are matrices, with
+ * $op(A)$ an m-by-k matrix, $op(B)$ a k-by-n matrix, and C an m-by-n matrix.
+ *
+ * Blocks of $op(A)$ and $op(B)$ are copied to contiguous buffers sized for the
+ * cache hierarchy, and the product is computed by a register-tiled
+ * micro-kernel. float and double use vectorized micro-kernels selected at
+ * runtime, see tlapack::simd_isa(). The blocking parameters of the generic
+ * micro-kernel are given by tlapack::traits::gemm_blocking_trait. gemm() calls
+ * this routine automatically for large enough row- or column-major matrices of
+ * float, double, std::complex<float> or std::complex<double>.
+ *
+ * With OpenMP, large products are computed by several threads, see
+ * tlapack::blas3_thread_opts().
+ *
+ * @param[in] transA
+ *     The operation $op(A)$ to be used:
+ *     - Op::NoTrans:   $op(A) = A$.
+ *     - Op::Trans:     $op(A) = A^T$.
+ *     - Op::ConjTrans: $op(A) = A^H$.
+ *
+ * @param[in] transB
+ *     The operation $op(B)$ to be used:
+ *     - Op::NoTrans:   $op(B) = B$.
+ *     - Op::Trans:     $op(B) = B^T$.
+ *     - Op::ConjTrans: $op(B) = B^H$.
+ *
+ * @param[in] alpha Scalar.
+ * @param[in] A $op(A)$ is an m-by-k matrix.
+ * @param[in] B $op(B)$ is an k-by-n matrix.
+ * @param[in] beta Scalar.
+ * @param[in,out] C A m-by-n matrix.
+ *
+ * @ingroup blas3
+ */
+template <TLAPACK_LEGACY_MATRIX matrixA_t,
+          TLAPACK_LEGACY_MATRIX matrixB_t,
+          TLAPACK_LEGACY_MATRIX matrixC_t,
+          TLAPACK_SCALAR alpha_t,
+          TLAPACK_SCALAR beta_t>
+void gemm_packed(Op transA,
+                 Op transB,
+                 const alpha_t& alpha,
+                 const matrixA_t& A,
+                 const matrixB_t& B,
+                 const beta_t& beta,
+                 matrixC_t& C)
+{
+    using T = type_t<matrixC_t>;
+    using idx_t = size_type<matrixC_t>;
+
+    // Legacy objects
+    auto A_ = legacy_matrix(A);
+    auto B_ = legacy_matrix(B);
+    auto C_ = legacy_matrix(C);
+
+    // constants
+    const idx_t m = C_.m;
+    const idx_t n = C_.n;
+    const idx_t k = (transA == Op::NoTrans) ? A_.n : A_.m;
+
+    // check arguments
+    tlapack_check_false(transA != Op::NoTrans && transA != Op::Trans &&
+                        transA != Op::ConjTrans);
+    tlapack_check_false(transB != Op::NoTrans && transB != Op::Trans &&
+                        transB != Op::ConjTrans);
+    tlapack_check_false(((transA == Op::NoTrans) ? A_.m : A_.n) != m);
+    tlapack_check_false(((transB == Op::NoTrans) ? B_.n : B_.m) != n);
+    tlapack_check_false(((transB == Op::NoTrans) ? B_.m : B_.n) != k);
+
+    // Strides of A, B and C
+    idx_t rsA = (A_.layout == Layout::ColMajor) ? 1 : A_.ldim;
+    idx_t csA = (A_.layout == Layout::ColMajor) ? A_.ldim : 1;
+    idx_t rsB = (B_.layout == Layout::ColMajor) ? 1 : B_.ldim;
+    idx_t csB = (B_.layout == Layout::ColMajor) ? B_.ldim : 1;
+    const idx_t rsC = (C_.layout == Layout::ColMajor) ? 1 : C_.ldim;
+    const idx_t csC = (C_.layout == Layout::ColMajor) ? C_.ldim : 1;
+
+    // Strides of op(A) and op(B)
+    if (transA != Op::NoTrans) std::swap(rsA, csA);
+    if (transB != Op::NoTrans) std::swap(rsB, csB);
+
+    internal::gemm_packed(m, n, k, T(alpha), A_.ptr, rsA, csA,
+                          (transA == Op::ConjTrans), B_.ptr, rsB, csB,
+                          (transB == Op::ConjTrans), beta, C_.ptr, rsC, csC);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BLAS_GEMM_PACKED_HH
@@ -12,6 +12,7 @@
 #define TLAPACK_BLAS_GEMV_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/accumulation.hpp"
 #include "tlapack/lapack/conjugate.hpp"
 
 namespace tlapack {
@@ -236,6 +237,75 @@ void gemv(Op trans,
     return gemv(trans, alpha, A, x, StrongZero(), y);
 }
 
+/**
+ * General matrix-vector multiply:
+ * \[
+ *     y := \alpha op(A) x + \beta y,
+ * \]
+ * with each entry of $op(A) x$ accumulated with the algorithm and in the
+ * precision given by opts. See gemv() for the description of the arguments.
+ *
+ * The entries of $op(A) x$ are computed as dot products, so A is accessed by
+ * rows when trans = Op::NoTrans or Op::Conj.
+ *
+ * @param[in] opts Options. See AccumulationOpts.
+ *
+ * @ingroup blas2
+ */
+template <TLAPACK_MATRIX matrixA_t,
+          TLAPACK_VECTOR vectorX_t,
+          TLAPACK_VECTOR vectorY_t,
+          TLAPACK_SCALAR alpha_t,
+          TLAPACK_SCALAR beta_t,
+          class accum_t>
+void gemv(Op trans,
+          const alpha_t& alpha,
+          const matrixA_t& A,
+          const vectorX_t& x,
+          const beta_t& beta,
+          vectorY_t& y,
+          const AccumulationOpts<accum_t>& opts)
+{
+    // data traits
+    using TA = type_t<matrixA_t>;
+    using TX = type_t<vectorX_t>;
+    using TY = type_t<vectorY_t>;
+    using sum_t = accumulator_type<accum_t, TA, TX>;
+    using out_t = scalar_type<alpha_t, sum_t>;
+    using idx_t = size_type<matrixA_t>;
+
+    // constants
+    const idx_t m =
+        (trans == Op::NoTrans || trans == Op::Conj) ? nrows(A) : ncols(A);
+    const idx_t n =
+        (trans == Op::NoTrans || trans == Op::Conj) ? ncols(A) : nrows(A);
+
+    // check arguments
+    tlapack_check_false(trans != Op::NoTrans && trans != Op::Trans &&
+                        trans != Op::ConjTrans && trans != Op::Conj);
+    tlapack_check_false((idx_t)size(x) != n);
+    tlapack_check_false((idx_t)size(y) != m);
+
+    // quick return
+    if (m == 0) return;
+
+    for (idx_t i = 0; i < m; ++i) {
+        const sum_t s = internal::accumulate<sum_t>(
+            n,
+            [&](idx_t j) {
+                const sum_t aij =
+                    (trans == Op::NoTrans) ? sum_t(A(i, j))
+                    : (trans == Op::Conj)  ? conj(sum_t(A(i, j)))
+                    : (trans == Op::Trans) ? sum_t(A(j, i))
+                                           : conj(sum_t(A(j, i)));
+                return aij * sum_t(x[j]);
+            },
+            opts);
+        y[i] *= beta;
+        y[i] += TY(out_t(alpha) * out_t(s));
+    }
+}
+
 }  // namespace tlapack
 
 #endif  //  #ifndef TLAPACK_BLAS_GEMV_HH
@@ -11,6 +11,7 @@
 #ifndef TLAPACK_BLAS_HER2K_HH
 #define TLAPACK_BLAS_HER2K_HH
 
+#include "tlapack/base/threads.hpp"
 #include "tlapack/base/utils.hpp"
 
 namespace tlapack {
@@ -52,6 +53,9 @@ namespace tlapack {
  *     Imaginary parts of the diagonal elements need not be set,
  *     are assumed to be zero on entry, and are set to zero on exit.
  *
+ * @note With OpenMP, large updates split the columns of C among threads, see
+ * tlapack::blas3_thread_opts().
+ *
  * @ingroup blas3
  */
 template <TLAPACK_MATRIX matrixA_t,
@@ -95,9 +99,15 @@ void her2k(Uplo uplo,
     tlapack_check_false(nrows(C) != ncols(C));
     tlapack_check_false(nrows(C) != n);
 
+    // Columns of C are computed in parallel for large problems
+    [[maybe_unused]] const int nt =
+        internal::blas3_num_threads((std::size_t)2 * n * n * k);
+
     if (trans == Op::NoTrans) {
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
+            TLAPACK_OMP(parallel for schedule(dynamic, 8)
+                            num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = 0; i < j; ++i)
                     C(i, j) *= beta;
@@ -118,6 +128,8 @@ void her2k(Uplo uplo,
             }
         }
         else {  // uplo == Uplo::Lower
+            TLAPACK_OMP(parallel for schedule(dynamic, 8)
+                            num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 C(j, j) = TC(beta * real(C(j, j)));
                 for (idx_t i = j + 1; i < n; ++i)
@@ -143,6 +155,8 @@ void her2k(Uplo uplo,
 
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
+            TLAPACK_OMP(parallel for schedule(dynamic, 8)
+                            num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = 0; i <= j; ++i) {
                     scalar_t sum1(0);
@@ -163,6 +177,8 @@ void her2k(Uplo uplo,
             }
         }
         else {  // uplo == Uplo::Lower
+            TLAPACK_OMP(parallel for schedule(dynamic, 8)
+                            num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = j; i < n; ++i) {
                     scalar_t sum1(0);
@@ -11,6 +11,7 @@
 #ifndef TLAPACK_BLAS_HERK_HH
 #define TLAPACK_BLAS_HERK_HH
 
+#include "tlapack/base/threads.hpp"
 #include "tlapack/base/utils.hpp"
 
 namespace tlapack {
@@ -50,6 +51,9 @@ namespace tlapack {
  *     Imaginary parts of the diagonal elements need not be set,
  *     are assumed to be zero on entry, and are set to zero on exit.
  *
+ * @note With OpenMP, large updates split the columns of C among threads, see
+ * tlapack::blas3_thread_opts().
+ *
  * @ingroup blas3
  */
 template <TLAPACK_MATRIX matrixA_t,
@@ -88,9 +92,15 @@ void herk(Uplo uplo,
     tlapack_check_false(nrows(C) != ncols(C));
     tlapack_check_false(nrows(C) != n);
 
+    // Columns of C are computed in parallel for large problems
+    [[maybe_unused]] const int nt =
+        internal::blas3_num_threads((std::size_t)n * n * k);
+
     if (trans == Op::NoTrans) {
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
+            TLAPACK_OMP(parallel for schedule(dynamic, 8)
+                            num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = 0; i < j; ++i)
                     C(i, j) *= beta;
@@ -108,6 +118,8 @@ void herk(Uplo uplo,
             }
         }
         else {  // uplo == Uplo::Lower
+            TLAPACK_OMP(parallel for schedule(dynamic, 8)
+                            num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 C(j, j) = TC(beta * real(C(j, j)));
                 for (idx_t i = j + 1; i < n; ++i)
@@ -128,6 +140,8 @@ void herk(Uplo uplo,
     else {  // trans == Op::ConjTrans
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
+            TLAPACK_OMP(parallel for schedule(dynamic, 8)
+                            num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = 0; i < j; ++i) {
                     TA sum(0);
@@ -143,6 +157,8 @@ void herk(Uplo uplo,
             }
         }
         else {  // uplo == Uplo::Lower
+            TLAPACK_OMP(parallel for schedule(dynamic, 8)
+                            num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = j + 1; i < n; ++i) {
                     TA sum(0);
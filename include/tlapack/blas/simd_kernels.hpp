@@ -0,0 +1,841 @@
+/// @file simd_kernels.hpp Vectorized kernels for float and double selected at
+/// runtime according to tlapack::simd_isa().
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BLAS_SIMD_KERNELS_HH
+#define TLAPACK_BLAS_SIMD_KERNELS_HH
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include "tlapack/base/simd.hpp"
+#include "tlapack/base/utils.hpp"
+
+#ifdef TLAPACK_SIMD
+    #define TLAPACK_SIMD_INLINE [[gnu::always_inline]] inline
+#endif
+
+// The transpose kernels shuffle the lanes of vector registers
+#if defined(TLAPACK_SIMD) && defined(__has_builtin)
+    #if __has_builtin(__builtin_shufflevector)
+        #define TLAPACK_SIMD_SHUFFLE
+    #endif
+#endif
+
+#ifdef TLAPACK_SIMD_X86
+    #define TLAPACK_TARGET_AVX2 __attribute__((target("avx2,fma")))
+    #define TLAPACK_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+namespace tlapack {
+
+namespace traits {
+    namespace internal {
+        /// True if T has vectorized kernels.
+        template <class T>
+        constexpr bool is_simd_type = is_same_v<T, float> ||
+                                      is_same_v<T, double>;
+
+        /// True if vector_t is a vector of T that can be converted to a legacy
+        /// vector.
+        template <class vector_t, class T>
+        constexpr bool is_simd_vector = is_simd_type<T> &&
+                                        has_legacy_vector<vector_t>::value &&
+                                        is_same_v<type_t<vector_t>, T>;
+
+        /// True if T has vectorized transpose kernels.
+        template <class T>
+        constexpr bool is_simd_transpose_type =
+            is_same_v<T, float> || is_same_v<T, double> ||
+            is_same_v<T, std::complex<float>> ||
+            is_same_v<T, std::complex<double>>;
+
+        /// True if matrixA_t and matrixB_t are matrices of T with the same
+        /// row- or column-major layout that can be converted to legacy
+        /// matrices.
+        template <class matrixA_t, class matrixB_t, class T>
+        constexpr bool is_simd_transpose_pair =
+            is_simd_transpose_type<T> && has_legacy_matrix<matrixA_t>::value &&
+            has_legacy_matrix<matrixB_t>::value &&
+            is_same_v<type_t<matrixA_t>, T> &&
+            is_same_v<type_t<matrixB_t>, T> &&
+            (layout<matrixA_t> == Layout::ColMajor ||
+             layout<matrixA_t> == Layout::RowMajor) &&
+            layout<matrixA_t> == layout<matrixB_t>;
+    }  // namespace internal
+}  // namespace traits
+
+namespace internal {
+
+#ifdef TLAPACK_SIMD
+
+    // -------------------------------------------------------------------------
+    // Kernels written with GCC vector extensions. W is the vector width in
+    // bytes. The kernels are always inlined in the functions below, which are
+    // compiled for a given instruction set.
+
+    /// y := alpha x + y on contiguous arrays.
+    template <class T, int W>
+    TLAPACK_SIMD_INLINE void axpy_vec(std::size_t n,
+                                      T alpha,
+                                      const T* x,
+                                      T* y)
+    {
+        typedef T V __attribute__((vector_size(W)));
+        constexpr std::size_t vl = W / sizeof(T);
+
+        std::size_t i = 0;
+        for (; i + 2 * vl <= n; i += 2 * vl) {
+            V x0, x1, y0, y1;
+            std::memcpy(&x0, x + i, W);
+            std::memcpy(&x1, x + i + vl, W);
+            std::memcpy(&y0, y + i, W);
+            std::memcpy(&y1, y + i + vl, W);
+            y0 += alpha * x0;
+            y1 += alpha * x1;
+            std::memcpy(y + i, &y0, W);
+            std::memcpy(y + i + vl, &y1, W);
+        }
+        for (; i < n; ++i)
+            y[i] += alpha * x[i];
+    }
+
+    /// Returns x^T y on contiguous arrays.
+    template <class T, int W>
+    TLAPACK_SIMD_INLINE T dot_vec(std::size_t n, const T* x, const T* y)
+    {
+        typedef T V __attribute__((vector_size(W)));
+        constexpr std::size_t vl = W / sizeof(T);
+
+        // Four independent accumulators hide the latency of the additions
+        V s0 = {}, s1 = {}, s2 = {}, s3 = {};
+        std::size_t i = 0;
+        for (; i + 4 * vl <= n; i += 4 * vl) {
+            V x0, x1, x2, x3, y0, y1, y2, y3;
+            std::memcpy(&x0, x + i, W);
+            std::memcpy(&x1, x + i + vl, W);
+            std::memcpy(&x2, x + i + 2 * vl, W);
+            std::memcpy(&x3, x + i + 3 * vl, W);
+            std::memcpy(&y0, y + i, W);
+            std::memcpy(&y1, y + i + vl, W);
+            std::memcpy(&y2, y + i + 2 * vl, W);
+            std::memcpy(&y3, y + i + 3 * vl, W);
+            s0 += x0 * y0;
+            s1 += x1 * y1;
+            s2 += x2 * y2;
+            s3 += x3 * y3;
+        }
+        for (; i + vl <= n; i += vl) {
+            V x0, y0;
+            std::memcpy(&x0, x + i, W);
+            std::memcpy(&y0, y + i, W);
+            s0 += x0 * y0;
+        }
+        s0 += s1 + s2 + s3;
+
+        T result(0);
+        for (std::size_t j = 0; j < vl; ++j)
+            result += s0[j];
+        for (; i < n; ++i)
+            result += x[i] * y[i];
+
+        return result;
+    }
+
+    /// Applies the rotation [c s; -s c] to the contiguous arrays x and y.
+    template <class T, int W>
+    TLAPACK_SIMD_INLINE void rot_vec(std::size_t n, T* x, T* y, T c, T s)
+    {
+        typedef T V __attribute__((vector_size(W)));
+        constexpr std::size_t vl = W / sizeof(T);
+
+        std::size_t i = 0;
+        for (; i + vl <= n; i += vl) {
+            V x0, y0;
+            std::memcpy(&x0, x + i, W);
+            std::memcpy(&y0, y + i, W);
+            const V t = c * x0 + s * y0;
+            y0 = c * y0 - s * x0;
+            std::memcpy(x + i, &t, W);
+            std::memcpy(y + i, &y0, W);
+        }
+        for (; i < n; ++i) {
+            const T t = c * x[i] + s * y[i];
+            y[i] = c * y[i] - s * x[i];
+            x[i] = t;
+        }
+    }
+
+    /**
+     * Applies four fused rotations to the contiguous arrays x0, x1, x2, x3.
+     *
+     * Each rotation [c s; -s c] acts on a pair (x,y) as x := c x + s y and
+     * y := -s x + c y. The rotations are, in order:
+     * (c[0],s[0]) on (x1,x2), (c[1],s[1]) on (x0,x1), (c[2],s[2]) on (x2,x3)
+     * and (c[3],s[3]) on (x1,x2). Each entry is loaded and stored only once.
+     */
+    template <class T, int W>
+    TLAPACK_SIMD_INLINE void rot4_vec(std::size_t n,
+                                      T* x0,
+                                      T* x1,
+                                      T* x2,
+                                      T* x3,
+                                      const T* c,
+                                      const T* s)
+    {
+        typedef T V __attribute__((vector_size(W)));
+        constexpr std::size_t vl = W / sizeof(T);
+
+        std::size_t i = 0;
+        for (; i + vl <= n; i += vl) {
+            V a0, a1, a2, a3;
+            std::memcpy(&a0, x0 + i, W);
+            std::memcpy(&a1, x1 + i, W);
+            std::memcpy(&a2, x2 + i, W);
+            std::memcpy(&a3, x3 + i, W);
+
+            V t = c[0] * a1 + s[0] * a2;
+            a2 = c[0] * a2 - s[0] * a1;
+            a1 = t;
+
+            t = c[1] * a0 + s[1] * a1;
+            a1 = c[1] * a1 - s[1] * a0;
+            a0 = t;
+
+            t = c[2] * a2 + s[2] * a3;
+            a3 = c[2] * a3 - s[2] * a2;
+            a2 = t;
+
+            t = c[3] * a1 + s[3] * a2;
+            a2 = c[3] * a2 - s[3] * a1;
+            a1 = t;
+
+            std::memcpy(x0 + i, &a0, W);
+            std::memcpy(x1 + i, &a1, W);
+            std::memcpy(x2 + i, &a2, W);
+            std::memcpy(x3 + i, &a3, W);
+        }
+        for (; i < n; ++i) {
+            T a0 = x0[i], a1 = x1[i], a2 = x2[i], a3 = x3[i];
+
+            T t = c[0] * a1 + s[0] * a2;
+            a2 = c[0] * a2 - s[0] * a1;
+            a1 = t;
+
+            t = c[1] * a0 + s[1] * a1;
+            a1 = c[1] * a1 - s[1] * a0;
+            a0 = t;
+
+            t = c[2] * a2 + s[2] * a3;
+            a3 = c[2] * a3 - s[2] * a2;
+            a2 = t;
+
+            t = c[3] * a1 + s[3] * a2;
+            a2 = c[3] * a2 - s[3] * a1;
+            a1 = t;
+
+            x0[i] = a0;
+            x1[i] = a1;
+            x2[i] = a2;
+            x3[i] = a3;
+        }
+    }
+
+    /**
+     * Micro-kernel of gemm_packed() with two vectors per column of the
+     * register tile, i.e., mr = 2*W/sizeof(T).
+     *
+     * Computes C := C + alpha Ap Bp, where Ap is a packed mr-by-kb
+     * micro-panel, Bp is a packed kb-by-nr micro-panel and C is the leading
+     * ib-by-jb part of an mr-by-nr tile with entry (i,j) at C[i*rsC + j*csC].
+     */
+    template <class T, int W, int nr, class idx_t>
+    TLAPACK_SIMD_INLINE void gemm_kernel_vec(idx_t kb,
+                                             const T& alpha,
+                                             const T* Ap,
+                                             const T* Bp,
+                                             idx_t ib,
+                                             idx_t jb,
+                                             T* C,
+                                             idx_t rsC,
+                                             idx_t csC)
+    {
+        typedef T V __attribute__((vector_size(W)));
+        constexpr int vl = W / sizeof(T);
+        constexpr int mr = 2 * vl;
+
+        V ab0[nr] = {};
+        V ab1[nr] = {};
+        for (idx_t l = 0; l < kb; ++l) {
+            V a0, a1;
+            std::memcpy(&a0, Ap, W);
+            std::memcpy(&a1, Ap + vl, W);
+    #pragma GCC unroll 16
+            for (int j = 0; j < nr; ++j) {
+                const T b = Bp[j];
+                ab0[j] += a0 * b;
+                ab1[j] += a1 * b;
+            }
+            Ap += mr;
+            Bp += nr;
+        }
+
+        if (rsC == 1 && ib == mr) {
+            for (idx_t j = 0; j < jb; ++j) {
+                V c0, c1;
+                std::memcpy(&c0, C + j * csC, W);
+                std::memcpy(&c1, C + j * csC + vl, W);
+                c0 += alpha * ab0[j];
+                c1 += alpha * ab1[j];
+                std::memcpy(C + j * csC, &c0, W);
+                std::memcpy(C + j * csC + vl, &c1, W);
+            }
+        }
+        else {
+            for (idx_t j = 0; j < jb; ++j)
+                for (idx_t i = 0; i < ib; ++i)
+                    C[i * rsC + j * csC] +=
+                        alpha * ((i < vl) ? ab0[j][i] : ab1[j][i - vl]);
+        }
+    }
+
+    #ifdef TLAPACK_SIMD_X86
+
+    template <class T>
+    TLAPACK_TARGET_AVX2 void axpy_avx2(std::size_t n,
+                                       T alpha,
+                                       const T* x,
+                                       T* y)
+    {
+        axpy_vec<T, 32>(n, alpha, x, y);
+    }
+    template <class T>
+    TLAPACK_TARGET_AVX512 void axpy_avx512(std::size_t n,
+                                           T alpha,
+                                           const T* x,
+                                           T* y)
+    {
+        axpy_vec<T, 64>(n, alpha, x, y);
+    }
+
+    template <class T>
+    TLAPACK_TARGET_AVX2 T dot_avx2(std::size_t n, const T* x, const T* y)
+    {
+        return dot_vec<T, 32>(n, x, y);
+    }
+    template <class T>
+    TLAPACK_TARGET_AVX512 T dot_avx512(std::size_t n, const T* x, const T* y)
+    {
+        return dot_vec<T, 64>(n, x, y);
+    }
+
+    template <class T>
+    TLAPACK_TARGET_AVX2 void rot_avx2(std::size_t n, T* x, T* y, T c, T s)
+    {
+        rot_vec<T, 32>(n, x, y, c, s);
+    }
+    template <class T>
+    TLAPACK_TARGET_AVX512 void rot_avx512(std::size_t n, T* x, T* y, T c, T s)
+    {
+        rot_vec<T, 64>(n, x, y, c, s);
+    }
+
+    template <class T>
+    TLAPACK_TARGET_AVX2 void rot4_avx2(std::size_t n,
+                                       T* x0,
+                                       T* x1,
+                                       T* x2,
+                                       T* x3,
+                                       const T* c,
+                                       const T* s)
+    {
+        rot4_vec<T, 32>(n, x0, x1, x2, x3, c, s);
+    }
+    template <class T>
+    TLAPACK_TARGET_AVX512 void rot4_avx512(std::size_t n,
+                                           T* x0,
+                                           T* x1,
+                                           T* x2,
+                                           T* x3,
+                                           const T* c,
+                                           const T* s)
+    {
+        rot4_vec<T, 64>(n, x0, x1, x2, x3, c, s);
+    }
+
+    #endif  // TLAPACK_SIMD_X86
+
+    #ifdef TLAPACK_SIMD_SHUFFLE
+
+    /**
+     * Lane j of one of the shuffles in transpose_tile_vec().
+     *
+     * The shuffle merges vectors a and b, whose lanes are numbered [0, vl)
+     * and [vl, 2 vl), in chunks of h lanes. The low output takes the even
+     * chunks of a and b, and the high output takes the odd chunks.
+     */
+    template <int vl, int h, bool high>
+    constexpr int transpose_lane(int j)
+    {
+        const int b = j / (2 * h) * (2 * h);
+        const int o = j % (2 * h);
+        if (high)
+            return (o < h) ? b + h + o : vl + b + o;
+        else
+            return (o < h) ? b + o : vl + b + o - h;
+    }
+
+    template <int h, bool high, class V, std::size_t... J>
+    TLAPACK_SIMD_INLINE void transpose_shuffle(const V& a,
+                                               const V& b,
+                                               V& c,
+                                               std::index_sequence<J...>)
+    {
+        c = __builtin_shufflevector(
+            a, b, transpose_lane<sizeof...(J), h, high>(J)...);
+    }
+
+    /// Stages h, h/2, ..., 1 of the transposition of the tile in r. Each
+    /// entry of the tile has E lanes of the vl lanes of a vector.
+    template <int h, int E, int vl, class V>
+    TLAPACK_SIMD_INLINE void transpose_stages(V* r)
+    {
+        if constexpr (h >= 1) {
+            constexpr int R = vl / E;
+        #pragma GCC unroll 16
+            for (int i = 0; i < R; ++i) {
+                if ((i & h) == 0) {
+                    V lo, hi;
+                    transpose_shuffle<h * E, false>(
+                        r[i], r[i + h], lo, std::make_index_sequence<vl>{});
+                    transpose_shuffle<h * E, true>(
+                        r[i], r[i + h], hi, std::make_index_sequence<vl>{});
+                    r[i] = lo;
+                    r[i + h] = hi;
+                }
+            }
+            transpose_stages<h / 2, E, vl>(r);
+        }
+    }
+
+    /// Unsigned integer type used to move the entries of T in the transpose
+    /// kernels. std::complex<double> takes two lanes.
+    template <class T>
+    using transpose_lane_t =
+        std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+
+    /**
+     * Loads the R-by-R tile at A, with leading dimension lda, into r and
+     * transposes it in registers, where R = W / sizeof(T).
+     */
+    template <class T, int W, class V>
+    TLAPACK_SIMD_INLINE void transpose_tile_load(const T* A,
+                                                 std::size_t lda,
+                                                 V* r)
+    {
+        using U = transpose_lane_t<T>;
+        constexpr int vl = W / sizeof(U);
+        constexpr int E = sizeof(T) / sizeof(U);
+        constexpr int R = vl / E;
+
+        #pragma GCC unroll 16
+        for (int j = 0; j < R; ++j)
+            std::memcpy(&r[j], A + j * lda, W);
+        transpose_stages<R / 2, E, vl>(r);
+    }
+
+    /**
+     * B[j + i*ldb] := A[i + j*lda] for 0 <= i < m, 0 <= j < n.
+     *
+     * Full R-by-R tiles, R = W / sizeof(T), are transposed in registers. If A
+     * and B are the same R-by-R tile, the tile is transposed in place.
+     */
+    template <class T, int W>
+    TLAPACK_SIMD_INLINE void transpose_vec(std::size_t m,
+                                           std::size_t n,
+                                           const T* A,
+                                           std::size_t lda,
+                                           T* B,
+                                           std::size_t ldb)
+    {
+        using U = transpose_lane_t<T>;
+        typedef U V __attribute__((vector_size(W)));
+        constexpr std::size_t R = W / sizeof(T);
+
+        const std::size_t mR = m - m % R;
+        const std::size_t nR = n - n % R;
+
+        for (std::size_t j = 0; j < nR; j += R) {
+            for (std::size_t i = 0; i < mR; i += R) {
+                V r[R];
+                transpose_tile_load<T, W>(A + i + j * lda, lda, r);
+        #pragma GCC unroll 16
+                for (std::size_t l = 0; l < R; ++l)
+                    std::memcpy((void*)(B + j + (i + l) * ldb), &r[l], W);
+            }
+            for (std::size_t i = mR; i < m; ++i)
+                for (std::size_t l = j; l < j + R; ++l)
+                    B[l + i * ldb] = A[i + l * lda];
+        }
+        for (std::size_t j = nR; j < n; ++j)
+            for (std::size_t i = 0; i < m; ++i)
+                B[j + i * ldb] = A[i + j * lda];
+    }
+
+    /**
+     * Swaps A[i + j*lda] and B[j + i*ldb] for 0 <= i < m, 0 <= j < n, i.e.,
+     * the m-by-n matrix A with the transpose of the n-by-m matrix B. A and B
+     * must not overlap.
+     */
+    template <class T, int W>
+    TLAPACK_SIMD_INLINE void transpose_swap_vec(std::size_t m,
+                                                std::size_t n,
+                                                T* A,
+                                                std::size_t lda,
+                                                T* B,
+                                                std::size_t ldb)
+    {
+        using U = transpose_lane_t<T>;
+        typedef U V __attribute__((vector_size(W)));
+        constexpr std::size_t R = W / sizeof(T);
+
+        const std::size_t mR = m - m % R;
+        const std::size_t nR = n - n % R;
+
+        for (std::size_t j = 0; j < nR; j += R) {
+            for (std::size_t i = 0; i < mR; i += R) {
+                V a[R], b[R];
+                transpose_tile_load<T, W>(A + i + j * lda, lda, a);
+                transpose_tile_load<T, W>(B + j + i * ldb, ldb, b);
+        #pragma GCC unroll 16
+                for (std::size_t l = 0; l < R; ++l) {
+                    std::memcpy((void*)(B + j + (i + l) * ldb), &a[l], W);
+                    std::memcpy((void*)(A + i + (j + l) * lda), &b[l], W);
+                }
+            }
+            for (std::size_t i = mR; i < m; ++i)
+                for (std::size_t l = j; l < j + R; ++l)
+                    std::swap(A[i + l * lda], B[l + i * ldb]);
+        }
+        for (std::size_t j = nR; j < n; ++j)
+            for (std::size_t i = 0; i < m; ++i)
+                std::swap(A[i + j * lda], B[j + i * ldb]);
+    }
+
+    /// Transposes the n-by-n matrix A in place.
+    template <class T, int W>
+    TLAPACK_SIMD_INLINE void transpose_inplace_vec(std::size_t n,
+                                                   T* A,
+                                                   std::size_t lda)
+    {
+        constexpr std::size_t R = W / sizeof(T);
+
+        const std::size_t nR = n - n % R;
+
+        for (std::size_t j = 0; j < nR; j += R) {
+            // Diagonal tile and the tiles below it
+            transpose_vec<T, W>(R, R, A + j + j * lda, lda, A + j + j * lda,
+                                lda);
+            transpose_swap_vec<T, W>(n - j - R, R, A + j + R + j * lda, lda,
+                                     A + j + (j + R) * lda, lda);
+        }
+        for (std::size_t j = nR; j < n; ++j)
+            for (std::size_t i = j + 1; i < n; ++i)
+                std::swap(A[i + j * lda], A[j + i * lda]);
+    }
+
+        #ifdef TLAPACK_SIMD_X86
+
+    template <class T>
+    TLAPACK_TARGET_AVX2 void transpose_avx2(std::size_t m,
+                                            std::size_t n,
+                                            const T* A,
+                                            std::size_t lda,
+                                            T* B,
+                                            std::size_t ldb)
+    {
+        transpose_vec<T, 32>(m, n, A, lda, B, ldb);
+    }
+    template <class T>
+    TLAPACK_TARGET_AVX512 void transpose_avx512(std::size_t m,
+                                                std::size_t n,
+                                                const T* A,
+                                                std::size_t lda,
+                                                T* B,
+                                                std::size_t ldb)
+    {
+        transpose_vec<T, 64>(m, n, A, lda, B, ldb);
+    }
+
+    template <class T>
+    TLAPACK_TARGET_AVX2 void transpose_swap_avx2(std::size_t m,
+                                                 std::size_t n,
+                                                 T* A,
+                                                 std::size_t lda,
+                                                 T* B,
+                                                 std::size_t ldb)
+    {
+        transpose_swap_vec<T, 32>(m, n, A, lda, B, ldb);
+    }
+    template <class T>
+    TLAPACK_TARGET_AVX512 void transpose_swap_avx512(std::size_t m,
+                                                     std::size_t n,
+                                                     T* A,
+                                                     std::size_t lda,
+                                                     T* B,
+                                                     std::size_t ldb)
+    {
+        transpose_swap_vec<T, 64>(m, n, A, lda, B, ldb);
+    }
+
+    template <class T>
+    TLAPACK_TARGET_AVX2 void transpose_inplace_avx2(std::size_t n,
+                                                    T* A,
+                                                    std::size_t lda)
+    {
+        transpose_inplace_vec<T, 32>(n, A, lda);
+    }
+    template <class T>
+    TLAPACK_TARGET_AVX512 void transpose_inplace_avx512(std::size_t n,
+                                                        T* A,
+                                                        std::size_t lda)
+    {
+        transpose_inplace_vec<T, 64>(n, A, lda);
+    }
+
+        #endif  // TLAPACK_SIMD_X86
+
+    #endif  // TLAPACK_SIMD_SHUFFLE
+
+#endif  // TLAPACK_SIMD
+
+    // -------------------------------------------------------------------------
+    // Dispatchers. Each one runs the kernel for the instruction set given by
+    // simd_isa(), or a plain loop for SimdIsa::Generic.
+
+    /// y := alpha x + y on contiguous arrays.
+    template <class T>
+    void simd_axpy(std::size_t n, T alpha, const T* x, T* y)
+    {
+        switch (simd_isa()) {
+#ifdef TLAPACK_SIMD_X86
+            case SimdIsa::AVX512:
+                return axpy_avx512(n, alpha, x, y);
+            case SimdIsa::AVX2:
+                return axpy_avx2(n, alpha, x, y);
+#endif
+#ifdef TLAPACK_SIMD
+            case SimdIsa::SSE2:
+            case SimdIsa::NEON:
+                return axpy_vec<T, 16>(n, alpha, x, y);
+#endif
+            default:
+                for (std::size_t i = 0; i < n; ++i)
+                    y[i] += alpha * x[i];
+        }
+    }
+
+    /// Returns x^T y on contiguous arrays.
+    template <class T>
+    T simd_dot(std::size_t n, const T* x, const T* y)
+    {
+        switch (simd_isa()) {
+#ifdef TLAPACK_SIMD_X86
+            case SimdIsa::AVX512:
+                return dot_avx512(n, x, y);
+            case SimdIsa::AVX2:
+                return dot_avx2(n, x, y);
+#endif
+#ifdef TLAPACK_SIMD
+            case SimdIsa::SSE2:
+            case SimdIsa::NEON:
+                return dot_vec<T, 16>(n, x, y);
+#endif
+            default: {
+                T result(0);
+                for (std::size_t i = 0; i < n; ++i)
+                    result += x[i] * y[i];
+                return result;
+            }
+        }
+    }
+
+    /// Applies the rotation [c s; -s c] to the contiguous arrays x and y.
+    template <class T>
+    void simd_rot(std::size_t n, T* x, T* y, T c, T s)
+    {
+        switch (simd_isa()) {
+#ifdef TLAPACK_SIMD_X86
+            case SimdIsa::AVX512:
+                return rot_avx512(n, x, y, c, s);
+            case SimdIsa::AVX2:
+                return rot_avx2(n, x, y, c, s);
+#endif
+#ifdef TLAPACK_SIMD
+            case SimdIsa::SSE2:
+            case SimdIsa::NEON:
+                return rot_vec<T, 16>(n, x, y, c, s);
+#endif
+            default:
+                for (std::size_t i = 0; i < n; ++i) {
+                    const T t = c * x[i] + s * y[i];
+                    y[i] = c * y[i] - s * x[i];
+                    x[i] = t;
+                }
+        }
+    }
+
+    /// Applies four fused rotations to contiguous arrays.
+    /// @see rot4_vec for the order of the rotations.
+    template <class T>
+    void simd_rot4(std::size_t n,
+                   T* x0,
+                   T* x1,
+                   T* x2,
+                   T* x3,
+                   const T* c,
+                   const T* s)
+    {
+        switch (simd_isa()) {
+#ifdef TLAPACK_SIMD_X86
+            case SimdIsa::AVX512:
+                return rot4_avx512(n, x0, x1, x2, x3, c, s);
+            case SimdIsa::AVX2:
+                return rot4_avx2(n, x0, x1, x2, x3, c, s);
+#endif
+#ifdef TLAPACK_SIMD
+            case SimdIsa::SSE2:
+            case SimdIsa::NEON:
+                return rot4_vec<T, 16>(n, x0, x1, x2, x3, c, s);
+#endif
+            default:
+                simd_rot(n, x1, x2, c[0], s[0]);
+                simd_rot(n, x0, x1, c[1], s[1]);
+                simd_rot(n, x2, x3, c[2], s[2]);
+                simd_rot(n, x1, x2, c[3], s[3]);
+        }
+    }
+
+    /// True if A, B and the leading dimensions are multiples of W bytes, so
+    /// that no row of a W-byte tile straddles two cache lines.
+    template <class T>
+    bool transpose_aligned(std::size_t W,
+                           const T* A,
+                           std::size_t lda,
+                           const T* B,
+                           std::size_t ldb)
+    {
+        return ((reinterpret_cast<std::uintptr_t>(A) |
+                 reinterpret_cast<std::uintptr_t>(B) | (lda * sizeof(T)) |
+                 (ldb * sizeof(T))) %
+                W) == 0;
+    }
+
+    /**
+     * B[j + i*ldb] := A[i + j*lda] for 0 <= i < m, 0 <= j < n.
+     *
+     * The transposition is memory bound, and wide tiles whose rows straddle
+     * cache lines are slower than narrow ones. The AVX2 and AVX-512 kernels
+     * are only used if the data is aligned to the vector width.
+     */
+    template <class T>
+    void simd_transpose(std::size_t m,
+                        std::size_t n,
+                        const T* A,
+                        std::size_t lda,
+                        T* B,
+                        std::size_t ldb)
+    {
+        switch (simd_isa()) {
+#ifdef TLAPACK_SIMD_SHUFFLE
+    #ifdef TLAPACK_SIMD_X86
+            case SimdIsa::AVX512:
+                if (transpose_aligned(64, A, lda, B, ldb))
+                    return transpose_avx512(m, n, A, lda, B, ldb);
+                [[fallthrough]];
+            case SimdIsa::AVX2:
+                if (transpose_aligned(32, A, lda, B, ldb))
+                    return transpose_avx2(m, n, A, lda, B, ldb);
+                [[fallthrough]];
+    #endif
+            case SimdIsa::SSE2:
+            case SimdIsa::NEON:
+                return transpose_vec<T, 16>(m, n, A, lda, B, ldb);
+#endif
+            default:
+                for (std::size_t j = 0; j < n; ++j)
+                    for (std::size_t i = 0; i < m; ++i)
+                        B[j + i * ldb] = A[i + j * lda];
+        }
+    }
+
+    /// Swaps A[i + j*lda] and B[j + i*ldb] for 0 <= i < m, 0 <= j < n.
+    template <class T>
+    void simd_transpose_swap(std::size_t m,
+                             std::size_t n,
+                             T* A,
+                             std::size_t lda,
+                             T* B,
+                             std::size_t ldb)
+    {
+        switch (simd_isa()) {
+#ifdef TLAPACK_SIMD_SHUFFLE
+    #ifdef TLAPACK_SIMD_X86
+            case SimdIsa::AVX512:
+                if (transpose_aligned(64, A, lda, B, ldb))
+                    return transpose_swap_avx512(m, n, A, lda, B, ldb);
+                [[fallthrough]];
+            case SimdIsa::AVX2:
+                if (transpose_aligned(32, A, lda, B, ldb))
+                    return transpose_swap_avx2(m, n, A, lda, B, ldb);
+                [[fallthrough]];
+    #endif
+            case SimdIsa::SSE2:
+            case SimdIsa::NEON:
+                return transpose_swap_vec<T, 16>(m, n, A, lda, B, ldb);
+#endif
+            default:
+                for (std::size_t j = 0; j < n; ++j)
+                    for (std::size_t i = 0; i < m; ++i)
+                        std::swap(A[i + j * lda], B[j + i * ldb]);
+        }
+    }
+
+    /// Transposes the n-by-n matrix A in place.
+    template <class T>
+    void simd_transpose_inplace(std::size_t n, T* A, std::size_t lda)
+    {
+        switch (simd_isa()) {
+#ifdef TLAPACK_SIMD_SHUFFLE
+    #ifdef TLAPACK_SIMD_X86
+            case SimdIsa::AVX512:
+                if (transpose_aligned(64, A, lda, A, lda))
+                    return transpose_inplace_avx512(n, A, lda);
+                [[fallthrough]];
+            case SimdIsa::AVX2:
+                if (transpose_aligned(32, A, lda, A, lda))
+                    return transpose_inplace_avx2(n, A, lda);
+                [[fallthrough]];
+    #endif
+            case SimdIsa::SSE2:
+            case SimdIsa::NEON:
+                return transpose_inplace_vec<T, 16>(n, A, lda);
+#endif
+            default:
+                for (std::size_t j = 0; j < n; ++j)
+                    for (std::size_t i = j + 1; i < n; ++i)
+                        std::swap(A[i + j * lda], A[j + i * lda]);
+        }
+    }
+
+}  // namespace internal
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BLAS_SIMD_KERNELS_HH
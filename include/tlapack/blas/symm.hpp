@@ -11,6 +11,7 @@
 #ifndef TLAPACK_BLAS_SYMM_HH
 #define TLAPACK_BLAS_SYMM_HH
 
+#include "tlapack/base/threads.hpp"
 #include "tlapack/base/utils.hpp"
 
 namespace tlapack {
@@ -45,6 +46,9 @@ namespace tlapack {
  * @param[in] beta Scalar.
  * @param[in,out] C A m-by-n matrix.
  *
+ * @note With OpenMP, large products split the columns of C among threads, see
+ * tlapack::blas3_thread_opts().
+ *
  * @ingroup blas3
  */
 template <TLAPACK_MATRIX matrixA_t,
@@ -84,9 +88,14 @@ void symm(Side side,
     tlapack_check_false(nrows(C) != m);
     tlapack_check_false(ncols(C) != n);
 
+    // Columns of C are computed in parallel for large problems
+    [[maybe_unused]] const int nt = internal::blas3_num_threads(
+        (std::size_t)m * n * ((side == Side::Left) ? m : n));
+
     if (side == Side::Left) {
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
+            TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = 0; i < m; ++i) {
                     const scalar_type<alpha_t, TB> alphaTimesBij =
@@ -104,6 +113,7 @@ void symm(Side side,
         }
         else {
             // uplo == Uplo::Lower
+            TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = m - 1; i != idx_t(-1); --i) {
                     const scalar_type<alpha_t, TB> alphaTimesBij =
@@ -126,6 +136,7 @@ void symm(Side side,
 
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
+            TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 {
                     const scalar_t alphaTimesAjj = alpha * A(j, j);
@@ -148,6 +159,7 @@ void symm(Side side,
         }
         else {
             // uplo == Uplo::Lower
+            TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 {
                     const scalar_t alphaTimesAjj = alpha * A(j, j);
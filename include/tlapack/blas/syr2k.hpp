@@ -11,6 +11,7 @@
 #ifndef TLAPACK_BLAS_SYR2K_HH
 #define TLAPACK_BLAS_SYR2K_HH
 
+#include "tlapack/base/threads.hpp"
 #include "tlapack/base/utils.hpp"
 
 namespace tlapack {
@@ -48,6 +49,9 @@ namespace tlapack {
  * @param[in] beta Scalar.
  * @param[in,out] C A n-by-n symmetric matrix.
  *
+ * @note With OpenMP, large updates split the columns of C among threads, see
+ * tlapack::blas3_thread_opts().
+ *
  * @ingroup blas3
  */
 template <TLAPACK_MATRIX matrixA_t,
@@ -86,9 +90,15 @@ void syr2k(Uplo uplo,
     tlapack_check_false(nrows(C) != ncols(C));
     tlapack_check_false(nrows(C) != n);
 
+    // Columns of C are computed in parallel for large problems
+    [[maybe_unused]] const int nt =
+        internal::blas3_num_threads((std::size_t)2 * n * n * k);
+
     if (trans == Op::NoTrans) {
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
+            TLAPACK_OMP(parallel for schedule(dynamic, 8)
+                            num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = 0; i <= j; ++i)
                     C(i, j) *= beta;
@@ -102,6 +112,8 @@ void syr2k(Uplo uplo,
             }
         }
         else {  // uplo == Uplo::Lower
+            TLAPACK_OMP(parallel for schedule(dynamic, 8)
+                            num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = j; i < n; ++i)
                     C(i, j) *= beta;
@@ -120,6 +132,8 @@ void syr2k(Uplo uplo,
 
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
+            TLAPACK_OMP(parallel for schedule(dynamic, 8)
+                            num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = 0; i <= j; ++i) {
                     scalar_t sum1(0);
@@ -133,6 +147,8 @@ void syr2k(Uplo uplo,
             }
         }
         else {  // uplo == Uplo::Lower
+            TLAPACK_OMP(parallel for schedule(dynamic, 8)
+                            num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = j; i < n; ++i) {
                     scalar_t sum1(0);
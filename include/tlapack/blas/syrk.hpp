@@ -11,6 +11,7 @@
 #ifndef TLAPACK_BLAS_SYRK_HH
 #define TLAPACK_BLAS_SYRK_HH
 
+#include "tlapack/base/threads.hpp"
 #include "tlapack/base/utils.hpp"
 
 namespace tlapack {
@@ -45,6 +46,9 @@ namespace tlapack {
  * @param[in] beta Scalar.
  * @param[in,out] C A n-by-n symmetric matrix.
  *
+ * @note With OpenMP, large updates split the columns of C among threads, see
+ * tlapack::blas3_thread_opts().
+ *
  * @ingroup blas3
  */
 template <TLAPACK_MATRIX matrixA_t,
@@ -78,9 +82,15 @@ void syrk(Uplo uplo,
     tlapack_check_false(nrows(C) != ncols(C));
     tlapack_check_false(nrows(C) != n);
 
+    // Columns of C are computed in parallel for large problems
+    [[maybe_unused]] const int nt =
+        internal::blas3_num_threads((std::size_t)n * n * k);
+
     if (trans == Op::NoTrans) {
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
+            TLAPACK_OMP(parallel for schedule(dynamic, 8)
+                            num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = 0; i <= j; ++i)
                     C(i, j) *= beta;
@@ -93,6 +103,8 @@ void syrk(Uplo uplo,
             }
         }
         else {  // uplo == Uplo::Lower
+            TLAPACK_OMP(parallel for schedule(dynamic, 8)
+                            num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = j; i < n; ++i)
                     C(i, j) *= beta;
@@ -108,6 +120,8 @@ void syrk(Uplo uplo,
     else {  // trans == Op::Trans
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
+            TLAPACK_OMP(parallel for schedule(dynamic, 8)
+                            num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = 0; i <= j; ++i) {
                     TA sum(0);
@@ -118,6 +132,8 @@ void syrk(Uplo uplo,
             }
         }
         else {  // uplo == Uplo::Lower
+            TLAPACK_OMP(parallel for schedule(dynamic, 8)
+                            num_threads(nt) if (nt > 1))
             for (idx_t j = 0; j < n; ++j) {
                 for (idx_t i = j; i < n; ++i) {
                     TA sum(0);
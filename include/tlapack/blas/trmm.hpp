@@ -11,6 +11,7 @@
 #ifndef TLAPACK_BLAS_TRMM_HH
 #define TLAPACK_BLAS_TRMM_HH
 
+#include "tlapack/base/threads.hpp"
 #include "tlapack/base/utils.hpp"
 
 namespace tlapack {
@@ -60,6 +61,9 @@ namespace tlapack {
  *     - If side = Right: a n-by-n matrix.
  * @param[in,out] B A m-by-n matrix.
  *
+ * @note With OpenMP, large products split the columns of B (side = Left) or
+ * its rows (side = Right) among threads, see tlapack::blas3_thread_opts().
+ *
  * @ingroup blas3
  */
 template <TLAPACK_MATRIX matrixA_t,
@@ -95,10 +99,15 @@ void trmm(Side side,
     tlapack_check_false(nrows(A) != ncols(A));
     tlapack_check_false(nrows(A) != ((side == Side::Left) ? m : n));
 
+    // Number of threads
+    [[maybe_unused]] const int nt = internal::blas3_num_threads(
+        (std::size_t)m * n * ((side == Side::Left) ? m : n));
+
     if (side == Side::Left) {
         if (trans == Op::NoTrans) {
             using scalar_t = scalar_type<alpha_t, TB>;
             if (uplo == Uplo::Upper) {
+                TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
                 for (idx_t j = 0; j < n; ++j) {
                     for (idx_t k = 0; k < m; ++k) {
                         const scalar_t alphaBkj = alpha * B(k, j);
@@ -110,6 +119,7 @@ void trmm(Side side,
                 }
             }
             else {  // uplo == Uplo::Lower
+                TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
                 for (idx_t j = 0; j < n; ++j) {
                     for (idx_t k = m - 1; k != idx_t(-1); --k) {
                         const scalar_t alphaBkj = alpha * B(k, j);
@@ -124,6 +134,7 @@ void trmm(Side side,
         else if (trans == Op::Trans) {
             using scalar_t = scalar_type<TA, TB>;
             if (uplo == Uplo::Upper) {
+                TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
                 for (idx_t j = 0; j < n; ++j) {
                     for (idx_t i = m - 1; i != idx_t(-1); --i) {
                         scalar_t sum = (diag == Diag::NonUnit)
@@ -136,6 +147,7 @@ void trmm(Side side,
                 }
             }
             else {  // uplo == Uplo::Lower
+                TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
                 for (idx_t j = 0; j < n; ++j) {
                     for (idx_t i = 0; i < m; ++i) {
                         scalar_t sum = (diag == Diag::NonUnit)
@@ -151,6 +163,7 @@ void trmm(Side side,
         else {  // trans == Op::ConjTrans
             using scalar_t = scalar_type<TA, TB>;
             if (uplo == Uplo::Upper) {
+                TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
                 for (idx_t j = 0; j < n; ++j) {
                     for (idx_t i = m - 1; i != idx_t(-1); --i) {
                         scalar_t sum = (diag == Diag::NonUnit)
@@ -163,6 +176,7 @@ void trmm(Side side,
                 }
             }
             else {  // uplo == Uplo::Lower
+                TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
                 for (idx_t j = 0; j < n; ++j) {
                     for (idx_t i = 0; i < m; ++i) {
                         scalar_t sum = (diag == Diag::NonUnit)
@@ -178,100 +192,111 @@ void trmm(Side side,
     }
     else {  // side == Side::Right
         using scalar_t = scalar_type<alpha_t, TA>;
-        if (trans == Op::NoTrans) {
-            if (uplo == Uplo::Upper) {
-                for (idx_t j = n - 1; j != idx_t(-1); --j) {
-                    {
-                        const scalar_t alphaAjj =
-                            (diag == Diag::NonUnit) ? alpha * A(j, j) : alpha;
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) *= alphaAjj;
-                    }
-                    for (idx_t k = 0; k < j; ++k) {
-                        const scalar_t alphaAkj = alpha * A(k, j);
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) += B(i, k) * alphaAkj;
+
+        // Rows of B are independent and are split among threads
+        TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
+        for (int t = 0; t < nt; ++t) {
+            const idx_t i0 = (m * t) / nt;
+            const idx_t i1 = (m * (t + 1)) / nt;
+            if (trans == Op::NoTrans) {
+                if (uplo == Uplo::Upper) {
+                    for (idx_t j = n - 1; j != idx_t(-1); --j) {
+                        {
+                            const scalar_t alphaAjj = (diag == Diag::NonUnit)
+                                                          ? alpha * A(j, j)
+                                                          : alpha;
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, j) *= alphaAjj;
+                        }
+                        for (idx_t k = 0; k < j; ++k) {
+                            const scalar_t alphaAkj = alpha * A(k, j);
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, j) += B(i, k) * alphaAkj;
+                        }
                     }
                 }
-            }
-            else {  // uplo == Uplo::Lower
-                for (idx_t j = 0; j < n; ++j) {
-                    {
-                        const scalar_t alphaAjj =
-                            (diag == Diag::NonUnit) ? alpha * A(j, j) : alpha;
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) *= alphaAjj;
-                    }
-                    for (idx_t k = j + 1; k < n; ++k) {
-                        const scalar_t alphaAkj = alpha * A(k, j);
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) += B(i, k) * alphaAkj;
+                else {  // uplo == Uplo::Lower
+                    for (idx_t j = 0; j < n; ++j) {
+                        {
+                            const scalar_t alphaAjj = (diag == Diag::NonUnit)
+                                                          ? alpha * A(j, j)
+                                                          : alpha;
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, j) *= alphaAjj;
+                        }
+                        for (idx_t k = j + 1; k < n; ++k) {
+                            const scalar_t alphaAkj = alpha * A(k, j);
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, j) += B(i, k) * alphaAkj;
+                        }
                     }
                 }
             }
-        }
-        else if (trans == Op::Trans) {
-            if (uplo == Uplo::Upper) {
-                for (idx_t k = 0; k < n; ++k) {
-                    for (idx_t j = 0; j < k; ++j) {
-                        const scalar_t alphaAjk = alpha * A(j, k);
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) += B(i, k) * alphaAjk;
-                    }
-                    {
-                        const scalar_t alphaAkk =
-                            (diag == Diag::NonUnit) ? alpha * A(k, k) : alpha;
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, k) *= alphaAkk;
+            else if (trans == Op::Trans) {
+                if (uplo == Uplo::Upper) {
+                    for (idx_t k = 0; k < n; ++k) {
+                        for (idx_t j = 0; j < k; ++j) {
+                            const scalar_t alphaAjk = alpha * A(j, k);
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, j) += B(i, k) * alphaAjk;
+                        }
+                        {
+                            const scalar_t alphaAkk = (diag == Diag::NonUnit)
+                                                          ? alpha * A(k, k)
+                                                          : alpha;
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, k) *= alphaAkk;
+                        }
                     }
                 }
-            }
-            else {  // uplo == Uplo::Lower
-                for (idx_t k = n - 1; k != idx_t(-1); --k) {
-                    for (idx_t j = k + 1; j < n; ++j) {
-                        const scalar_t alphaAjk = alpha * A(j, k);
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) += B(i, k) * alphaAjk;
-                    }
-                    {
-                        const scalar_t alphaAkk =
-                            (diag == Diag::NonUnit) ? alpha * A(k, k) : alpha;
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, k) *= alphaAkk;
+                else {  // uplo == Uplo::Lower
+                    for (idx_t k = n - 1; k != idx_t(-1); --k) {
+                        for (idx_t j = k + 1; j < n; ++j) {
+                            const scalar_t alphaAjk = alpha * A(j, k);
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, j) += B(i, k) * alphaAjk;
+                        }
+                        {
+                            const scalar_t alphaAkk = (diag == Diag::NonUnit)
+                                                          ? alpha * A(k, k)
+                                                          : alpha;
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, k) *= alphaAkk;
+                        }
                     }
                 }
             }
-        }
-        else {  // trans == Op::ConjTrans
-            if (uplo == Uplo::Upper) {
-                for (idx_t k = 0; k < n; ++k) {
-                    for (idx_t j = 0; j < k; ++j) {
-                        const scalar_t alphaAjk = alpha * conj(A(j, k));
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) += B(i, k) * alphaAjk;
-                    }
-                    {
-                        const scalar_t alphaAkk = (diag == Diag::NonUnit)
-                                                      ? alpha * conj(A(k, k))
-                                                      : alpha;
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, k) *= alphaAkk;
+            else {  // trans == Op::ConjTrans
+                if (uplo == Uplo::Upper) {
+                    for (idx_t k = 0; k < n; ++k) {
+                        for (idx_t j = 0; j < k; ++j) {
+                            const scalar_t alphaAjk = alpha * conj(A(j, k));
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, j) += B(i, k) * alphaAjk;
+                        }
+                        {
+                            const scalar_t alphaAkk =
+                                (diag == Diag::NonUnit) ? alpha * conj(A(k, k))
+                                                        : alpha;
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, k) *= alphaAkk;
+                        }
                     }
                 }
-            }
-            else {  // uplo == Uplo::Lower
-                for (idx_t k = n - 1; k != idx_t(-1); --k) {
-                    for (idx_t j = k + 1; j < n; ++j) {
-                        const scalar_t alphaAjk = alpha * conj(A(j, k));
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) += B(i, k) * alphaAjk;
-                    }
-                    {
-                        const scalar_t alphaAkk = (diag == Diag::NonUnit)
-                                                      ? alpha * conj(A(k, k))
-                                                      : alpha;
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, k) *= alphaAkk;
+                else {  // uplo == Uplo::Lower
+                    for (idx_t k = n - 1; k != idx_t(-1); --k) {
+                        for (idx_t j = k + 1; j < n; ++j) {
+                            const scalar_t alphaAjk = alpha * conj(A(j, k));
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, j) += B(i, k) * alphaAjk;
+                        }
+                        {
+                            const scalar_t alphaAkk =
+                                (diag == Diag::NonUnit) ? alpha * conj(A(k, k))
+                                                        : alpha;
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, k) *= alphaAkk;
+                        }
                     }
                 }
             }
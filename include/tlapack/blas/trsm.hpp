@@ -11,6 +11,7 @@
 #ifndef TLAPACK_BLAS_TRSM_HH
 #define TLAPACK_BLAS_TRSM_HH
 
+#include "tlapack/base/threads.hpp"
 #include "tlapack/base/utils.hpp"
 
 namespace tlapack {
@@ -64,6 +65,9 @@ namespace tlapack {
  *      On entry, the m-by-n matrix B.
  *      On exit,  the m-by-n matrix X.
  *
+ * @note With OpenMP, large systems split the columns of B (side = Left) or
+ * its rows (side = Right) among threads, see tlapack::blas3_thread_opts().
+ *
  * @ingroup blas3
  */
 template <TLAPACK_MATRIX matrixA_t,
@@ -98,10 +102,15 @@ void trsm(Side side,
     tlapack_check_false(nrows(A) != ncols(A));
     tlapack_check_false(nrows(A) != ((side == Side::Left) ? m : n));
 
+    // Number of threads
+    [[maybe_unused]] const int nt = internal::blas3_num_threads(
+        (std::size_t)m * n * ((side == Side::Left) ? m : n));
+
     if (side == Side::Left) {
         using scalar_t = scalar_type<alpha_t, TB>;
         if (trans == Op::NoTrans) {
             if (uplo == Uplo::Upper) {
+                TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
                 for (idx_t j = 0; j < n; ++j) {
                     for (idx_t i = 0; i < m; ++i)
                         B(i, j) *= alpha;
@@ -113,6 +122,7 @@ void trsm(Side side,
                 }
             }
             else {  // uplo == Uplo::Lower
+                TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
                 for (idx_t j = 0; j < n; ++j) {
                     for (idx_t i = 0; i < m; ++i)
                         B(i, j) *= alpha;
@@ -126,6 +136,7 @@ void trsm(Side side,
         }
         else if (trans == Op::Trans) {
             if (uplo == Uplo::Upper) {
+                TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
                 for (idx_t j = 0; j < n; ++j) {
                     for (idx_t i = 0; i < m; ++i) {
                         scalar_t sum = alpha * B(i, j);
@@ -136,6 +147,7 @@ void trsm(Side side,
                 }
             }
             else {  // uplo == Uplo::Lower
+                TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
                 for (idx_t j = 0; j < n; ++j) {
                     for (idx_t i = m - 1; i != idx_t(-1); --i) {
                         scalar_t sum = alpha * B(i, j);
@@ -148,6 +160,7 @@ void trsm(Side side,
         }
         else {  // trans == Op::ConjTrans
             if (uplo == Uplo::Upper) {
+                TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
                 for (idx_t j = 0; j < n; ++j) {
                     for (idx_t i = 0; i < m; ++i) {
                         scalar_t sum = alpha * B(i, j);
@@ -159,6 +172,7 @@ void trsm(Side side,
                 }
             }
             else {  // uplo == Uplo::Lower
+                TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
                 for (idx_t j = 0; j < n; ++j) {
                     for (idx_t i = m - 1; i != idx_t(-1); --i) {
                         scalar_t sum = alpha * B(i, j);
@@ -172,93 +186,99 @@ void trsm(Side side,
         }
     }
     else {  // side == Side::Right
-        if (trans == Op::NoTrans) {
-            if (uplo == Uplo::Upper) {
-                for (idx_t j = 0; j < n; ++j) {
-                    for (idx_t i = 0; i < m; ++i)
-                        B(i, j) *= alpha;
-                    for (idx_t k = 0; k < j; ++k) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) -= B(i, k) * A(k, j);
-                    }
-                    if (diag == Diag::NonUnit) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) /= A(j, j);
+        // Rows of B are independent and are split among threads
+        TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
+        for (int t = 0; t < nt; ++t) {
+            const idx_t i0 = (m * t) / nt;
+            const idx_t i1 = (m * (t + 1)) / nt;
+            if (trans == Op::NoTrans) {
+                if (uplo == Uplo::Upper) {
+                    for (idx_t j = 0; j < n; ++j) {
+                        for (idx_t i = i0; i < i1; ++i)
+                            B(i, j) *= alpha;
+                        for (idx_t k = 0; k < j; ++k) {
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, j) -= B(i, k) * A(k, j);
+                        }
+                        if (diag == Diag::NonUnit) {
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, j) /= A(j, j);
+                        }
                     }
                 }
-            }
-            else {  // uplo == Uplo::Lower
-                for (idx_t j = n - 1; j != idx_t(-1); --j) {
-                    for (idx_t i = 0; i < m; ++i)
-                        B(i, j) *= alpha;
-                    for (idx_t k = j + 1; k < n; ++k) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) -= B(i, k) * A(k, j);
-                    }
-                    if (diag == Diag::NonUnit) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) /= A(j, j);
+                else {  // uplo == Uplo::Lower
+                    for (idx_t j = n - 1; j != idx_t(-1); --j) {
+                        for (idx_t i = i0; i < i1; ++i)
+                            B(i, j) *= alpha;
+                        for (idx_t k = j + 1; k < n; ++k) {
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, j) -= B(i, k) * A(k, j);
+                        }
+                        if (diag == Diag::NonUnit) {
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, j) /= A(j, j);
+                        }
                     }
                 }
             }
-        }
-        else if (trans == Op::Trans) {
-            if (uplo == Uplo::Upper) {
-                for (idx_t k = n - 1; k != idx_t(-1); --k) {
-                    if (diag == Diag::NonUnit) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, k) /= A(k, k);
+            else if (trans == Op::Trans) {
+                if (uplo == Uplo::Upper) {
+                    for (idx_t k = n - 1; k != idx_t(-1); --k) {
+                        if (diag == Diag::NonUnit) {
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, k) /= A(k, k);
+                        }
+                        for (idx_t j = 0; j < k; ++j) {
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, j) -= B(i, k) * A(j, k);
+                        }
+                        for (idx_t i = i0; i < i1; ++i)
+                            B(i, k) *= alpha;
                     }
-                    for (idx_t j = 0; j < k; ++j) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) -= B(i, k) * A(j, k);
-                    }
-                    for (idx_t i = 0; i < m; ++i)
-                        B(i, k) *= alpha;
                 }
-            }
-            else {  // uplo == Uplo::Lower
-                for (idx_t k = 0; k < n; ++k) {
-                    if (diag == Diag::NonUnit) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, k) /= A(k, k);
+                else {  // uplo == Uplo::Lower
+                    for (idx_t k = 0; k < n; ++k) {
+                        if (diag == Diag::NonUnit) {
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, k) /= A(k, k);
+                        }
+                        for (idx_t j = k + 1; j < n; ++j) {
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, j) -= B(i, k) * A(j, k);
+                        }
+                        for (idx_t i = i0; i < i1; ++i)
+                            B(i, k) *= alpha;
                     }
-                    for (idx_t j = k + 1; j < n; ++j) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) -= B(i, k) * A(j, k);
-                    }
-                    for (idx_t i = 0; i < m; ++i)
-                        B(i, k) *= alpha;
                 }
             }
-        }
-        else {  // trans == Op::ConjTrans
-            if (uplo == Uplo::Upper) {
-                for (idx_t k = n - 1; k != idx_t(-1); --k) {
-                    if (diag == Diag::NonUnit) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, k) /= conj(A(k, k));
-                    }
-                    for (idx_t j = 0; j < k; ++j) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) -= B(i, k) * conj(A(j, k));
+            else {  // trans == Op::ConjTrans
+                if (uplo == Uplo::Upper) {
+                    for (idx_t k = n - 1; k != idx_t(-1); --k) {
+                        if (diag == Diag::NonUnit) {
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, k) /= conj(A(k, k));
+                        }
+                        for (idx_t j = 0; j < k; ++j) {
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, j) -= B(i, k) * conj(A(j, k));
+                        }
+                        for (idx_t i = i0; i < i1; ++i)
+                            B(i, k) *= alpha;
                     }
-                    for (idx_t i = 0; i < m; ++i)
-                        B(i, k) *= alpha;
                 }
-            }
-            else {  // uplo == Uplo::Lower
-                for (idx_t k = 0; k < n; ++k) {
-                    if (diag == Diag::NonUnit) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, k) /= conj(A(k, k));
-                    }
-                    for (idx_t j = k + 1; j < n; ++j) {
-                        for (idx_t i = 0; i < m; ++i)
-                            B(i, j) -= B(i, k) * conj(A(j, k));
+                else {  // uplo == Uplo::Lower
+                    for (idx_t k = 0; k < n; ++k) {
+                        if (diag == Diag::NonUnit) {
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, k) /= conj(A(k, k));
+                        }
+                        for (idx_t j = k + 1; j < n; ++j) {
+                            for (idx_t i = i0; i < i1; ++i)
+                                B(i, j) -= B(i, k) * conj(A(j, k));
+                        }
+                        for (idx_t i = i0; i < i1; ++i)
+                            B(i, k) *= alpha;
                     }
-                    for (idx_t i = 0; i < m; ++i)
-                        B(i, k) *= alpha;
                 }
             }
         }
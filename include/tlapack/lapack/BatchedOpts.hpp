@@ -0,0 +1,118 @@
+/// @file BatchedOpts.hpp Options and interleaving helpers for the batched
+/// factorizations of small matrices.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BATCHED_OPTS_HH
+#define TLAPACK_BATCHED_OPTS_HH
+
+#include <vector>
+
+#include "tlapack/LegacyMatrixBatch.hpp"
+#include "tlapack/base/threads.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/plugins/legacyArray.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for getrf_batched(), potrf_batched(), geqrf_batched() and
+ * gesvd_batched().
+ */
+struct BatchedOpts {
+    /// Maximum number of OpenMP threads working on the batch.
+    /// If nthreads <= 0, use omp_get_max_threads().
+    int nthreads = 0;
+};
+
+namespace internal {
+
+    /**
+     * Number of matrices that the interleaved kernels factor together.
+     *
+     * Entry (i,j) of the l-th matrix of a group is stored at X[(i + j*m)*W +
+     * l], where W = batch_lanes<T>, so that the innermost loops of the kernels
+     * run over the batch dimension. For float and double, the W entries fill a
+     * 512-bit vector.
+     */
+    template <class T>
+    constexpr int batch_lanes = (is_same_v<real_type<T>, float> ||
+                                 is_same_v<real_type<T>, double>)
+                                    ? int(64 / sizeof(T))
+                                    : 1;
+
+    /**
+     * Calls f(b0, nb, work, iwork) for the groups [b0, b0 + nb) of at most W
+     * consecutive matrices of a batch with count matrices.
+     *
+     * The groups are distributed among OpenMP threads. work and iwork are
+     * thread-local vectors that f may resize and reuse between groups.
+     */
+    template <int W, class T, class idx_t, class F>
+    void batch_for_each_group(idx_t count, const BatchedOpts& opts, F&& f)
+    {
+        const idx_t ngroups = (count + W - 1) / W;
+
+#ifdef _OPENMP
+        const int nt = (omp_in_parallel()) ? 1
+                       : (opts.nthreads > 0) ? opts.nthreads
+                                             : omp_get_max_threads();
+#else
+        (void)opts;
+        [[maybe_unused]] const int nt = 1;
+#endif
+
+        TLAPACK_OMP(parallel num_threads(nt) if (nt > 1 && ngroups > 1))
+        {
+            std::vector<T> work;
+            std::vector<idx_t> iwork;
+            TLAPACK_OMP(for schedule(static))
+            for (idx_t g = 0; g < ngroups; ++g)
+                f(g * W, min<idx_t>(W, count - g * W), work, iwork);
+        }
+    }
+
+    /**
+     * Copies the matrices b0, ..., b0+nb-1 of the batch A to the interleaved
+     * buffer X. The remaining W-nb lanes are set to the identity matrix.
+     */
+    template <int W, class batch_t, class T, class idx_t>
+    void batch_interleave(const batch_t& A, idx_t b0, idx_t nb, T* X)
+    {
+        const idx_t m = A.m;
+        const idx_t n = A.n;
+
+        for (idx_t l = 0; l < nb; ++l) {
+            const auto Al = A[b0 + l];
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < m; ++i)
+                    X[(i + j * m) * W + l] = Al(i, j);
+        }
+        for (idx_t l = nb; l < idx_t(W); ++l) {
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < m; ++i)
+                    X[(i + j * m) * W + l] = (i == j) ? T(1) : T(0);
+        }
+    }
+
+    /// Copies the lane l of the interleaved buffer X to the m-by-n matrix Al.
+    template <int W, class matrix_t, class T, class idx_t>
+    void batch_deinterleave(const T* X, idx_t l, matrix_t& Al)
+    {
+        const idx_t m = nrows(Al);
+        const idx_t n = ncols(Al);
+
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                Al(i, j) = X[(i + j * m) * W + l];
+    }
+
+}  // namespace internal
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BATCHED_OPTS_HH
@@ -53,10 +53,28 @@ struct FrancisOpts {
     int n_sweep = 0;         ///< number of sweeps used
     int n_shifts_total = 0;  ///< total number of shifts used
 
+    // On exit of the routine. Stores the time, in seconds, spent in AED and
+    // in the sweeps. The AED time is split in the three phases below.
+    double t_aed = 0;          ///< time spent in AED
+    double t_aed_schur = 0;    ///< Schur factorization of the AED windows
+    double t_aed_deflate = 0;  ///< deflation checks and reordering in AED
+    double t_aed_update = 0;   ///< Hessenberg reduction and updates in AED
+    double t_sweep = 0;        ///< time spent in sweeps
+
     /// Threshold to switch between blocked and unblocked code
     size_t nmin = 75;
     /// Threshold of percent of AED window that must converge to skip a sweep
     size_t nibble = 14;
+    /// Minimum size of the AED window from which the deflation is checked in
+    /// blocks and the undeflatable eigenvalues are moved with schur_reorder()
+    size_t nmin_aed_reorder = 384;
+
+    /// Number of OpenMP threads used in the multishift QR sweeps and in AED.
+    /// With nthreads > 1, the off-diagonal updates of a block of bulge
+    /// chasing run in OpenMP tasks while the next block is chased, and the
+    /// updates of A and Z after AED run in OpenMP tasks.
+    /// If nthreads <= 0, use omp_get_max_threads().
+    int nthreads = 1;
 };
 
 // Forward declarations:
@@ -0,0 +1,73 @@
+/// @file RefinementOpts.hpp Options for the mixed-precision solvers with
+/// iterative refinement.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_REFINEMENT_OPTS_HH
+#define TLAPACK_REFINEMENT_OPTS_HH
+
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/// Method that computed the solution of a mixed-precision solver
+enum class RefinementSolver : char {
+    Refinement = 'R',     ///< Iterative refinement with the low-precision
+                          ///< factorization
+    GMRES = 'G',          ///< GMRES-IR preconditioned by the low-precision
+                          ///< factorization
+    FullPrecision = 'F',  ///< Factorization in the working precision
+};
+
+/// @brief Convert RefinementSolver to string
+inline std::ostream& operator<<(std::ostream& out, RefinementSolver v)
+{
+    if (v == RefinementSolver::Refinement)
+        out << "Refinement";
+    else if (v == RefinementSolver::GMRES)
+        out << "GMRES";
+    else if (v == RefinementSolver::FullPrecision)
+        out << "FullPrecision";
+    else
+        out << "<Invalid>";
+    return out;
+}
+
+/**
+ * Options struct for gesv_ir() and posv_ir().
+ */
+struct RefinementOpts {
+    /// Maximum number of refinement steps. The limit applies to the classical
+    /// refinement and to the steps of GMRES-IR separately.
+    int max_iter = 30;
+
+    /// If true, GMRES-IR is used when the classical refinement stalls.
+    bool use_gmres = true;
+
+    /// Maximum number of GMRES iterations in each step of GMRES-IR
+    int gmres_max_iter = 50;
+
+    /// GMRES stops when the preconditioned residual is reduced by gmres_tol
+    double gmres_tol = 1.0e-6;
+
+    /// If true, A is factored in the working precision when the refinement
+    /// does not converge or the low-precision factorization fails.
+    bool fallback = true;
+
+    // On exit of the routine. Stores convergence statistics.
+    int n_iter = 0;        ///< number of classical refinement steps
+    int n_gmres_step = 0;  ///< number of steps of GMRES-IR
+    int n_gmres_iter = 0;  ///< total number of GMRES iterations
+    double backward_error = 0;  ///< max_j |B_j - A X_j| / (|A| |X_j| + |B_j|)
+                                ///< in the infinity norm
+    RefinementSolver solver =
+        RefinementSolver::Refinement;  ///< method of the solution
+};
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_REFINEMENT_OPTS_HH
@@ -0,0 +1,73 @@
+/// @file TiledOpts.hpp Options for the tiled factorizations that run on a
+/// TaskRuntime.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TILED_OPTS_HH
+#define TLAPACK_TILED_OPTS_HH
+
+#include <mutex>
+
+#include "tlapack/base/taskRuntime.hpp"
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for potrf_tiled(), getrf_tiled(), geqrf_tiled() and
+ * unmqr_tiled().
+ */
+struct TiledOpts {
+    size_t nb = 256;  ///< Number of rows and columns of the tiles
+
+    /// Runtime that executes the tasks.
+    /// If runtime is null, use default_task_runtime().
+    /// Calls that share a runtime run one at a time. A tiled routine must not
+    /// be called from a task that runs on the runtime it uses, since it would
+    /// wait for its own task to finish.
+    TaskRuntime* runtime = nullptr;
+};
+
+namespace internal {
+
+    /// Runtime used by the tiled routines
+    inline TaskRuntime& tiled_runtime(const TiledOpts& opts)
+    {
+        return (opts.runtime) ? *opts.runtime : default_task_runtime();
+    }
+
+    /**
+     * Runtime of a call to a tiled routine. Holds the caller mutex of the
+     * runtime from the first submission until the destructor, so that calls
+     * from several threads that share a runtime do not interleave their
+     * tasks.
+     */
+    class tiled_session {
+       public:
+        explicit tiled_session(const TiledOpts& opts)
+            : rt(tiled_runtime(opts)), lock(rt.caller_mutex())
+        {}
+
+        TaskRuntime& runtime() noexcept { return rt; }
+
+       private:
+        TaskRuntime& rt;
+        std::lock_guard<std::mutex> lock;
+    };
+
+    /// Number of tiles of size nb that cover n rows or columns
+    template <class idx_t>
+    constexpr idx_t tiled_count(idx_t n, idx_t nb) noexcept
+    {
+        return (n + nb - 1) / nb;
+    }
+
+}  // namespace internal
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_TILED_OPTS_HH
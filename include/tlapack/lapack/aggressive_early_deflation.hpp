@@ -10,6 +10,8 @@
 #ifndef TLAPACK_AED_HH
 #define TLAPACK_AED_HH
 
+#include <chrono>
+
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/gemm.hpp"
 #include "tlapack/lapack/FrancisOpts.hpp"
@@ -21,7 +23,9 @@
 #include "tlapack/lapack/larfg.hpp"
 #include "tlapack/lapack/laset.hpp"
 #include "tlapack/lapack/multishift_qr.hpp"
+#include "tlapack/lapack/multishift_qr_sweep.hpp"
 #include "tlapack/lapack/schur_move.hpp"
+#include "tlapack/lapack/schur_reorder.hpp"
 #include "tlapack/lapack/schur_swap.hpp"
 #include "tlapack/lapack/unghr.hpp"
 #include "tlapack/lapack/unmhr.hpp"
@@ -147,6 +151,11 @@ WorkInfo aggressive_early_deflation_worksize(bool want_t,
             multishift_qr_worksize<T>(true, true, 0, jw, TW, s_window, V, opts);
     }
 
+    if (jw >= (idx_t)opts.nmin_aed_reorder) {
+        auto&& TW = slice(A, range{0, jw}, range{0, jw});
+        workinfo.minMax(schur_reorder_worksize<T>(true, TW, TW, s));
+    }
+
     workinfo.minMax(internal::aggressive_early_deflation_worksize_gehrd<T>(
         ilo, ihi, nw, A));
 
@@ -182,6 +191,7 @@ void aggressive_early_deflation_work(bool want_t,
     using real_t = real_type<T>;
     using idx_t = size_type<matrix_t>;
     using range = pair<idx_t, idx_t>;
+    using clock = std::chrono::steady_clock;
 
     // Constants
     const real_t one(1);
@@ -197,6 +207,14 @@ void aggressive_early_deflation_work(bool want_t,
     // First row index in the deflation window
     const idx_t kwtop = ihi - jw;
 
+    // Accumulates the time elapsed since t0 in t and restarts the timer
+    auto t0 = clock::now();
+    auto lap = [&t0](double& t) {
+        const auto t1 = clock::now();
+        t += std::chrono::duration<double>(t1 - t0).count();
+        t0 = t1;
+    };
+
     // check arguments
     tlapack_check(nrows(A) == n);
     if (want_z) {
@@ -252,19 +270,133 @@ void aggressive_early_deflation_work(bool want_t,
     if (jw < (idx_t)opts.nmin)
         infqr = lahqr(true, true, 0, jw, TW, s_window, V);
     else {
-        infqr =
-            multishift_qr_work(true, true, 0, jw, TW, s_window, V, work, opts);
+        // The recursive call works on a copy of the options so that its
+        // counters and timers do not overwrite the ones of the caller
+        FrancisOpts opts_window = opts;
+        infqr = multishift_qr_work(true, true, 0, jw, TW, s_window, V, work,
+                                   opts_window);
         for (idx_t j = 0; j < jw; ++j)
             for (idx_t i = j + 2; i < jw; ++i)
                 TW(i, j) = zero;
     }
+    lap(opts.t_aed_schur);
+
+    // Whether the eigenvalue block of size nb in row i of the Schur form B is
+    // deflatable. v0 and v1 are the components of the spike in its columns.
+    auto deflatable = [&](const auto& B, idx_t i, idx_t nb, const T& v0,
+                          const T& v1) -> bool {
+        if (nb == 1) {
+            real_t foo = abs1(B(i, i));
+            if (foo == zero) foo = abs1(s_spike);
+            // Note: The max() below may not propagate a NaN in B(i, i).
+            return abs1(s_spike) * abs1(v0) <= max(small_num, eps * foo);
+        }
+        else {
+            real_t foo = abs(B(i + 1, i + 1)) +
+                         sqrt(abs(B(i + 1, i))) * sqrt(abs(B(i, i + 1)));
+            if (foo == zero) foo = abs(s_spike);
+            return max(abs(s_spike * v1), abs(s_spike * v0)) <=
+                   max<real_t>(small_num, eps * foo);
+        }
+    };
+
+    ns = jw;
+    idx_t ilst = infqr;
+
+    // Blocked deflation detection for large windows
+    // The detection loop below runs on a copy of the last nbw rows that are
+    // not checked yet, and the orthogonal factor of the copy is applied to
+    // TW and V with gemm. The blocks that are not deflatable end up on top of
+    // the copy, and they are moved up together with schur_reorder(). Each
+    // block is checked with the same spike as in the unblocked loop.
+    if (jw >= (idx_t)opts.nmin_aed_reorder) {
+        SchurReorderOpts reorder_opts;
+        const idx_t nbw = min<idx_t>(jw, reorder_opts.nb_window);
+
+        auto select_ = workspace_arena<idx_t>().get(jw);
+        auto& select = select_.vector();
+
+        while (ilst < ns) {
+            idx_t i0 = (ns - ilst > nbw) ? ns - nbw : ilst;
+            // Do not split a 2x2 block
+            if (is_real<T>)
+                if (i0 > ilst)
+                    if (TW(i0, i0 - 1) != zero) i0 = i0 + 1;
+            const idx_t i1 = ns;
+            const idx_t nw = i1 - i0;
+
+            auto [W, work2] = reshape(work, nbw, 2 * nbw);
+            auto Wb = reshape(work2, nbw, nbw).first;
+            auto Aw = slice(W, range{0, nw}, range{0, nw});
+            auto Qw = slice(W, range{0, nw}, range{nbw, nbw + nw});
+            laset(GENERAL, zero, zero, Aw);
+            for (idx_t j = 0; j < nw; ++j)
+                for (idx_t i = 0; i < min(j + 2, nw); ++i)
+                    Aw(i, j) = TW(i0 + i, i0 + j);
+            laset(GENERAL, zero, one, Qw);
+
+            // Spike component in the column j of the window
+            auto v = slice(Wb, 0, range{0, nw});
+            for (idx_t j = 0; j < nw; ++j)
+                v[j] = V(0, i0 + j);
+            auto spike = [&](idx_t j) {
+                T sum(0);
+                for (idx_t i = 0; i < nw; ++i)
+                    sum += v[i] * Qw(i, j);
+                return sum;
+            };
+
+            idx_t jlst = 0;
+            idx_t jns = nw;
+            while (jlst < jns) {
+                idx_t nb = 1;
+                if (is_real<T>)
+                    if (jns > 1)
+                        if (Aw(jns - 1, jns - 2) != zero) nb = 2;
+                const idx_t j = jns - nb;
+                const T v1 = (nb == 2) ? spike(j + 1) : T(0);
+                if (deflatable(Aw, j, nb, spike(j), v1)) {
+                    jns = j;
+                }
+                else {
+                    idx_t ifst = j;
+                    schur_move(true, Aw, Qw, ifst, jlst);
+                    jlst = jlst + nb;
+                }
+            }
+
+            // Copy the window back into place and update the rest
+            for (idx_t j = 0; j < nw; ++j)
+                for (idx_t i = 0; i < min(j + 2, nw); ++i)
+                    TW(i0 + i, i0 + j) = Aw(i, j);
+            internal::schur_reorder_apply_window(true, TW, V, i0, i1, Qw, Wb);
+            ns = i0 + jlst;
+
+            if (i0 == ilst) {
+                ilst = ns;
+            }
+            else if (jlst > 0) {
+                // Move the blocks that are not deflatable up to row ilst
+                select.assign(jw, 0);
+                for (idx_t i = 0; i < ilst; ++i)
+                    select[i] = 1;
+                for (idx_t i = i0; i < ns; ++i)
+                    select[i] = 1;
+                idx_t m;
+                const int ierr = schur_reorder_work(true, TW, V, select, m,
+                                                    work, reorder_opts);
+                ilst = m;
+                // Two blocks were too close to swap. Finish with the
+                // unblocked detection.
+                if (ierr) break;
+            }
+        }
+    }
 
     // Deflation detection loop
     // one eigenvalue block at a time, we will check if it is deflatable
     // by checking the bottom spike element. If it is not deflatable,
     // we move the block up. This moves other blocks down to check.
-    ns = jw;
-    idx_t ilst = infqr;
     while (ilst < ns) {
         bool bulge = false;
         if (is_real<T>)
@@ -273,10 +405,7 @@ void aggressive_early_deflation_work(bool want_t,
 
         if (!bulge) {
             // 1x1 eigenvalue block
-            real_t foo = abs1(TW(ns - 1, ns - 1));
-            if (foo == zero) foo = abs1(s_spike);
-            if (abs1(s_spike) * abs1(V(0, ns - 1)) <=
-                max(small_num, eps * foo)) {
+            if (deflatable(TW, ns - 1, 1, V(0, ns - 1), T(0))) {
                 // Eigenvalue is deflatable
                 ns = ns - 1;
             }
@@ -287,16 +416,10 @@ void aggressive_early_deflation_work(bool want_t,
                 schur_move(true, TW, V, ifst, ilst);
                 ilst = ilst + 1;
             }
-            // Note: The max() above may not propagate a NaN in TW(ns-1, ns-1).
         }
         else {
             // 2x2 eigenvalue block
-            real_t foo =
-                abs(TW(ns - 1, ns - 1)) +
-                sqrt(abs(TW(ns - 1, ns - 2))) * sqrt(abs(TW(ns - 2, ns - 1)));
-            if (foo == zero) foo = abs(s_spike);
-            if (max(abs(s_spike * V(0, ns - 1)), abs(s_spike * V(0, ns - 2))) <=
-                max<real_t>(small_num, eps * foo)) {
+            if (deflatable(TW, ns - 2, 2, V(0, ns - 2), V(0, ns - 1))) {
                 // Eigenvalue pair is deflatable
                 ns = ns - 2;
             }
@@ -317,6 +440,7 @@ void aggressive_early_deflation_work(bool want_t,
         // We don't need to apply the update to the rest of the matrix
         nd = jw - ns;
         ns = ns - infqr;
+        lap(opts.t_aed_deflate);
         return;
     }
 
@@ -398,6 +522,7 @@ void aggressive_early_deflation_work(bool want_t,
                         s[kwtop + i], s[kwtop + i + 1]);
         i = i + n1;
     }
+    lap(opts.t_aed_deflate);
 
     // Reduce A back to Hessenberg form (if neccesary)
     if (s_spike != zero) {
@@ -457,8 +582,39 @@ void aggressive_early_deflation_work(bool want_t,
         istart_m = ilo;
         istop_m = ihi;
     }
+
+    // With more than one thread, the three updates below are split in blocks
+    // of rows or columns that run in OpenMP tasks. Each task uses its own
+    // buffer instead of WH and WV.
+    const int nt = internal::multishift_QR_sweep_num_threads(opts);
+    const bool use_tasks = (nt > 1);
+#ifdef _OPENMP
+    if (use_tasks) {
+        const idx_t nb_task = max<idx_t>(jw, 64);
+#pragma omp parallel num_threads(nt)
+#pragma omp single
+        {
+            if (ihi < istop_m) {
+                auto A_h = slice(A, range{kwtop, ihi}, range{ihi, istop_m});
+                internal::multishift_QR_sweep_tasks<matrix_t>(LEFT_SIDE, V,
+                                                              A_h, nb_task);
+            }
+            if (istart_m < kwtop) {
+                auto A_v = slice(A, range{istart_m, kwtop}, range{kwtop, ihi});
+                internal::multishift_QR_sweep_tasks<matrix_t>(RIGHT_SIDE, V,
+                                                              A_v, nb_task);
+            }
+            if (want_z) {
+                auto Z_v = slice(Z, range{0, n}, range{kwtop, ihi});
+                internal::multishift_QR_sweep_tasks<matrix_t>(RIGHT_SIDE, V,
+                                                              Z_v, nb_task);
+            }
+        }
+    }
+#endif
+
     // Horizontal multiply
-    if (ihi < istop_m) {
+    if (!use_tasks && ihi < istop_m) {
         idx_t i = ihi;
         while (i < istop_m) {
             idx_t iblock = std::min<idx_t>(istop_m - i, ncols(WH));
@@ -471,7 +627,7 @@ void aggressive_early_deflation_work(bool want_t,
         }
     }
     // Vertical multiply
-    if (istart_m < kwtop) {
+    if (!use_tasks && istart_m < kwtop) {
         idx_t i = istart_m;
         while (i < kwtop) {
             idx_t iblock = std::min<idx_t>(kwtop - i, nrows(WV));
@@ -484,7 +640,7 @@ void aggressive_early_deflation_work(bool want_t,
         }
     }
     // Update Z (also a vertical multiplication)
-    if (want_z) {
+    if (!use_tasks && want_z) {
         idx_t i = 0;
         while (i < n) {
             idx_t iblock = std::min<idx_t>(n - i, nrows(WV));
@@ -496,6 +652,7 @@ void aggressive_early_deflation_work(bool want_t,
             i = i + iblock;
         }
     }
+    lap(opts.t_aed_update);
 }
 
 /** @overload void aggressive_early_deflation_work( bool want_t,
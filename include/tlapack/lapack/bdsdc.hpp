@@ -0,0 +1,232 @@
+/// @file bdsdc.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dbdsdc.f
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dbdsvdx.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BDSDC_HH
+#define TLAPACK_BDSDC_HH
+
+#include "tlapack/base/constants.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/scal.hpp"
+#include "tlapack/blas/swap.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/lasd0.hpp"
+#include "tlapack/lapack/svd_qr.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for bdsdc
+ */
+struct BdsdcOpts {
+    size_t smlsiz = 25;  ///< Bidiagonal matrices of size at most smlsiz, and
+                         ///< the subproblems at the bottom of the recursion,
+                         ///< are solved by the QR iteration
+};
+
+/**
+ * Computes the singular values and, optionally, the right and/or left
+ * singular vectors of a real n-by-n (upper or lower) bidiagonal matrix B
+ * using the divide and conquer method. The SVD of B has the form
+ *      B = Q * S * P**T
+ * where S is the diagonal matrix of singular values, Q is an orthogonal
+ * matrix of left singular vectors, and P is an orthogonal matrix of
+ * right singular vectors. As in svd_qr(), this routine returns U*Q
+ * instead of Q and P**T*VT instead of P**T, for given input matrices U and
+ * VT.
+ *
+ * The matrix is split into unreduced blocks at the negligible off-diagonal
+ * elements. The SVD of each block is computed by lasd0(), which divides the
+ * block at its middle row, solves the two halves recursively and merges
+ * their SVDs by solving a secular equation. The singular vectors of the
+ * secular equation are computed from the formula of Gu and Eisenstat, so
+ * that Q and P are orthogonal to working precision, and almost all the work
+ * is done in matrix-matrix products. If B is lower bidiagonal, the SVD of
+ * B**T is computed instead.
+ *
+ * If no singular vectors are requested, or if n <= opts.smlsiz, svd_qr() is
+ * used instead.
+ *
+ * @return  0 if success
+ * @return  i > 0 if the divide and conquer method or the QR iteration failed
+ *          to converge.
+ *
+ * @param[in] uplo
+ *      Uplo::Upper, B is upper bidiagonal
+ *      Uplo::Lower, B is lower bidiagonal
+ *
+ * @param[in] want_u bool
+ *
+ * @param[in] want_vt bool
+ *
+ * @param[in,out] d Real vector of length n.
+ *      On entry, diagonal elements of the bidiagonal matrix B.
+ *      On exit, the singular values of B in decreasing order.
+ *
+ * @param[in,out] e Real vector of length n-1.
+ *      On entry, off-diagonal elements of the bidiagonal matrix B.
+ *      On exit, e has been destroyed.
+ *
+ * @param[in,out] U nu-by-m matrix, m >= n.
+ *      On entry, an nu-by-m unitary matrix.
+ *      On exit, the first n columns of U are overwritten by U(:,0:n) * Q.
+ *
+ * @param[in,out] Vt m-by-nvt matrix, m >= n.
+ *      On entry, an m-by-nvt unitary matrix.
+ *      On exit, the first n rows of Vt are overwritten by P^H * Vt(0:n,:).
+ *
+ * @param[in] opts Options.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          class d_t,
+          class e_t,
+          enable_if_t<is_same_v<type_t<d_t>, real_type<type_t<d_t>>>, int> = 0,
+          enable_if_t<is_same_v<type_t<e_t>, real_type<type_t<e_t>>>, int> = 0>
+int bdsdc(Uplo uplo,
+          bool want_u,
+          bool want_vt,
+          d_t& d,
+          e_t& e,
+          matrix_t& U,
+          matrix_t& Vt,
+          const BdsdcOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+    using r_matrix_t = real_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functors
+    Create<matrix_t> new_matrix;
+    Create<r_matrix_t> new_real_matrix;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const idx_t n = size(d);
+    const idx_t smlsiz = max<idx_t>(opts.smlsiz, 2);
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Upper || uplo == Uplo::Lower);
+    tlapack_check_false(n > 0 && (idx_t)size(e) < n - 1);
+    if (want_u) tlapack_check_false(ncols(U) < n);
+    if (want_vt) tlapack_check_false(nrows(Vt) < n);
+
+    // Quick return
+    if (n == 0) return 0;
+
+    // Use the QR iteration if no singular vectors are requested or the
+    // matrix is small
+    if ((!want_u && !want_vt) || n <= smlsiz)
+        return svd_qr(uplo, want_u, want_vt, d, e, U, Vt);
+
+    // Scale
+    real_t orgnrm = zero;
+    for (idx_t i = 0; i < n; ++i)
+        orgnrm = max(orgnrm, abs(d[i]));
+    for (idx_t i = 0; i + 1 < n; ++i)
+        orgnrm = max(orgnrm, abs(e[i]));
+    if (orgnrm == zero) return 0;
+    for (idx_t i = 0; i < n; ++i)
+        d[i] /= orgnrm;
+    for (idx_t i = 0; i + 1 < n; ++i)
+        e[i] /= orgnrm;
+
+    // Singular vectors of the upper bidiagonal matrix with diagonal d and
+    // off-diagonal e, i.e., of B if B is upper bidiagonal and of B^T
+    // otherwise
+    auto UV_ = workspace_arena<real_t>().get(WorkInfo(n, 2 * n));
+    auto UV = new_real_matrix(UV_.vector(), n, 2 * n);
+    auto Ub = slice(UV, range{0, n}, range{0, n});
+    auto Vb = slice(UV, range{0, n}, range{n, 2 * n});
+    laset(GENERAL, zero, one, Ub);
+    laset(GENERAL, zero, one, Vb);
+
+    // Solve each unreduced block with the divide and conquer method
+    const real_t eps = uroundoff<real_t>();
+    for (idx_t start = 0; start < n;) {
+        idx_t end = start + 1;
+        while (end < n && abs(e[end - 1]) >= eps)
+            ++end;
+        if (end < n) e[end - 1] = zero;
+
+        if (end - start > 1) {
+            auto db = slice(d, range{start, end});
+            auto eb = slice(e, range{start, end - 1});
+            auto Ubb = slice(Ub, range{start, end}, range{start, end});
+            auto Vbb = slice(Vb, range{start, end}, range{start, end});
+            const int info = lasd0(db, eb, Ubb, Vbb, smlsiz);
+            if (info != 0) return info;
+        }
+        start = end;
+    }
+
+    // Make the singular values positive and unscale
+    for (idx_t i = 0; i < n; ++i) {
+        if (d[i] < zero) {
+            d[i] = -d[i];
+            auto vi = row(Vb, i);
+            scal(-one, vi);
+        }
+        d[i] *= orgnrm;
+    }
+
+    // Sort the singular values into decreasing order
+    for (idx_t i = 0; i + 1 < n; ++i) {
+        idx_t imax = i;
+        for (idx_t j = i + 1; j < n; ++j)
+            if (d[j] > d[imax]) imax = j;
+        if (imax != i) {
+            std::swap(d[i], d[imax]);
+            auto ui = col(Ub, i);
+            auto uimax = col(Ub, imax);
+            tlapack::swap(ui, uimax);
+            auto vi = row(Vb, i);
+            auto vimax = row(Vb, imax);
+            tlapack::swap(vi, vimax);
+        }
+    }
+
+    // If B is lower bidiagonal, B = Vb^T * S * Ub^T
+    const Op opU = (uplo == Uplo::Upper) ? Op::NoTrans : Op::Trans;
+    auto& Q = (uplo == Uplo::Upper) ? Ub : Vb;
+    auto& Pt = (uplo == Uplo::Upper) ? Vb : Ub;
+
+    // U = U * Q
+    if (want_u) {
+        const idx_t nu = nrows(U);
+        auto U0 = slice(U, range{0, nu}, range{0, n});
+        auto W_ = workspace_arena<T>().get(WorkInfo(nu, n));
+        auto W = new_matrix(W_.vector(), nu, n);
+        gemm(NO_TRANS, opU, one, U0, Q, W);
+        lacpy(GENERAL, W, U0);
+    }
+
+    // Vt = P^T * Vt
+    if (want_vt) {
+        const idx_t nvt = ncols(Vt);
+        auto Vt0 = slice(Vt, range{0, n}, range{0, nvt});
+        auto W_ = workspace_arena<T>().get(WorkInfo(n, nvt));
+        auto W = new_matrix(W_.vector(), n, nvt);
+        gemm(opU, NO_TRANS, one, Pt, Vt0, W);
+        lacpy(GENERAL, W, Vt0);
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BDSDC_HH
@@ -0,0 +1,96 @@
+/// @file gebak.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zgebak.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GEBAK_HH
+#define TLAPACK_GEBAK_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/scal.hpp"
+#include "tlapack/blas/swap.hpp"
+
+namespace tlapack {
+
+/** Forms the right or left eigenvectors of a general matrix by backward
+ * transformation on the computed eigenvectors of the balanced matrix output
+ * by gebal().
+ *
+ * @return 0 if success.
+ *
+ * @param[in] want_permute bool.
+ *      Must be the same value passed to gebal().
+ * @param[in] want_scale bool.
+ *      Must be the same value passed to gebal().
+ * @param[in] side Specifies whether V contains right or left eigenvectors.
+ *      - Side::Right: V contains right eigenvectors;
+ *      - Side::Left:  V contains left eigenvectors.
+ * @param[in] ilo integer.
+ * @param[in] ihi integer.
+ *      The integers ilo and ihi determined by gebal().
+ * @param[in] scale Real vector of length n.
+ *      Details of the permutation and scaling factors, as returned by gebal().
+ * @param[in,out] V n-by-m matrix.
+ *      On entry, the matrix of right or left eigenvectors to be transformed.
+ *      On exit, V is overwritten by the transformed eigenvectors.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SVECTOR scale_t,
+          TLAPACK_SIDE side_t>
+int gebak(bool want_permute,
+          bool want_scale,
+          side_t side,
+          size_type<matrix_t> ilo,
+          size_type<matrix_t> ihi,
+          const scale_t& scale,
+          matrix_t& V)
+{
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<type_t<scale_t>>;
+
+    // constants
+    const real_t one(1);
+    const idx_t n = nrows(V);
+
+    // check arguments
+    tlapack_check(side == Side::Left || side == Side::Right);
+    tlapack_check(ilo <= ihi && ihi <= n);
+    tlapack_check((idx_t)size(scale) >= n);
+
+    // quick return
+    if (n == 0 || ncols(V) == 0) return 0;
+
+    // Backward balance
+    if (want_scale && ilo + 1 < ihi) {
+        for (idx_t i = ilo; i < ihi; ++i) {
+            auto vi = row(V, i);
+            scal((side == Side::Right) ? scale[i] : one / scale[i], vi);
+        }
+    }
+
+    // Backward permutation
+    if (want_permute) {
+        for (idx_t ii = 0; ii < n; ++ii) {
+            if (ii >= ilo && ii < ihi) continue;
+            const idx_t i = (ii < ilo) ? ilo - 1 - ii : ii;
+            const idx_t k = idx_t(scale[i]);
+            if (k == i) continue;
+            auto vi = row(V, i);
+            auto vk = row(V, k);
+            tlapack::swap(vi, vk);
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GEBAK_HH
@@ -0,0 +1,224 @@
+/// @file gebal.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zgebal.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GEBAL_HH
+#define TLAPACK_GEBAL_HH
+
+#include "tlapack/base/constants.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/iamax.hpp"
+#include "tlapack/blas/nrm2.hpp"
+#include "tlapack/blas/scal.hpp"
+#include "tlapack/blas/swap.hpp"
+
+namespace tlapack {
+
+/** Balances a general square matrix A.
+ *
+ * This involves, first, permuting A by a similarity transformation to isolate
+ * eigenvalues in the first 0:ilo and last ihi:n elements on the diagonal of
+ * A; and second, applying a diagonal similarity transformation to rows and
+ * columns ilo:ihi to make the rows and columns as close in norm as possible.
+ * Both steps are optional.
+ *
+ * Balancing may reduce the 1-norm of the matrix, and improve the accuracy of
+ * the computed eigenvalues and/or eigenvectors.
+ *
+ * @return 0 if success.
+ * @return -1 if a NaN was found in A.
+ *
+ * @param[in] want_permute bool.
+ *      If true, permute A to isolate eigenvalues.
+ * @param[in] want_scale bool.
+ *      If true, scale A to make the norms of its rows and columns close.
+ * @param[in,out] A n-by-n matrix.
+ *      On exit, A is overwritten by the balanced matrix.
+ * @param[out] ilo integer.
+ * @param[out] ihi integer.
+ *      On exit, A(i,j) = 0 if i > j and j = 0:ilo or i = ihi:n. If
+ *      want_permute is false, ilo = 0 and ihi = n.
+ * @param[out] scale Real vector of length n.
+ *      Details of the permutations and scaling factors applied to A. If p[j]
+ *      is the index of the row and column interchanged with row and column j
+ *      and d[j] is the scaling factor applied to row and column j, then
+ *      - scale[j] = p[j] for j = 0:ilo,
+ *      - scale[j] = d[j] for j = ilo:ihi,
+ *      - scale[j] = p[j] for j = ihi:n.
+ *      The order in which the interchanges are made is n-1 to ihi, then 0 to
+ *      ilo-1.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t, TLAPACK_SVECTOR scale_t>
+int gebal(bool want_permute,
+          bool want_scale,
+          matrix_t& A,
+          size_type<matrix_t>& ilo,
+          size_type<matrix_t>& ihi,
+          scale_t& scale)
+{
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<type_t<matrix_t>>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const real_t radix(2);
+    const real_t factor(0.95);
+    const idx_t n = ncols(A);
+
+    // check arguments
+    tlapack_check(nrows(A) == n);
+    tlapack_check((idx_t)size(scale) >= n);
+
+    // quick return
+    ilo = 0;
+    ihi = n;
+    if (n == 0) return 0;
+
+    // Rows and columns k:l are not yet isolated
+    idx_t k = 0;
+    idx_t l = n;
+
+    if (want_permute) {
+        // Search for rows isolating an eigenvalue and push them down
+        for (bool noconv = true; noconv;) {
+            noconv = false;
+            for (idx_t i = l - 1; i != idx_t(-1); --i) {
+                bool canswap = true;
+                for (idx_t j = 0; j < l; ++j) {
+                    if (i != j && A(i, j) != zero) {
+                        canswap = false;
+                        break;
+                    }
+                }
+                if (canswap) {
+                    scale[l - 1] = real_t(i);
+                    if (i != l - 1) {
+                        auto ai = slice(A, range{0, l}, i);
+                        auto al = slice(A, range{0, l}, l - 1);
+                        tlapack::swap(ai, al);
+                        auto ri = slice(A, i, range{k, n});
+                        auto rl = slice(A, l - 1, range{k, n});
+                        tlapack::swap(ri, rl);
+                    }
+                    noconv = true;
+                    if (l == 1) {
+                        ihi = 1;
+                        return 0;
+                    }
+                    --l;
+                }
+            }
+        }
+
+        // Search for columns isolating an eigenvalue and push them left
+        for (bool noconv = true; noconv;) {
+            noconv = false;
+            for (idx_t j = k; j < l; ++j) {
+                bool canswap = true;
+                for (idx_t i = k; i < l; ++i) {
+                    if (i != j && A(i, j) != zero) {
+                        canswap = false;
+                        break;
+                    }
+                }
+                if (canswap) {
+                    scale[k] = real_t(j);
+                    if (j != k) {
+                        auto aj = slice(A, range{0, l}, j);
+                        auto ak = slice(A, range{0, l}, k);
+                        tlapack::swap(aj, ak);
+                        auto rj = slice(A, j, range{k, n});
+                        auto rk = slice(A, k, range{k, n});
+                        tlapack::swap(rj, rk);
+                    }
+                    noconv = true;
+                    ++k;
+                }
+            }
+        }
+    }
+
+    // Initialize scale for the non-permuted submatrix
+    for (idx_t i = k; i < l; ++i)
+        scale[i] = one;
+
+    ilo = k;
+    ihi = l;
+    if (!want_scale) return 0;
+
+    // Balance the submatrix in rows k to l
+    const real_t sfmin1 = safe_min<real_t>() / ulp<real_t>();
+    const real_t sfmax1 = one / sfmin1;
+    const real_t sfmin2 = sfmin1 * radix;
+    const real_t sfmax2 = one / sfmin2;
+
+    for (bool noconv = true; noconv;) {
+        noconv = false;
+        for (idx_t i = k; i < l; ++i) {
+            auto ci = slice(A, range{k, l}, i);
+            auto ri = slice(A, i, range{k, l});
+            real_t c = nrm2(ci);
+            real_t r = nrm2(ri);
+
+            auto ai = slice(A, range{0, l}, i);
+            auto ui = slice(A, i, range{k, n});
+            real_t ca = abs(ai[iamax(ai)]);
+            real_t ra = abs(ui[iamax(ui)]);
+
+            // Guard against zero c or r due to underflow
+            if (c == zero || r == zero) continue;
+
+            // Exit if NaN to avoid infinite loop
+            if (isnan(c + ca + r + ra)) return -1;
+
+            real_t g = r / radix;
+            real_t f = one;
+            const real_t s = c + r;
+            while (c < g && max(f, max(c, ca)) < sfmax2 &&
+                   min(r, min(g, ra)) > sfmin2) {
+                f *= radix;
+                c *= radix;
+                ca *= radix;
+                r /= radix;
+                g /= radix;
+                ra /= radix;
+            }
+            g = c / radix;
+            while (g >= r && max(r, ra) < sfmax2 &&
+                   min(min(f, c), min(g, ca)) > sfmin2) {
+                f /= radix;
+                c /= radix;
+                g /= radix;
+                ca /= radix;
+                r *= radix;
+                ra *= radix;
+            }
+
+            // Now balance
+            if (c + r >= factor * s) continue;
+            if (f < one && scale[i] < one && f * scale[i] <= sfmin1) continue;
+            if (f > one && scale[i] > one && scale[i] >= sfmax1 / f) continue;
+
+            scale[i] *= f;
+            noconv = true;
+            scal(one / f, ui);
+            scal(f, ai);
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GEBAL_HH
@@ -210,10 +210,10 @@ int gebrd(matrix_t& A,
     // Functor
     Create<work_t> new_matrix;
 
-    // Allocates workspace
+    // Gets workspace from the arena
     WorkInfo workinfo = gebrd_worksize<T>(A, tauv, tauw, opts);
-    std::vector<T> work_;
-    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+    auto work_ = workspace_arena<T>().get(workinfo);
+    auto work = new_matrix(work_.vector(), workinfo.m, workinfo.n);
 
     return gebrd_work(A, tauv, tauw, work, opts);
 }
@@ -0,0 +1,364 @@
+/// @file geev.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dgeev.f
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zgeev.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GEEV_HH
+#define TLAPACK_GEEV_HH
+
+#include "tlapack/base/constants.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/iamax.hpp"
+#include "tlapack/blas/nrm2.hpp"
+#include "tlapack/blas/rot.hpp"
+#include "tlapack/blas/scal.hpp"
+#include "tlapack/lapack/gebak.hpp"
+#include "tlapack/lapack/gebal.hpp"
+#include "tlapack/lapack/gehrd.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/lange.hpp"
+#include "tlapack/lapack/lapy2.hpp"
+#include "tlapack/lapack/lascl.hpp"
+#include "tlapack/lapack/multishift_qr.hpp"
+#include "tlapack/lapack/trevc3.hpp"
+#include "tlapack/lapack/unghr.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for geev
+ */
+struct GeevOpts : public FrancisOpts {
+    bool balance = true;  ///< Permute and scale A with gebal() before the
+                          ///< reduction to Hessenberg form
+    size_t nb = 32;       ///< Block size used in gehrd() and trevc3()
+};
+
+/** Worspace query of geev()
+ *
+ * @param[in] want_vl bool
+ * @param[in] want_vr bool
+ * @param[in] A n-by-n matrix.
+ * @param[in] w Complex vector of length n.
+ * @param[in] VL n-by-n matrix.
+ * @param[in] VR n-by-n matrix.
+ *
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T,
+          TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SVECTOR vector_t,
+          enable_if_t<is_complex<type_t<vector_t>>, int> = 0>
+WorkInfo geev_worksize(bool want_vl,
+                       bool want_vr,
+                       const matrix_t& A,
+                       const vector_t& w,
+                       const matrix_t& VL,
+                       const matrix_t& VR,
+                       const GeevOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+
+    const idx_t n = ncols(A);
+    const bool want_z = want_vl || want_vr;
+
+    WorkInfo workinfo;
+    if constexpr (is_same_v<T, type_t<matrix_t>>) {
+        if (n > 0) {
+            // Vector tau
+            workinfo = WorkInfo(n);
+
+            auto&& tau = slice(A, range{0, n}, 0);
+            auto&& Z = want_vl ? VL : VR;
+
+            GehrdOpts gehrdOpts;
+            gehrdOpts.nb = opts.nb;
+            Trevc3Opts trevcOpts;
+            trevcOpts.nb = opts.nb;
+
+            WorkInfo workinfo2 = gehrd_worksize<T>(0, n, A, tau, gehrdOpts);
+            if (want_z) {
+                workinfo2.minMax(unghr_worksize<T>(0, n, Z, tau));
+                workinfo2.minMax(
+                    trevc3_worksize<T>(want_vl, want_vr, A, VL, VR, trevcOpts));
+            }
+            workinfo2.minMax(multishift_qr_worksize<T>(true, want_z, 0, n, A, w,
+                                                       want_z ? Z : A, opts));
+
+            workinfo += workinfo2;
+        }
+    }
+
+    return workinfo;
+}
+
+/** @copybrief geev()
+ * Workspace is provided as an argument.
+ * @copydetails geev()
+ *
+ * @param[out] scale Real vector of length n.
+ *      Details of the balancing of A, as returned by gebal().
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SVECTOR vector_t,
+          TLAPACK_SVECTOR scale_t,
+          TLAPACK_WORKSPACE work_t,
+          enable_if_t<is_complex<type_t<vector_t>>, int> = 0>
+int geev_work(bool want_vl,
+              bool want_vr,
+              matrix_t& A,
+              vector_t& w,
+              matrix_t& VL,
+              matrix_t& VR,
+              scale_t& scale,
+              work_t& work,
+              const GeevOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using TA = type_t<matrix_t>;
+    using real_t = real_type<TA>;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const idx_t n = ncols(A);
+    const bool want_z = want_vl || want_vr;
+
+    // check arguments
+    tlapack_check(nrows(A) == n);
+    tlapack_check((idx_t)size(w) == n);
+    tlapack_check((idx_t)size(scale) >= n);
+    if (want_vl) tlapack_check(nrows(VL) == n && ncols(VL) == n);
+    if (want_vr) tlapack_check(nrows(VR) == n && ncols(VR) == n);
+
+    // quick return
+    if (n == 0) return 0;
+
+    // Scale A if max element outside range [smlnum,bignum]
+    const real_t smlnum = sqrt(safe_min<real_t>()) / ulp<real_t>();
+    const real_t bignum = one / smlnum;
+    const real_t anrm = lange(MAX_NORM, A);
+    real_t sigma = one;
+    if (anrm > zero && anrm < smlnum)
+        sigma = smlnum / anrm;
+    else if (anrm > bignum)
+        sigma = bignum / anrm;
+    if (sigma != one) lascl(GENERAL, anrm, anrm * sigma, A);
+
+    // Balance the matrix
+    idx_t ilo, ihi;
+    if (gebal(opts.balance, opts.balance, A, ilo, ihi, scale) != 0) return -1;
+
+    // Reduce to upper Hessenberg form. unghr() needs n entries in tau.
+    auto [tau, work2] = reshape(work, n);
+    {
+        GehrdOpts gehrdOpts;
+        gehrdOpts.nb = opts.nb;
+        gehrd_work(ilo, ihi, A, tau, work2, gehrdOpts);
+    }
+
+    // Form the Schur vectors in VL or in VR
+    matrix_t& Z = want_vl ? VL : VR;
+    if (want_z) {
+        lacpy(LOWER_TRIANGLE, A, Z);
+        unghr_work(ilo, ihi, Z, tau, work2);
+    }
+
+    // Remove the reflectors below the subdiagonal of A
+    for (idx_t j = 0; j + 2 < n; ++j)
+        for (idx_t i = j + 2; i < n; ++i)
+            A(i, j) = zero;
+
+    // Eigenvalues isolated by gebal
+    for (idx_t i = 0; i < ilo; ++i)
+        w[i] = A(i, i);
+    for (idx_t i = ihi; i < n; ++i)
+        w[i] = A(i, i);
+
+    // Compute the Schur form of A and, optionally, the Schur vectors
+    FrancisOpts francisOpts = opts;
+    int info = multishift_qr_work(want_z, want_z, ilo, ihi, A, w,
+                                  want_z ? Z : A, work2, francisOpts);
+
+    if (want_z && info == 0) {
+        if (want_vl && want_vr) lacpy(GENERAL, VL, VR);
+
+        // Compute the eigenvectors
+        Trevc3Opts trevcOpts;
+        trevcOpts.nb = opts.nb;
+        trevc3_work(want_vl, want_vr, A, VL, VR, work2, trevcOpts);
+
+        // Undo the balancing and normalize the eigenvectors so that their
+        // Euclidean norm is 1 and their largest component is real
+        for (int side = 0; side < 2; ++side) {
+            if (side == 0 && !want_vr) continue;
+            if (side == 1 && !want_vl) continue;
+            matrix_t& V = (side == 0) ? VR : VL;
+            gebak(opts.balance, opts.balance,
+                  (side == 0) ? Side::Right : Side::Left, ilo, ihi, scale, V);
+
+            for (idx_t j = 0; j < n; ++j) {
+                auto v = col(V, j);
+                if constexpr (is_complex<TA>) {
+                    scal(one / nrm2(v), v);
+                    idx_t k = 0;
+                    real_t vmax = zero;
+                    for (idx_t i = 0; i < n; ++i) {
+                        const real_t vi = abs(v[i]);
+                        if (vi > vmax) {
+                            vmax = vi;
+                            k = i;
+                        }
+                    }
+                    if (vmax > zero) {
+                        scal(conj(v[k]) / vmax, v);
+                        v[k] = real(v[k]);
+                    }
+                }
+                else {
+                    if (j + 1 < n && A(j + 1, j) != zero) {
+                        // Complex conjugate pair
+                        auto vi = col(V, j + 1);
+                        const real_t nrm = lapy2(nrm2(v), nrm2(vi));
+                        scal(one / nrm, v);
+                        scal(one / nrm, vi);
+                        idx_t k = 0;
+                        real_t vmax = zero;
+                        for (idx_t i = 0; i < n; ++i) {
+                            const real_t s = v[i] * v[i] + vi[i] * vi[i];
+                            if (s > vmax) {
+                                vmax = s;
+                                k = i;
+                            }
+                        }
+                        const real_t r = lapy2(v[k], vi[k]);
+                        if (r > zero) {
+                            rot(v, vi, v[k] / r, vi[k] / r);
+                            vi[k] = zero;
+                        }
+                        ++j;
+                    }
+                    else
+                        scal(one / nrm2(v), v);
+                }
+            }
+        }
+    }
+
+    // Undo the scaling of the eigenvalues
+    if (sigma != one) {
+        for (idx_t i = 0; i < n; ++i)
+            w[i] /= sigma;
+    }
+
+    return info;
+}
+
+/** Computes the eigenvalues and, optionally, the left and/or right
+ * eigenvectors of a general n-by-n matrix A.
+ *
+ * The right eigenvector v(j) of A satisfies
+ * \[
+ *      A * v(j) = lambda(j) * v(j)
+ * \]
+ * where lambda(j) is its eigenvalue. The left eigenvector u(j) of A satisfies
+ * \[
+ *      u(j)^H * A = lambda(j) * u(j)^H
+ * \]
+ * where u(j)^H denotes the conjugate-transpose of u(j).
+ *
+ * The matrix is balanced with gebal() and reduced to upper Hessenberg form
+ * with gehrd(). The Schur form is computed by multishift_qr(), and the
+ * eigenvectors are computed from the Schur form by trevc3().
+ *
+ * The computed eigenvectors are normalized to have Euclidean norm equal to 1
+ * and largest component real. If A is real, each complex conjugate pair of
+ * eigenvalues, with the positive imaginary part first, uses two consecutive
+ * columns j and j+1 of VL and VR: v(j) = VR(:,j) + i*VR(:,j+1) and
+ * v(j+1) = VR(:,j) - i*VR(:,j+1), and similarly for VL.
+ *
+ * @return 0 if success.
+ * @return i > 0 if the QR algorithm failed to compute all the eigenvalues, and
+ *      no eigenvectors have been computed; elements i:ihi of w contain those
+ *      eigenvalues which have converged.
+ * @return -1 if A contains NaNs.
+ *
+ * @param[in] want_vl bool.
+ *      If true, the left eigenvectors of A are computed.
+ * @param[in] want_vr bool.
+ *      If true, the right eigenvectors of A are computed.
+ * @param[in,out] A n-by-n matrix.
+ *      On entry, the n-by-n matrix A.
+ *      On exit, A has been overwritten.
+ * @param[out] w Complex vector of length n.
+ *      The computed eigenvalues.
+ * @param[out] VL n-by-n matrix.
+ *      If want_vl is true, the left eigenvectors u(j) are stored one after
+ *      another in the columns of VL, in the same order as their eigenvalues.
+ *      Not referenced otherwise.
+ * @param[out] VR n-by-n matrix.
+ *      If want_vr is true, the right eigenvectors v(j) are stored one after
+ *      another in the columns of VR, in the same order as their eigenvalues.
+ *      Not referenced otherwise.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.balance: Balance A before computing the eigenvalues.
+ *      - @c opts.nb: Block size for gehrd() and trevc3().
+ *      - Options of multishift_qr() inherited from FrancisOpts.
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SVECTOR vector_t,
+          enable_if_t<is_complex<type_t<vector_t>>, int> = 0>
+int geev(bool want_vl,
+         bool want_vr,
+         matrix_t& A,
+         vector_t& w,
+         matrix_t& VL,
+         matrix_t& VR,
+         const GeevOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using TA = type_t<matrix_t>;
+    using real_t = real_type<TA>;
+
+    // Functors
+    Create<matrix_t> new_matrix;
+    Create<vector_type<matrix_t>> new_vector;
+
+    // constants
+    const idx_t n = ncols(A);
+
+    // quick return
+    if (n == 0) return 0;
+
+    // Gets workspace from the arena
+    WorkInfo workinfo = geev_worksize<TA>(want_vl, want_vr, A, w, VL, VR, opts);
+    auto work_ = workspace_arena<TA>().get(workinfo);
+    auto work = new_matrix(work_.vector(), workinfo.m, workinfo.n);
+
+    auto scale_ = workspace_arena<real_t>().get(n);
+    auto scale = new_vector(scale_.vector(), n);
+
+    return geev_work(want_vl, want_vr, A, w, VL, VR, scale, work, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GEEV_HH
@@ -238,10 +238,10 @@ int gehrd(size_type<matrix_t> ilo,
     // quick return
     if (n <= 0) return 0;
 
-    // Allocates workspace
+    // Gets workspace from the arena
     WorkInfo workinfo = gehrd_worksize<T>(ilo, ihi, A, tau, opts);
-    std::vector<T> work_;
-    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+    auto work_ = workspace_arena<T>().get(workinfo);
+    auto work = new_matrix(work_.vector(), workinfo.m, workinfo.n);
 
     return gehrd_work(ilo, ihi, A, tau, work, opts);
 }
@@ -0,0 +1,148 @@
+/// @file gemm_blocked_mixed.hpp
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GEMM_BLOCKED_MIXED_HH
+#define TLAPACK_GEMM_BLOCKED_MIXED_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for gemm_blocked_mixed
+ */
+struct GemmBlockedOpts {
+    size_t nb = 32;  ///< Block size
+};
+
+/**
+ * General matrix-matrix multiply using a blocked algorithm:
+ * \[
+ *     C := \alpha op(A) \times op(B) + \beta C,
+ * \]
+ * where $op(X)$ is one of
+ *     $op(X) = X$,
+ *     $op(X) = X^T$, or
+ *     $op(X) = X^H$,
+ * with $op(A)$ an m-by-k matrix, $op(B)$ a k-by-n matrix, and C an m-by-n
+ * matrix.
+ *
+ * In iteration l, the algorithm computes $C += \alpha op(A)_l op(B)_l$, where
+ * $op(A)_l$ is the l-th block of nb columns of $op(A)$ and $op(B)_l$ is the
+ * l-th block of nb rows of $op(B)$. $op(B)_l$ is cast to the precision type of
+ * `work`, enabling mixed precision. The products are accumulated in the
+ * precision of C.
+ *
+ * @param[in] transA
+ *     The operation $op(A)$ to be used:
+ *     - Op::NoTrans:   $op(A) = A$.
+ *     - Op::Trans:     $op(A) = A^T$.
+ *     - Op::ConjTrans: $op(A) = A^H$.
+ *
+ * @param[in] transB
+ *     The operation $op(B)$ to be used:
+ *     - Op::NoTrans:   $op(B) = B$.
+ *     - Op::Trans:     $op(B) = B^T$.
+ *     - Op::ConjTrans: $op(B) = B^H$.
+ *
+ * @param[in] alpha Scalar.
+ * @param[in] A $op(A)$ is an m-by-k matrix.
+ * @param[in] B $op(B)$ is an k-by-n matrix.
+ * @param[in] beta Scalar.
+ * @param[in,out] C A m-by-n matrix.
+ * @param work Workspace that also informs the precision type to cast B.
+ *     - If transB = NoTrans: a nb-by-n matrix.
+ *     - Otherwise: a n-by-nb matrix.
+ * @param[in] opts Options.
+ *
+ * @ingroup blas3
+ */
+template <TLAPACK_OP opA_t,
+          TLAPACK_OP opB_t,
+          TLAPACK_SMATRIX matrixA_t,
+          TLAPACK_SMATRIX matrixB_t,
+          TLAPACK_SMATRIX matrixC_t,
+          TLAPACK_SCALAR alpha_t,
+          TLAPACK_SCALAR beta_t,
+          TLAPACK_WORKSPACE work_t>
+void gemm_blocked_mixed(opA_t transA,
+                        opB_t transB,
+                        const alpha_t& alpha,
+                        const matrixA_t& A,
+                        const matrixB_t& B,
+                        const beta_t& beta,
+                        matrixC_t& C,
+                        work_t& work,
+                        const GemmBlockedOpts& opts = {})
+{
+    // data traits
+    using idx_t = size_type<matrixA_t>;
+    using range = std::pair<idx_t, idx_t>;
+    using scalar_t = scalar_type<beta_t, type_t<matrixC_t>>;
+
+    // constants
+    const scalar_t one(1);
+    const idx_t m = nrows(C);
+    const idx_t n = ncols(C);
+    const idx_t k = (transA == Op::NoTrans) ? ncols(A) : nrows(A);
+    const idx_t nb = min((idx_t)opts.nb, k);
+
+    // check arguments
+    tlapack_check_false(transA != Op::NoTrans && transA != Op::Trans &&
+                        transA != Op::ConjTrans);
+    tlapack_check_false(transB != Op::NoTrans && transB != Op::Trans &&
+                        transB != Op::ConjTrans);
+    tlapack_check_false(((transA == Op::NoTrans) ? nrows(A) : ncols(A)) != m);
+    tlapack_check_false(((transB == Op::NoTrans) ? ncols(B) : nrows(B)) != n);
+    tlapack_check_false(((transB == Op::NoTrans) ? nrows(B) : ncols(B)) != k);
+
+    // Quick return
+    if (m <= 0 || n <= 0) return;
+    if (k <= 0) {
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                C(i, j) *= beta;
+        return;
+    }
+
+    // Matrix W
+    auto [W, work1] = (transB == Op::NoTrans) ? reshape(work, nb, n)
+                                              : reshape(work, n, nb);
+
+    for (idx_t l = 0; l < k; l += nb) {
+        const idx_t lb = min(nb, k - l);
+        const scalar_t beta_l = (l == 0) ? scalar_t(beta) : one;
+
+        const auto Al = (transA == Op::NoTrans)
+                            ? slice(A, range(0, m), range(l, l + lb))
+                            : slice(A, range(l, l + lb), range(0, m));
+
+        if (transB == Op::NoTrans) {
+            const auto Bl = rows(B, range(l, l + lb));
+            auto BlLowPrecision = rows(W, range(0, lb));
+
+            // C = alpha * op(A)_l * B_l + beta_l * C in mixed precision
+            lacpy(GENERAL, Bl, BlLowPrecision);
+            gemm(transA, transB, alpha, Al, BlLowPrecision, beta_l, C);
+        }
+        else {
+            const auto Bl = cols(B, range(l, l + lb));
+            auto BlLowPrecision = cols(W, range(0, lb));
+
+            // C = alpha * op(A)_l * op(B_l) + beta_l * C in mixed precision
+            lacpy(GENERAL, Bl, BlLowPrecision);
+            gemm(transA, transB, alpha, Al, BlLowPrecision, beta_l, C);
+        }
+    }
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GEMM_BLOCKED_MIXED_HH
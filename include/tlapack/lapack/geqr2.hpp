@@ -18,6 +18,104 @@
 
 namespace tlapack {
 
+namespace internal {
+
+    /**
+     * Householder QR factorization of W interleaved m-by-n matrices.
+     *
+     * Follows geqr2() and larfg(). The scalar factor of the j-th reflector of
+     * lane l is stored in tau[j*W + l]. On exit, rescale[l] is true if a
+     * reflector of lane l needed the rescaling of larfg() to avoid underflow.
+     * The output of such lanes must be discarded.
+     *
+     * @tparam M, N Extents of the matrices if known at compile time, or -1.
+     *      When known, they replace m and n as the loop bounds.
+     */
+    template <int W, int M = -1, int N = -1, class T, class idx_t>
+    void geqrf_interleaved(idx_t m_, idx_t n_, T* X, T* tau, bool* rescale)
+    {
+        using real_t = real_type<T>;
+
+        // constants
+        const idx_t m = (M >= 0) ? idx_t(M) : m_;
+        const idx_t n = (N >= 0) ? idx_t(N) : n_;
+        const idx_t k = min(m, n);
+        const real_t zero(0);
+        const real_t one(1);
+        const real_t safemin = safe_min<real_t>() / uroundoff<real_t>();
+
+        for (int l = 0; l < W; ++l)
+            rescale[l] = false;
+
+        for (idx_t j = 0; j < k; ++j) {
+            T* Xj = X + j * m * W;
+
+            // 2-norm of A(j+1:m-1,j), with scaling to avoid overflow
+            real_t scl[W], ssq[W];
+            for (int l = 0; l < W; ++l) {
+                scl[l] = zero;
+                ssq[l] = zero;
+            }
+            for (idx_t i = j + 1; i < m; ++i)
+                for (int l = 0; l < W; ++l)
+                    scl[l] = max(scl[l], abs1(Xj[i * W + l]));
+            for (int l = 0; l < W; ++l)
+                if (scl[l] == zero) scl[l] = one;
+            for (idx_t i = j + 1; i < m; ++i)
+                for (int l = 0; l < W; ++l) {
+                    const real_t xr = real(Xj[i * W + l]) / scl[l];
+                    const real_t xi = imag(Xj[i * W + l]) / scl[l];
+                    ssq[l] += xr * xr + xi * xi;
+                }
+
+            // generate the elementary reflectors
+            T t[W], f[W];
+            for (int l = 0; l < W; ++l) {
+                const T alpha = Xj[j * W + l];
+                const real_t xnorm = scl[l] * sqrt(ssq[l]);
+                t[l] = zero;
+                f[l] = one;
+                if (xnorm > zero || imag(alpha) != zero) {
+                    const real_t ar = real(alpha);
+                    const real_t ai = imag(alpha);
+                    const real_t w = max(max(abs(ar), abs(ai)), xnorm);
+                    const real_t temp =
+                        w * sqrt((ar / w) * (ar / w) + (ai / w) * (ai / w) +
+                                 (xnorm / w) * (xnorm / w));
+                    const real_t beta = (ar < zero) ? temp : -temp;
+                    if (abs(beta) < safemin) rescale[l] = true;
+                    t[l] = (beta - alpha) / beta;
+                    f[l] = one / (alpha - beta);
+                    Xj[j * W + l] = beta;
+                }
+                tau[j * W + l] = t[l];
+            }
+            for (idx_t i = j + 1; i < m; ++i)
+                for (int l = 0; l < W; ++l)
+                    Xj[i * W + l] *= f[l];
+
+            // apply H^H = I - conj(tau) v v^H to A(j:m-1,j+1:n-1)
+            for (idx_t c = j + 1; c < n; ++c) {
+                T* Xc = X + c * m * W;
+                T w[W];
+                for (int l = 0; l < W; ++l)
+                    w[l] = Xc[j * W + l];
+                for (idx_t i = j + 1; i < m; ++i)
+                    for (int l = 0; l < W; ++l)
+                        w[l] += conj(Xj[i * W + l]) * Xc[i * W + l];
+                for (int l = 0; l < W; ++l) {
+                    w[l] *= conj(t[l]);
+                    Xc[j * W + l] -= w[l];
+                }
+                for (idx_t i = j + 1; i < m; ++i)
+                    for (int l = 0; l < W; ++l)
+                        Xc[i * W + l] -= Xj[i * W + l] * w[l];
+            }
+        }
+    }
+
+}  // namespace internal
+
 /** Worspace query of geqr2()
  *
  * @param[in] A m-by-n matrix.
@@ -126,6 +224,10 @@ int geqr2_work(matrix_t& A, vector_t& tau, work_t& work)
  * @param[out] tau Real vector of length min(m,n).
  *      The scalar factors of the elementary reflectors.
  *
+ * @note If the extents of A are known at compile time, the factorization is
+ * computed on a copy of A in the stack, with constant loop bounds, and no
+ * workspace is allocated.
+ *
  * @ingroup alloc_workspace
  */
 template <TLAPACK_SMATRIX matrix_t, TLAPACK_VECTOR vector_t>
@@ -144,12 +246,42 @@ int geqr2(matrix_t& A, vector_t& tau)
     // quick return
     if (n <= 0 || m <= 0) return 0;
 
-    // Allocates workspace
-    WorkInfo workinfo = geqr2_worksize<T>(A, tau);
-    std::vector<T> work_;
-    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+    // Tiny matrices with compile-time extents are factored in a local copy
+    if constexpr (has_small_static_extents<matrix_t>) {
+        constexpr idx_t M = static_nrows<matrix_t>;
+        constexpr idx_t N = static_ncols<matrix_t>;
+        constexpr idx_t K = (M < N) ? M : N;
+
+        T a[M * N], t[K];
+        for (idx_t j = 0; j < N; ++j)
+            for (idx_t i = 0; i < M; ++i)
+                a[i + j * M] = A(i, j);
+
+        bool rescale;
+        internal::geqrf_interleaved<1, int(M), int(N)>(M, N, a, t, &rescale);
 
-    return geqr2_work(A, tau, work);
+        if (!rescale) {
+            for (idx_t j = 0; j < N; ++j)
+                for (idx_t i = 0; i < M; ++i)
+                    A(i, j) = a[i + j * M];
+            for (idx_t j = 0; j < K; ++j)
+                tau[j] = t[j];
+            return 0;
+        }
+
+        // Reflectors that need rescaling use the workspace in the stack
+        T work_[N];
+        auto work = CreateStatic<matrix_t, N, 1>()(work_);
+        return geqr2_work(A, tau, work);
+    }
+    else {
+        // Allocates workspace
+        WorkInfo workinfo = geqr2_worksize<T>(A, tau);
+        std::vector<T> work_;
+        auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+        return geqr2_work(A, tau, work);
+    }
 }
 
 }  // namespace tlapack
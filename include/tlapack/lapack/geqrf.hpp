@@ -161,10 +161,10 @@ int geqrf(A_t& A, tau_t& tau, const GeqrfOpts& opts = {})
     using T = type_t<work_t>;
     Create<work_t> new_matrix;
 
-    // Allocate or get workspace
+    // Get workspace from the arena
     WorkInfo workinfo = geqrf_worksize<T>(A, tau, opts);
-    std::vector<T> work_;
-    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+    auto work_ = workspace_arena<T>().get(workinfo);
+    auto work = new_matrix(work_.vector(), workinfo.m, workinfo.n);
 
     return geqrf_work(A, tau, work, opts);
 }
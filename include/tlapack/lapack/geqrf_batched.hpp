@@ -0,0 +1,97 @@
+/// @file geqrf_batched.hpp Computes the QR factorizations of a batch of small
+/// matrices.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GEQRF_BATCHED_HH
+#define TLAPACK_GEQRF_BATCHED_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/BatchedOpts.hpp"
+#include "tlapack/lapack/geqr2.hpp"
+
+namespace tlapack {
+
+/** Computes the QR factorizations of a batch of small matrices.
+ *
+ * Each matrix A[b] of the batch is factored as in geqr2(),
+ * \[
+ *   A_b = Q_b R_b.
+ * \]
+ * Groups of internal::batch_lanes<T> matrices are copied to an interleaved
+ * buffer and factored together, so that the innermost loops run over the
+ * batch. The groups are distributed among OpenMP threads.
+ *
+ * Matrices whose reflectors need rescaling to avoid underflow are factored
+ * again with geqr2().
+ *
+ * @return 0 if success.
+ *
+ * @param[in,out] A Strided or pointer-array batch of m-by-n matrices.
+ *      On exit, R and the Householder reflectors of each matrix, as in
+ *      geqr2().
+ *
+ * @param[out] tau Array of length k*A.size() where k=min(m,n).
+ *      The scalar factors of the reflectors of A[b] are stored in tau[b*k],
+ *      ..., tau[b*k+k-1].
+ *
+ * @param[in] opts Options.
+ *
+ * @ingroup computational
+ */
+template <class batch_t>
+int geqrf_batched(batch_t& A,
+                  type_t<typename batch_t::matrix_type>* tau,
+                  const BatchedOpts& opts = {})
+{
+    using matrix_t = typename batch_t::matrix_type;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    constexpr int W = internal::batch_lanes<T>;
+
+    // constants
+    const idx_t m = A.m;
+    const idx_t n = A.n;
+    const idx_t k = min(m, n);
+    const idx_t count = A.size();
+
+    // quick return
+    if (count <= 0 || m <= 0 || n <= 0) return 0;
+
+    internal::batch_for_each_group<W, T>(
+        count, opts,
+        [&](idx_t b0, idx_t nb, std::vector<T>& work, std::vector<idx_t>&) {
+            work.resize((m * n + k) * W);
+            T* X = work.data();
+            T* lanetau = X + m * n * W;
+            bool rescale[W];
+
+            internal::batch_interleave<W>(A, b0, nb, X);
+            internal::geqrf_interleaved<W>(m, n, X, lanetau, rescale);
+
+            for (idx_t l = 0; l < nb; ++l) {
+                const idx_t b = b0 + l;
+                auto Ab = A[b];
+                LegacyVector<T, idx_t> taub(k, tau + b * k);
+                if (!rescale[l]) {
+                    internal::batch_deinterleave<W>(X, l, Ab);
+                    for (idx_t j = 0; j < k; ++j)
+                        taub[j] = lanetau[j * W + l];
+                }
+                else {
+                    // A[b] was not modified
+                    geqr2(Ab, taub);
+                }
+            }
+        });
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GEQRF_BATCHED_HH
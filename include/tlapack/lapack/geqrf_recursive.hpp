@@ -0,0 +1,271 @@
+/// @file geqrf_recursive.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/blob/master/SRC/zgeqrt3.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GEQRF_RECURSIVE_HH
+#define TLAPACK_GEQRF_RECURSIVE_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/trmm.hpp"
+#include "tlapack/lapack/geqrf.hpp"
+#include "tlapack/lapack/larfb.hpp"
+#include "tlapack/lapack/larfg.hpp"
+
+namespace tlapack {
+
+namespace internal {
+
+    /** Computes the QR factorization of an m-by-n matrix A, m >= n, and the
+     * n-by-n upper triangular factor TT of the block reflector
+     * H = I - V TT V^H, where V holds the Householder vectors.
+     *
+     * The columns are split in half, the left half is factored recursively,
+     * its block reflector is applied to the right half, and the right half
+     * is factored recursively. The T factors of both halves are merged as
+     * \[
+     *      TT = [ T1  -T1 V1^H V2 T2 ]
+     *           [  0          T2     ]
+     * \]
+     * so that all the work above the single-column base case is done by
+     * trmm() and gemm(). The upper triangle of TT is used as workspace.
+     *
+     * @param[in,out] A m-by-n matrix, m >= n.
+     * @param[out] tau Vector of length n.
+     * @param[out] TT n-by-n matrix. Only the upper triangle is referenced.
+     */
+    template <TLAPACK_SMATRIX A_t, TLAPACK_SVECTOR tau_t, TLAPACK_SMATRIX T_t>
+    void geqrt_recursive(A_t& A, tau_t& tau, T_t& TT)
+    {
+        using idx_t = size_type<A_t>;
+        using T = type_t<A_t>;
+        using range = pair<idx_t, idx_t>;
+
+        // constants
+        const T one(1);
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+
+        // base case of recursion; one-column matrices
+        if (n == 1) {
+            auto v = col(A, 0);
+            larfg(FORWARD, COLUMNWISE_STORAGE, v, tau[0]);
+            TT(0, 0) = tau[0];
+            return;
+        }
+
+        const idx_t n1 = n / 2;
+        const idx_t n2 = n - n1;
+
+        auto A1 = cols(A, range(0, n1));
+        auto V11 = slice(A, range(0, n1), range(0, n1));
+        auto V21 = slice(A, range(n1, m), range(0, n1));
+        auto A12 = slice(A, range(0, n1), range(n1, n));
+        auto A22 = slice(A, range(n1, m), range(n1, n));
+        auto tau1 = slice(tau, range(0, n1));
+        auto tau2 = slice(tau, range(n1, n));
+        auto T11 = slice(TT, range(0, n1), range(0, n1));
+        auto T12 = slice(TT, range(0, n1), range(n1, n));
+        auto T22 = slice(TT, range(n1, n), range(n1, n));
+
+        // Factor the left half
+        geqrt_recursive(A1, tau1, T11);
+
+        // Apply H1^H = I - V1 T11^H V1^H to the right half, with W = T12
+        for (idx_t j = 0; j < n2; ++j)
+            for (idx_t i = 0; i < n1; ++i)
+                T12(i, j) = A12(i, j);
+        trmm(LEFT_SIDE, LOWER_TRIANGLE, CONJ_TRANS, UNIT_DIAG, one, V11, T12);
+        gemm(CONJ_TRANS, NO_TRANS, one, V21, A22, one, T12);
+        trmm(LEFT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, NON_UNIT_DIAG, one, T11,
+             T12);
+        gemm(NO_TRANS, NO_TRANS, -one, V21, T12, one, A22);
+        trmm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, one, V11, T12);
+        for (idx_t j = 0; j < n2; ++j)
+            for (idx_t i = 0; i < n1; ++i)
+                A12(i, j) -= T12(i, j);
+
+        // Factor the right half
+        geqrt_recursive(A22, tau2, T22);
+
+        // T12 = -T11 V1^H V2 T22, where V2 is zero in its first n1 rows
+        auto V21a = slice(A, range(n1, n), range(0, n1));
+        auto V21b = slice(A, range(n, m), range(0, n1));
+        auto V22 = slice(A, range(n1, n), range(n1, n));
+        auto V32 = slice(A, range(n, m), range(n1, n));
+        for (idx_t j = 0; j < n2; ++j)
+            for (idx_t i = 0; i < n1; ++i)
+                T12(i, j) = conj(V21a(j, i));
+        trmm(RIGHT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, one, V22, T12);
+        gemm(CONJ_TRANS, NO_TRANS, one, V21b, V32, one, T12);
+        trmm(LEFT_SIDE, UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, -one, T11,
+             T12);
+        trmm(RIGHT_SIDE, UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, one, T22,
+             T12);
+    }
+
+}  // namespace internal
+
+/** Worspace query of geqrf_recursive()
+ *
+ * @param[in] A m-by-n matrix.
+ *
+ * @param tau min(n,m) vector.
+ *
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T, TLAPACK_SMATRIX A_t, TLAPACK_SVECTOR tau_t>
+constexpr WorkInfo geqrf_recursive_worksize(const A_t& A,
+                                            const tau_t& tau,
+                                            const GeqrfOpts& opts = {})
+{
+    using idx_t = size_type<A_t>;
+    using range = pair<idx_t, idx_t>;
+    using work_t = matrix_type<A_t, tau_t>;
+
+    // constants
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t k = min(m, n);
+    const idx_t nb = min((idx_t)opts.nb, k);
+
+    if (nb <= 0) return WorkInfo(0);
+
+    WorkInfo workinfo;
+    if (n > nb) {
+        auto&& A11 = cols(A, range(0, nb));
+        auto&& TT1 = slice(A, range(0, nb), range(0, nb));
+        auto&& A12 = slice(A, range(0, m), range(nb, n));
+        workinfo = larfb_worksize<T>(LEFT_SIDE, CONJ_TRANS, FORWARD,
+                                     COLUMNWISE_STORAGE, A11, TT1, A12);
+    }
+    if constexpr (is_same_v<T, type_t<work_t>>) workinfo += WorkInfo(nb, nb);
+
+    return workinfo;
+}
+
+/** @copybrief geqrf_recursive()
+ * Workspace is provided as an argument.
+ * @copydetails geqrf_recursive()
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX A_t, TLAPACK_SVECTOR tau_t, TLAPACK_WORKSPACE work_t>
+int geqrf_recursive_work(A_t& A,
+                         tau_t& tau,
+                         work_t& work,
+                         const GeqrfOpts& opts = {})
+{
+    using idx_t = size_type<A_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t k = min(m, n);
+    const idx_t nb = min((idx_t)opts.nb, k);
+
+    // check arguments
+    tlapack_check((idx_t)size(tau) >= k);
+
+    // quick return
+    if (k <= 0) return 0;
+
+    // Matrix TT
+    auto [TT, work2] = reshape(work, nb, nb);
+
+    // Main computational loop
+    for (idx_t j = 0; j < k; j += nb) {
+        const idx_t ib = min(nb, k - j);
+
+        // Compute the QR factorization of the current block A(j:m,j:j+ib)
+        // and the triangular factor of its block reflector
+        auto A11 = slice(A, range(j, m), range(j, j + ib));
+        auto tauw1 = slice(tau, range(j, j + ib));
+        auto TT1 = slice(TT, range(0, ib), range(0, ib));
+        internal::geqrt_recursive(A11, tauw1, TT1);
+
+        if (j + ib < n) {
+            // Apply H to A(j:m,j+ib:n) from the left
+            auto A12 = slice(A, range(j, m), range(j + ib, n));
+            larfb_work(LEFT_SIDE, CONJ_TRANS, FORWARD, COLUMNWISE_STORAGE, A11,
+                       TT1, A12, work2);
+        }
+    }
+
+    return 0;
+}
+
+/** Computes a QR factorization of an m-by-n matrix A using a blocked
+ *  algorithm with recursive panel factorizations.
+ *
+ * Each panel of opts.nb columns is factored by splitting its columns in half
+ * recursively, as proposed by Elmroth and Gustavson, so the panel work is
+ * done by level-3 BLAS. The triangular factor of the block reflector is built
+ * along the way and is used to update the trailing matrix. With
+ * opts.nb >= min(m,n), the whole matrix is factored recursively.
+ *
+ * The output is the same as the one of geqrf().
+ *
+ * The matrix Q is represented as a product of elementary reflectors
+ * \[
+ *          Q = H_1 H_2 ... H_k,
+ * \]
+ * where k = min(m,n). Each H_i has the form
+ * \[
+ *          H_i = I - tau * v * v',
+ * \]
+ * where tau is a scalar, and v is a vector with
+ * \[
+ *          v[0] = v[1] = ... = v[i-1] = 0; v[i] = 1,
+ * \]
+ * with v[i+1] through v[m-1] stored on exit below the diagonal
+ * in the ith column of A, and tau in tau[i].
+ *
+ * @return  0 if success
+ *
+ * @param[in,out] A m-by-n matrix.
+ *      On exit, the elements on and above the diagonal of the array
+ *      contain the min(m,n)-by-n upper trapezoidal matrix R
+ *      (R is upper triangular if m >= n); the elements below the diagonal,
+ *      with the array tau, represent the unitary matrix Q as a
+ *      product of elementary reflectors.
+ *
+ * @param[out] tau Real vector of length min(m,n).
+ *      The scalar factors of the elementary reflectors.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: Number of columns of each recursively factored panel.
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_SMATRIX A_t, TLAPACK_SVECTOR tau_t>
+int geqrf_recursive(A_t& A, tau_t& tau, const GeqrfOpts& opts = {})
+{
+    using work_t = matrix_type<A_t, tau_t>;
+    using T = type_t<work_t>;
+    Create<work_t> new_matrix;
+
+    // Get workspace from the arena
+    WorkInfo workinfo = geqrf_recursive_worksize<T>(A, tau, opts);
+    auto work_ = workspace_arena<T>().get(workinfo);
+    auto work = new_matrix(work_.vector(), workinfo.m, workinfo.n);
+
+    return geqrf_recursive_work(A, tau, work, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GEQRF_RECURSIVE_HH
@@ -0,0 +1,315 @@
+/// @file geqrf_tiled.hpp
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GEQRF_TILED_HH
+#define TLAPACK_GEQRF_TILED_HH
+
+#include <vector>
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/TiledOpts.hpp"
+#include "tlapack/lapack/geqrf_recursive.hpp"
+#include "tlapack/lapack/larfb.hpp"
+#include "tlapack/lapack/tsmqr.hpp"
+#include "tlapack/lapack/tsqrt.hpp"
+
+namespace tlapack {
+
+/** Computes a QR factorization of an m-by-n matrix A with a tiled algorithm.
+ *
+ * A is split in tiles of size opts.nb and the tiles below the diagonal are
+ * annihilated with a flat reduction tree. For each column of tiles k, the
+ * tasks of the TaskRuntime are:
+ *  1. QR factorization of the diagonal tile A(k,k).
+ *  2. larfb() on the tiles A(k,k+1:ny-1) with the reflectors of 1.
+ *  3. tsqrt() on the triangle R in A(k,k) and the tile A(i,k), for i > k.
+ *  4. tsmqr() on the tiles A(k,j) and A(i,j), for i, j > k.
+ *
+ * A task runs as soon as the tiles it reads are up to date. The routine
+ * returns when all tasks finished.
+ *
+ * Calls that share a runtime, e.g., the default one, run one at a time. This
+ * routine must not be called from a task that runs on the same runtime.
+ *
+ * @param[in,out] A m-by-n matrix.
+ *      On exit, the elements on and above the diagonal contain the
+ *      min(m,n)-by-n upper trapezoidal matrix R. The Householder vectors of
+ *      the tile kernels are stored below the diagonal of the diagonal tiles
+ *      and in the tiles below the diagonal.
+ *
+ * @param[out] TT (nx*nb)-by-n matrix, where nb = opts.nb and nx is the number
+ *      of tiles in a column of A.
+ *      On exit, TT(i*nb:i*nb+kb, k*nb:k*nb+kb) is the triangular factor of
+ *      the block reflector computed by the QR factorization of A(k,k)
+ *      (i == k) or by tsqrt() (i > k) on step k, where kb is the number of
+ *      reflectors of step k.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: Tile size.
+ *      - @c opts.runtime: Runtime that executes the tasks.
+ *
+ * @return 0 if success
+ *
+ * @see unmqr_tiled() to apply Q.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t, TLAPACK_SMATRIX matrixT_t>
+int geqrf_tiled(matrix_t& A, matrixT_t& TT, const TiledOpts& opts = {})
+{
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+    using Access = TaskRuntime::Access;
+
+    // Constants
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t nb = (idx_t)opts.nb;
+
+    // check arguments
+    tlapack_check(nb > 0);
+
+    // Quick return
+    if (m <= 0 || n <= 0) return 0;
+
+    internal::tiled_session session(opts);
+    TaskRuntime& rt = session.runtime();
+    const idx_t nx = internal::tiled_count(m, nb);
+    const idx_t ny = internal::tiled_count(n, nb);
+    const idx_t nt = min(nx, ny);
+
+    tlapack_check(nrows(TT) >= nx * nb && ncols(TT) >= n);
+
+    auto tile = [&](idx_t i, idx_t j) {
+        return slice(A, range(i * nb, min(i * nb + nb, m)),
+                     range(j * nb, min(j * nb + nb, n)));
+    };
+    auto key = [&](idx_t i, idx_t j) -> const void* {
+        return &A(i * nb, j * nb);
+    };
+    auto tkey = [&](idx_t i, idx_t j) -> const void* {
+        return &TT(i * nb, j * nb);
+    };
+
+    for (idx_t k = 0; k < nt; ++k) {
+        auto Akk = tile(k, k);
+        const idx_t nk = ncols(Akk);
+        const idx_t kb = min(nrows(Akk), nk);
+        auto V = cols(Akk, range(0, kb));
+        auto Tkk = slice(TT, range(k * nb, k * nb + kb),
+                         range(k * nb, k * nb + kb));
+
+        // Factor the diagonal tile
+        rt.submit(
+            [Akk, V, Tkk, kb, nk]() mutable {
+                Create<vector_type<matrix_t>> new_vector;
+                std::vector<T> tau_;
+                auto tau = new_vector(tau_, kb);
+                internal::geqrt_recursive(V, tau, Tkk);
+                if (nk > kb) {
+                    auto C = cols(Akk, range(kb, nk));
+                    larfb(LEFT_SIDE, CONJ_TRANS, FORWARD, COLUMNWISE_STORAGE,
+                          V, Tkk, C);
+                }
+            },
+            {{key(k, k), Access::ReadWrite}, {tkey(k, k), Access::Write}});
+
+        // Update the row of tiles
+        for (idx_t j = k + 1; j < ny; ++j) {
+            auto Akj = tile(k, j);
+            rt.submit(
+                [V, Tkk, Akj]() mutable {
+                    larfb(LEFT_SIDE, CONJ_TRANS, FORWARD, COLUMNWISE_STORAGE,
+                          V, Tkk, Akj);
+                },
+                {{key(k, k), Access::Read},
+                 {tkey(k, k), Access::Read},
+                 {key(k, j), Access::ReadWrite}});
+        }
+
+        // Annihilate the tiles below the diagonal
+        for (idx_t i = k + 1; i < nx; ++i) {
+            auto R = slice(Akk, range(0, nk), range(0, nk));
+            auto Aik = tile(i, k);
+            auto Tik = slice(TT, range(i * nb, i * nb + nk),
+                             range(k * nb, k * nb + nk));
+            rt.submit([R, Aik, Tik]() mutable { tsqrt(R, Aik, Tik); },
+                      {{key(k, k), Access::ReadWrite},
+                       {key(i, k), Access::ReadWrite},
+                       {tkey(i, k), Access::Write}});
+
+            for (idx_t j = k + 1; j < ny; ++j) {
+                auto Akj = tile(k, j);
+                auto Aij = tile(i, j);
+                auto C1 = rows(Akj, range(0, nk));
+                rt.submit(
+                    [Aik, Tik, C1, Aij]() mutable {
+                        tsmqr(LEFT_SIDE, CONJ_TRANS, Aik, Tik, C1, Aij);
+                    },
+                    {{key(i, k), Access::Read},
+                     {tkey(i, k), Access::Read},
+                     {key(k, j), Access::ReadWrite},
+                     {key(i, j), Access::ReadWrite}});
+            }
+        }
+    }
+
+    rt.wait();
+
+    return 0;
+}
+
+/** Applies the orthogonal matrix Q from geqrf_tiled() to a matrix C from the
+ * left.
+ *
+ * With trans = Op::ConjTrans, this is the step that reduces a least squares
+ * problem min ||A x - C|| to a triangular solve with R.
+ *
+ * Calls that share a runtime, e.g., the default one, run one at a time. This
+ * routine must not be called from a task that runs on the same runtime.
+ *
+ * @param[in] side Must be Side::Left.
+ *
+ * @param[in] trans
+ *     - Op::NoTrans:   C := Q C.
+ *     - Op::ConjTrans: C := Q^H C.
+ *
+ * @param[in] A m-by-k matrix.
+ *      The Householder vectors as returned by geqrf_tiled().
+ *
+ * @param[in] TT The triangular factors as returned by geqrf_tiled().
+ *
+ * @param[in,out] C m-by-n matrix.
+ *
+ * @param[in] opts Options. Must be the same tile size used in geqrf_tiled().
+ *      - @c opts.nb: Tile size.
+ *      - @c opts.runtime: Runtime that executes the tasks.
+ *
+ * @return 0 if success
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SMATRIX matrixT_t,
+          TLAPACK_SMATRIX matrixC_t,
+          TLAPACK_SIDE side_t,
+          TLAPACK_OP trans_t>
+int unmqr_tiled(side_t side,
+                trans_t trans,
+                const matrix_t& A,
+                const matrixT_t& TT,
+                matrixC_t& C,
+                const TiledOpts& opts = {})
+{
+    using idx_t = size_type<matrixC_t>;
+    using range = pair<idx_t, idx_t>;
+    using Access = TaskRuntime::Access;
+
+    // Constants
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(C);
+    const idx_t nb = (idx_t)opts.nb;
+
+    // check arguments
+    tlapack_check(side == Side::Left);
+    tlapack_check(trans == Op::NoTrans || trans == Op::ConjTrans);
+    tlapack_check(nrows(C) == m);
+    tlapack_check(nb > 0);
+
+    // Quick return
+    if (m <= 0 || ncols(A) <= 0 || n <= 0) return 0;
+
+    internal::tiled_session session(opts);
+    TaskRuntime& rt = session.runtime();
+    const idx_t nx = internal::tiled_count(m, nb);
+    const idx_t ny = internal::tiled_count(n, nb);
+    const idx_t nt = min(nx, internal::tiled_count(ncols(A), nb));
+
+    auto tileA = [&](idx_t i, idx_t j) {
+        return slice(A, range(i * nb, min(i * nb + nb, m)),
+                     range(j * nb, min(j * nb + nb, ncols(A))));
+    };
+    auto tileC = [&](idx_t i, idx_t j) {
+        return slice(C, range(i * nb, min(i * nb + nb, m)),
+                     range(j * nb, min(j * nb + nb, n)));
+    };
+    auto key = [&](idx_t i, idx_t j) -> const void* {
+        return &A(i * nb, j * nb);
+    };
+    auto tkey = [&](idx_t i, idx_t j) -> const void* {
+        return &TT(i * nb, j * nb);
+    };
+    auto ckey = [&](idx_t i, idx_t j) -> const void* {
+        return &C(i * nb, j * nb);
+    };
+
+    // Tasks of step k of the factorization
+    auto apply_diag = [&](idx_t k) {
+        const auto Akk = tileA(k, k);
+        const idx_t kb = min(nrows(Akk), ncols(Akk));
+        const auto V = cols(Akk, range(0, kb));
+        const auto Tkk = slice(TT, range(k * nb, k * nb + kb),
+                               range(k * nb, k * nb + kb));
+        for (idx_t j = 0; j < ny; ++j) {
+            auto Ckj = tileC(k, j);
+            rt.submit(
+                [trans, V, Tkk, Ckj]() mutable {
+                    larfb(LEFT_SIDE, trans, FORWARD, COLUMNWISE_STORAGE, V,
+                          Tkk, Ckj);
+                },
+                {{key(k, k), Access::Read},
+                 {tkey(k, k), Access::Read},
+                 {ckey(k, j), Access::ReadWrite}});
+        }
+    };
+    auto apply_ts = [&](idx_t i, idx_t k) {
+        const auto Aik = tileA(i, k);
+        const idx_t nk = ncols(Aik);
+        const auto Tik = slice(TT, range(i * nb, i * nb + nk),
+                               range(k * nb, k * nb + nk));
+        for (idx_t j = 0; j < ny; ++j) {
+            auto Ckj = tileC(k, j);
+            auto C1 = rows(Ckj, range(0, nk));
+            auto Cij = tileC(i, j);
+            rt.submit(
+                [trans, Aik, Tik, C1, Cij]() mutable {
+                    tsmqr(LEFT_SIDE, trans, Aik, Tik, C1, Cij);
+                },
+                {{key(i, k), Access::Read},
+                 {tkey(i, k), Access::Read},
+                 {ckey(k, j), Access::ReadWrite},
+                 {ckey(i, j), Access::ReadWrite}});
+        }
+    };
+
+    if (trans == Op::ConjTrans) {
+        // Same order as in geqrf_tiled()
+        for (idx_t k = 0; k < nt; ++k) {
+            apply_diag(k);
+            for (idx_t i = k + 1; i < nx; ++i)
+                apply_ts(i, k);
+        }
+    }
+    else {
+        // Reverse order
+        for (idx_t k = nt; k-- > 0;) {
+            for (idx_t i = nx; i-- > k + 1;)
+                apply_ts(i, k);
+            apply_diag(k);
+        }
+    }
+
+    rt.wait();
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GEQRF_TILED_HH
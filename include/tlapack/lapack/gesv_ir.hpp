@@ -0,0 +1,213 @@
+/// @file gesv_ir.hpp Mixed-precision LU solver with iterative refinement.
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dsgesv.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GESV_IR_HH
+#define TLAPACK_GESV_IR_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/lapack/RefinementOpts.hpp"
+#include "tlapack/lapack/getrf.hpp"
+#include "tlapack/lapack/getrs.hpp"
+#include "tlapack/lapack/iterative_refinement.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/lange.hpp"
+
+namespace tlapack {
+
+/** Computes the solution to a system of linear equations
+ * \[
+ *      A X = B
+ * \]
+ * using an LU factorization computed in a lower precision and iterative
+ * refinement.
+ *
+ * The precision of the factorization is the precision of LU, e.g., float,
+ * Eigen::half or Eigen::bfloat16, and the working precision is the one of X.
+ * The routine:
+ *  1. Copies A to LU and computes $P A = L U$ with getrf() in the low
+ *     precision.
+ *  2. Refines the solution with corrections computed in the low precision
+ *     and residuals computed in the working precision.
+ *  3. If the refinement stalls and opts.use_gmres is true, continues with
+ *     GMRES-IR. In GMRES-IR, GMRES solves for the corrections in the working
+ *     precision, preconditioned with the low-precision factors.
+ *  4. If the refinement does not converge, the entries of A overflow in the
+ *     low precision, or the low-precision factorization fails, and
+ *     opts.fallback is true, factors A with getrf() in the working precision
+ *     and solves the system with the factors.
+ *
+ * The refinement converges when
+ * \[
+ *      \|B_j - A X_j\|_\infty \leq \|A\|_\infty \|X_j\|_\infty
+ *      \sqrt{n} \epsilon
+ * \]
+ * for all columns j, where $\epsilon$ is the machine epsilon of the working
+ * precision.
+ *
+ * @param[in,out] A n-by-n matrix.
+ *      On entry, the matrix A.
+ *      On exit, unchanged if the refinement converged. Otherwise, the factors
+ *      L and U from the factorization $P A = L U$ in the working precision.
+ *
+ * @param[out] LU n-by-n matrix in the low precision.
+ *      On exit, if the low-precision factorization was computed, the factors
+ *      L and U from the factorization $P A = L U$.
+ *
+ * @param[out] piv Vector of length n.
+ *      The pivot indices of the last factorization, as in getrf().
+ *
+ * @param[in] B n-by-nrhs matrix.
+ *
+ * @param[out] X n-by-nrhs matrix.
+ *      On exit, the solution X.
+ *
+ * @param[in,out] opts Options.
+ *      - @c opts.max_iter, @c opts.use_gmres, @c opts.gmres_max_iter,
+ *        @c opts.gmres_tol and @c opts.fallback control the refinement.
+ *      - @c opts.n_iter, @c opts.n_gmres_step, @c opts.n_gmres_iter,
+ *        @c opts.backward_error and @c opts.solver are updated inside the
+ *        routine. @c opts.backward_error is not computed by the full-precision
+ *        solve.
+ *
+ * @return 0 if success.
+ * @return i+1, 0 <= i < n, if U(i,i) is exactly zero in the factorization in
+ *      the working precision. The solution could not be computed.
+ * @return n+1 if the refinement did not converge and opts.fallback is false.
+ *      X contains the best solution found.
+ * @return n+2 if the low-precision factorization could not be computed, i.e.,
+ *      the entries of A overflow in the low precision or U(i,i) is exactly
+ *      zero in the low precision, and opts.fallback is false. X is not
+ *      modified.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrixA_t,
+          TLAPACK_SMATRIX matrixLU_t,
+          TLAPACK_SVECTOR piv_t,
+          TLAPACK_SMATRIX matrixB_t,
+          TLAPACK_SMATRIX matrixX_t>
+int gesv_ir(matrixA_t& A,
+            matrixLU_t& LU,
+            piv_t& piv,
+            const matrixB_t& B,
+            matrixX_t& X,
+            RefinementOpts& opts)
+{
+    using T = type_t<matrixX_t>;
+    using real_t = real_type<T>;
+    using TLU = type_t<matrixLU_t>;
+    using real_low_t = real_type<TLU>;
+    using idx_t = size_type<matrixA_t>;
+    using range = pair<idx_t, idx_t>;
+    using workLU_t = matrix_type<matrixLU_t>;
+
+    // Functor
+    Create<workLU_t> new_matrix;
+
+    // Constants
+    const idx_t n = nrows(A);
+    const idx_t nrhs = ncols(B);
+
+    // Check arguments
+    tlapack_check(ncols(A) == n);
+    tlapack_check(nrows(LU) == n && ncols(LU) == n);
+    tlapack_check((idx_t)size(piv) >= n);
+    tlapack_check(nrows(B) == n);
+    tlapack_check(nrows(X) == n && ncols(X) == nrhs);
+
+    opts.n_iter = 0;
+    opts.n_gmres_step = 0;
+    opts.n_gmres_iter = 0;
+    opts.backward_error = 0;
+    opts.solver = RefinementSolver::Refinement;
+
+    // Quick return
+    if (n <= 0 || nrhs <= 0) return 0;
+
+    // Factor A in the low precision, unless its entries overflow
+    bool use_low = (lange(MAX_NORM, A) <= real_t(safe_max<real_low_t>()));
+    if (use_low) {
+        lacpy(GENERAL, A, LU);
+        use_low = (getrf(LU, piv) == 0);
+    }
+
+    if (use_low) {
+        // Low-precision copy of the right-hand sides
+        std::vector<TLU> W_;
+        auto W = new_matrix(W_, n, nrhs);
+
+        auto apply_A = [&A](const T& alpha, const auto& X_, const T& beta,
+                            auto& Y_) {
+            gemm(NO_TRANS, NO_TRANS, alpha, A, X_, beta, Y_);
+        };
+        auto solve_low = [&](auto& R_) {
+            auto WR = cols(W, range(0, ncols(R_)));
+            lacpy(GENERAL, R_, WR);
+            getrs(NO_TRANS, LU, piv, WR);
+            lacpy(GENERAL, WR, R_);
+        };
+        // Applies the low-precision factors in the working precision
+        auto precond = [&](auto& V_) {
+            auto v = col(V_, 0);
+            for (idx_t i = 0; i < n; ++i)
+                if ((idx_t)piv[i] != i) std::swap(v[i], v[piv[i]]);
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = j + 1; i < n; ++i)
+                    v[i] -= T(LU(i, j)) * v[j];
+            for (idx_t j = n; j-- > 0;) {
+                v[j] /= T(LU(j, j));
+                for (idx_t i = 0; i < j; ++i)
+                    v[i] -= T(LU(i, j)) * v[j];
+            }
+        };
+
+        const real_t anrm = lange(INF_NORM, A);
+        if (internal::mixed_precision_refinement(apply_A, solve_low, precond,
+                                                 anrm, B, X, opts))
+            return 0;
+    }
+
+    if (!opts.fallback) return use_low ? n + 1 : n + 2;
+
+    // Solve in the working precision
+    opts.solver = RefinementSolver::FullPrecision;
+    int info = getrf(A, piv);
+    if (info != 0) return info;
+    lacpy(GENERAL, B, X);
+    getrs(NO_TRANS, A, piv, X);
+
+    return 0;
+}
+
+/** @overload int gesv_ir(matrixA_t& A, matrixLU_t& LU, piv_t& piv,
+ *                       const matrixB_t& B, matrixX_t& X,
+ *                       RefinementOpts& opts)
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrixA_t,
+          TLAPACK_SMATRIX matrixLU_t,
+          TLAPACK_SVECTOR piv_t,
+          TLAPACK_SMATRIX matrixB_t,
+          TLAPACK_SMATRIX matrixX_t>
+int gesv_ir(matrixA_t& A,
+            matrixLU_t& LU,
+            piv_t& piv,
+            const matrixB_t& B,
+            matrixX_t& X)
+{
+    RefinementOpts opts = {};
+    return gesv_ir(A, LU, piv, B, X, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GESV_IR_HH
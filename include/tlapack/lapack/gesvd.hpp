@@ -13,21 +13,118 @@
 #define TLAPACK_GESVD_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/bdsdc.hpp"
 #include "tlapack/lapack/gebrd.hpp"
+#include "tlapack/lapack/gelqf.hpp"
+#include "tlapack/lapack/geqrf.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/laset.hpp"
 #include "tlapack/lapack/svd_qr.hpp"
 #include "tlapack/lapack/ungbr.hpp"
+#include "tlapack/lapack/unmlq.hpp"
+#include "tlapack/lapack/unmqr.hpp"
 
 namespace tlapack {
 
+/// @brief Variants of the algorithm to compute the SVD of the bidiagonal
+/// matrix in gesvd().
+enum class GesvdVariant : char { QRIteration = 'Q', DivideConquer = 'D' };
+
 /**
  * Options struct for gesvd
  */
 struct GesvdOpts {
-    /// @todo If either max(m,n)/min(m,n) is larger than shapethresh, a QR
-    /// factorization is used before
+    /// If max(m,n) >= shapethresh * min(m,n), A is first reduced to a
+    /// min(m,n)-by-min(m,n) triangular matrix by a QR (m > n) or LQ (m < n)
+    /// factorization, and the bidiagonal reduction works on that matrix.
     float shapethresh = 1.6;
+
+    GesvdVariant variant = GesvdVariant::QRIteration;  ///< Bidiagonal solver
+    size_t smlsiz = 25;  ///< Used if variant = DivideConquer. Bidiagonal
+                         ///< matrices of size at most smlsiz are solved by
+                         ///< the QR iteration
 };
 
+namespace internal {
+
+    /**
+     * Computes the SVD of A by reducing it to bidiagonal form with gebrd()
+     * and computing the SVD of the bidiagonal matrix. The arguments are as in
+     * gesvd().
+     */
+    template <TLAPACK_SMATRIX matrixA_t,
+              TLAPACK_SVECTOR r_vector_t,
+              TLAPACK_SMATRIX matrix_t>
+    int gesvd_bidiag(bool want_u,
+                     bool want_vt,
+                     matrixA_t& A,
+                     r_vector_t& s,
+                     matrix_t& U,
+                     matrix_t& Vt,
+                     const GesvdOpts& opts)
+    {
+        using idx_t = size_type<matrixA_t>;
+        using range = pair<idx_t, idx_t>;
+
+        // Functors
+        Create<vector_type<matrixA_t>> new_vector;
+        Create<vector_type<r_vector_t>> new_rvector;
+
+        // constants
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+        const idx_t k = min(m, n);
+        const Uplo uplo = (m >= n) ? Uplo::Upper : Uplo::Lower;
+
+        // Get vectors from the arena
+        auto tauv_ = workspace_arena<type_t<matrixA_t>>().get(k);
+        auto tauw_ = workspace_arena<type_t<matrixA_t>>().get(k);
+        auto e_ = workspace_arena<type_t<r_vector_t>>().get(k);
+        auto tauv = new_vector(tauv_.vector(), k);
+        auto tauw = new_vector(tauw_.vector(), k);
+        auto e = new_rvector(e_.vector(), k);
+
+        // Reduce A to bidiagonal form
+        gebrd(A, tauv, tauw);
+
+        if (m >= n) {
+            // copy upper bidiagonal matrix
+            for (idx_t i = 0; i < k; ++i) {
+                s[i] = real(A(i, i));
+                if (i + 1 < n) e[i] = real(A(i, i + 1));
+            }
+        }
+        else {
+            // copy lower bidiagonal matrix
+            for (idx_t i = 0; i < k; ++i) {
+                s[i] = real(A(i, i));
+                if (i + 1 < m) e[i] = real(A(i + 1, i));
+            }
+        }
+
+        if (want_u) {
+            auto Ui = slice(U, range{0, m}, range{0, k});
+            lacpy(Uplo::Lower, slice(A, range{0, m}, range{0, k}), Ui);
+            ungbr_q(n, U, tauv);
+        }
+
+        if (want_vt) {
+            auto Vti = slice(Vt, range{0, k}, range{0, n});
+            lacpy(Uplo::Upper, slice(A, range{0, k}, range{0, n}), Vti);
+            ungbr_p(m, Vt, tauw);
+        }
+
+        if (opts.variant == GesvdVariant::DivideConquer) {
+            BdsdcOpts bdsdcOpts;
+            bdsdcOpts.smlsiz = opts.smlsiz;
+            return bdsdc(uplo, want_u, want_vt, s, e, U, Vt, bdsdcOpts);
+        }
+        else
+            return svd_qr(uplo, want_u, want_vt, s, e, U, Vt);
+    }
+
+}  // namespace internal
+
 /**
  * Computes the singular values and, optionally, the right and/or
  * left singular vectors from the singular value decomposition (SVD) of
@@ -38,6 +135,13 @@ struct GesvdOpts {
  * right singular vectors. Depending on the dimensions of U and Vt,
  * either the reduced or full unitary factors are determined.
  *
+ * If A is tall, i.e., m >= opts.shapethresh * n, A is first factored as
+ * A = Q * R with geqrf() and the SVD of the n-by-n matrix R is computed. The
+ * left singular vectors are then Q * U_R, applied with unmqr(). Wide matrices
+ * are handled the same way with an LQ factorization. With an m-by-n U, only
+ * the economy-size left singular vectors are formed, which, for very tall
+ * matrices, costs O(m n^2) flops instead of O(m^2 n).
+ *
  * @note There is no option to return U or Vt in A. This functionality is
  * present in zgesvd in Reference LAPACK.
  *
@@ -52,13 +156,20 @@ struct GesvdOpts {
  * @param[out] s vector of length min(m,n).
  *      The singular values of A, sorted so that S(i) >= S(i+1).
  *
- * @param[in,out] U m-by-m matrix.
+ * @param[out] U m-by-m or m-by-min(m,n) matrix.
+ *      If want_u, the full or economy-size left singular vectors.
  *
- * @param[in,out] Vt n-by-n matrix.
+ * @param[out] Vt n-by-n or min(m,n)-by-n matrix.
+ *      If want_vt, the full or economy-size right singular vectors.
  *
  * @param[in] opts Options.
- *      - @c opts.work is used if whenever it has sufficient size.
- *        The sufficient size can be obtained through a workspace query.
+ *      - @c opts.variant selects the algorithm for the bidiagonal SVD:
+ *        the QR iteration of svd_qr() or the divide and conquer method of
+ *        bdsdc(). The latter is much faster for large matrices when singular
+ *        vectors are requested.
+ *      - @c opts.smlsiz: size below which bdsdc() uses the QR iteration.
+ *      - @c opts.shapethresh: aspect ratio above which A is first reduced
+ *        by a QR or LQ factorization.
  *
  * @ingroup computational
  */
@@ -72,56 +183,93 @@ int gesvd(bool want_u,
           const GesvdOpts& opts = {})
 {
     using idx_t = size_type<matrix_t>;
+    using T = type_t<matrix_t>;
     using range = pair<idx_t, idx_t>;
 
     // Functors
+    Create<matrix_t> new_matrix;
     Create<vector_type<matrix_t>> new_vector;
-    Create<vector_type<r_vector_t>> new_rvector;
 
     // constants
+    const T zero(0);
+    const T one(1);
     const idx_t m = nrows(A);
     const idx_t n = ncols(A);
-    const idx_t k = min(m, n);
-    const Uplo uplo = (m >= n) ? Uplo::Upper : Uplo::Lower;
-
-    // Allocate vectors
-    std::vector<type_t<matrix_t>> tauv_, tauw_;
-    auto tauv = new_vector(tauv_, k);
-    auto tauw = new_vector(tauw_, k);
-    std::vector<type_t<r_vector_t>> e_;
-    auto e = new_rvector(e_, k);
-
-    // Reduce A to bidiagonal form
-    gebrd(A, tauv, tauw);
-
-    if (m >= n) {
-        // copy upper bidiagonal matrix
-        for (idx_t i = 0; i < k; ++i) {
-            s[i] = real(A(i, i));
-            if (i + 1 < n) e[i] = real(A(i, i + 1));
-        }
-    }
-    else {
-        // copy lower bidiagonal matrix
-        for (idx_t i = 0; i < k; ++i) {
-            s[i] = real(A(i, i));
-            if (i + 1 < m) e[i] = real(A(i + 1, i));
+    const bool tall = (m > n) && (float(m) >= opts.shapethresh * float(n));
+    const bool wide = (n > m) && (float(n) >= opts.shapethresh * float(m));
+
+    // check arguments
+    if (want_u) tlapack_check(nrows(U) == m && ncols(U) >= min(m, n));
+    if (want_vt) tlapack_check(ncols(Vt) == n && nrows(Vt) >= min(m, n));
+
+    if (tall) {
+        // A = Q * R, and the SVD of the n-by-n matrix R gives the singular
+        // values and right singular vectors of A
+        auto tau_ = workspace_arena<T>().get(n);
+        auto tau = new_vector(tau_.vector(), n);
+        geqrf(A, tau);
+
+        auto R_ = workspace_arena<T>().get(WorkInfo(n, n));
+        auto R = new_matrix(R_.vector(), n, n);
+        laset(LOWER_TRIANGLE, zero, zero, R);
+        lacpy(UPPER_TRIANGLE, slice(A, range{0, n}, range{0, n}), R);
+
+        const idx_t nu = want_u ? n : 0;
+        const idx_t nvt = want_vt ? n : 0;
+        auto Ur = slice(U, range{0, nu}, range{0, nu});
+        auto Vtr = slice(Vt, range{0, nvt}, range{0, nvt});
+        const int info =
+            internal::gesvd_bidiag(want_u, want_vt, R, s, Ur, Vtr, opts);
+
+        // U = Q * [Ur 0; 0 I]
+        if (want_u) {
+            const idx_t mu = ncols(U);
+            auto U21 = slice(U, range{n, m}, range{0, n});
+            auto U12 = slice(U, range{0, n}, range{n, mu});
+            auto U22 = slice(U, range{n, m}, range{n, mu});
+            laset(GENERAL, zero, zero, U21);
+            laset(GENERAL, zero, zero, U12);
+            laset(GENERAL, zero, one, U22);
+            unmqr(LEFT_SIDE, NO_TRANS, A, tau, U);
         }
-    }
 
-    if (want_u) {
-        auto Ui = slice(U, range{0, m}, range{0, k});
-        lacpy(Uplo::Lower, slice(A, range{0, m}, range{0, k}), Ui);
-        ungbr_q(n, U, tauv);
+        return info;
     }
+    else if (wide) {
+        // A = L * Q, and the SVD of the m-by-m matrix L gives the singular
+        // values and left singular vectors of A
+        auto tau_ = workspace_arena<T>().get(m);
+        auto tau = new_vector(tau_.vector(), m);
+        gelqf(A, tau);
 
-    if (want_vt) {
-        auto Vti = slice(Vt, range{0, k}, range{0, n});
-        lacpy(Uplo::Upper, slice(A, range{0, k}, range{0, n}), Vti);
-        ungbr_p(m, Vt, tauw);
-    }
+        auto L_ = workspace_arena<T>().get(WorkInfo(m, m));
+        auto L = new_matrix(L_.vector(), m, m);
+        laset(UPPER_TRIANGLE, zero, zero, L);
+        lacpy(LOWER_TRIANGLE, slice(A, range{0, m}, range{0, m}), L);
 
-    return svd_qr(uplo, want_u, want_vt, s, e, U, Vt);
+        const idx_t nu = want_u ? m : 0;
+        const idx_t nvt = want_vt ? m : 0;
+        auto Ul = slice(U, range{0, nu}, range{0, nu});
+        auto Vtl = slice(Vt, range{0, nvt}, range{0, nvt});
+        const int info =
+            internal::gesvd_bidiag(want_u, want_vt, L, s, Ul, Vtl, opts);
+
+        // Vt = [Vtl 0; 0 I] * Q
+        if (want_vt) {
+            const idx_t mvt = nrows(Vt);
+            auto Vt12 = slice(Vt, range{0, m}, range{m, n});
+            auto Vt21 = slice(Vt, range{m, mvt}, range{0, m});
+            auto Vt22 = slice(Vt, range{m, mvt}, range{m, n});
+            laset(GENERAL, zero, zero, Vt12);
+            laset(GENERAL, zero, zero, Vt21);
+            laset(GENERAL, zero, one, Vt22);
+            unmlq(RIGHT_SIDE, NO_TRANS, A, tau, Vt);
+        }
+
+        return info;
+    }
+    else
+        return internal::gesvd_bidiag(want_u, want_vt, A, s, U, Vt, opts);
 }
 
 }  // namespace tlapack
@@ -0,0 +1,106 @@
+/// @file gesvd_batched.hpp Computes the singular value decompositions of a
+/// batch of small matrices.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GESVD_BATCHED_HH
+#define TLAPACK_GESVD_BATCHED_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/BatchedOpts.hpp"
+#include "tlapack/lapack/gesvd.hpp"
+
+namespace tlapack {
+
+/** Computes the singular value decompositions of a batch of small matrices.
+ *
+ * Each matrix A[b] of the batch is decomposed with gesvd(),
+ * \[
+ *   A_b = U_b S_b V_b^H.
+ * \]
+ * The matrices are distributed among OpenMP threads.
+ *
+ * @return The number of matrices for which gesvd() did not converge.
+ *
+ * @param[in] want_u bool
+ *
+ * @param[in] want_vt bool
+ *
+ * @param[in,out] A Strided or pointer-array batch of m-by-n matrices.
+ *      The contents of A are destroyed on exit.
+ *
+ * @param[out] s Array of length k*A.size() where k=min(m,n).
+ *      The singular values of A[b], sorted so that S(i) >= S(i+1), are stored
+ *      in s[b*k], ..., s[b*k+k-1].
+ *
+ * @param[out] U Batch of A.size() m-by-m matrices.
+ *      Not referenced if want_u is false.
+ *
+ * @param[out] Vt Batch of A.size() n-by-n matrices.
+ *      Not referenced if want_vt is false.
+ *
+ * @param[out] info Array of length A.size(), or nullptr.
+ *      If not nullptr, info[b] is the value gesvd() returns for A[b].
+ *
+ * @param[in] opts Options.
+ *
+ * @ingroup computational
+ */
+template <class batch_t>
+int gesvd_batched(bool want_u,
+                  bool want_vt,
+                  batch_t& A,
+                  real_type<type_t<typename batch_t::matrix_type>>* s,
+                  batch_t& U,
+                  batch_t& Vt,
+                  int* info = nullptr,
+                  const BatchedOpts& opts = {})
+{
+    using matrix_t = typename batch_t::matrix_type;
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<matrix_t>;
+
+    // constants
+    const idx_t m = A.m;
+    const idx_t n = A.n;
+    const idx_t k = min(m, n);
+    const idx_t count = A.size();
+
+    // check arguments
+    if (want_u) {
+        tlapack_check(U.m == m && U.n == m);
+        tlapack_check(U.size() >= count);
+    }
+    if (want_vt) {
+        tlapack_check(Vt.m == n && Vt.n == n);
+        tlapack_check(Vt.size() >= count);
+    }
+
+    int nfailed = 0;
+    internal::batch_for_each_group<1, T>(
+        count, opts,
+        [&](idx_t b, idx_t, std::vector<T>&, std::vector<idx_t>&) {
+            auto Ab = A[b];
+            auto Ub = want_u ? U[b] : matrix_t(0, 0, nullptr);
+            auto Vtb = want_vt ? Vt[b] : matrix_t(0, 0, nullptr);
+            LegacyVector<real_t, idx_t> sb(k, s + b * k);
+
+            const int infob = gesvd(want_u, want_vt, Ab, sb, Ub, Vtb);
+            if (infob != 0) {
+                TLAPACK_OMP(atomic)
+                ++nfailed;
+            }
+            if (info) info[b] = infob;
+        });
+
+    return nfailed;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GESVD_BATCHED_HH
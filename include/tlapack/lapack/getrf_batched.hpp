@@ -0,0 +1,113 @@
+/// @file getrf_batched.hpp Computes the LU factorizations of a batch of small
+/// matrices.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GETRF_BATCHED_HH
+#define TLAPACK_GETRF_BATCHED_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/BatchedOpts.hpp"
+#include "tlapack/lapack/getrf_level0.hpp"
+
+namespace tlapack {
+
+/** Computes the LU factorizations of a batch of small matrices.
+ *
+ * Each matrix A[b] of the batch is factored as in getrf_level0(),
+ * \[
+ *   P_b A_b = L_b U_b.
+ * \]
+ * Groups of internal::batch_lanes<T> matrices are copied to an interleaved
+ * buffer and factored together, so that the innermost loops run over the
+ * batch. The groups are distributed among OpenMP threads.
+ *
+ * Matrices with a zero pivot are factored again with getrf_level0(), so the
+ * output for them is the same as in the non-batched routine.
+ *
+ * @return The number of matrices for which the factorization failed.
+ *
+ * @param[in,out] A Strided or pointer-array batch of m-by-n matrices.
+ *      On exit, the factors L and U of each matrix;
+ *      the unit diagonal elements of L are not stored.
+ *
+ * @param[out] piv Array of length k*A.size() where k=min(m,n).
+ *      The pivots of A[b] are stored in piv[b*k], ..., piv[b*k+k-1] with the
+ *      same meaning as in getrf().
+ *
+ * @param[out] info Array of length A.size(), or nullptr.
+ *      If not nullptr, info[b] is the value getrf_level0() returns for A[b].
+ *
+ * @param[in] opts Options.
+ *
+ * @ingroup computational
+ */
+template <class batch_t>
+int getrf_batched(batch_t& A,
+                  size_type<typename batch_t::matrix_type>* piv,
+                  int* info = nullptr,
+                  const BatchedOpts& opts = {})
+{
+    using matrix_t = typename batch_t::matrix_type;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    constexpr int W = internal::batch_lanes<T>;
+
+    // constants
+    const idx_t m = A.m;
+    const idx_t n = A.n;
+    const idx_t k = min(m, n);
+    const idx_t count = A.size();
+
+    // quick return
+    if (count <= 0 || m <= 0 || n <= 0) {
+        if (info)
+            for (idx_t b = 0; b < count; ++b)
+                info[b] = 0;
+        return 0;
+    }
+
+    int nfailed = 0;
+    internal::batch_for_each_group<W, T>(
+        count, opts,
+        [&](idx_t b0, idx_t nb, std::vector<T>& work,
+            std::vector<idx_t>& iwork) {
+            work.resize(m * n * W);
+            iwork.resize(k * W);
+            int linfo[W];
+
+            internal::batch_interleave<W>(A, b0, nb, work.data());
+            internal::getrf_interleaved<W>(m, n, work.data(), iwork.data(),
+                                           linfo);
+
+            for (idx_t l = 0; l < nb; ++l) {
+                const idx_t b = b0 + l;
+                auto Ab = A[b];
+                LegacyVector<idx_t, idx_t> pivb(k, piv + b * k);
+                if (linfo[l] == 0) {
+                    internal::batch_deinterleave<W>(work.data(), l, Ab);
+                    for (idx_t j = 0; j < k; ++j)
+                        pivb[j] = iwork[j * W + l];
+                }
+                else {
+                    // A[b] was not modified
+                    linfo[l] = getrf_level0(Ab, pivb);
+                    if (linfo[l] != 0) {
+                        TLAPACK_OMP(atomic)
+                        ++nfailed;
+                    }
+                }
+                if (info) info[b] = linfo[l];
+            }
+        });
+
+    return nfailed;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GETRF_BATCHED_HH
@@ -13,6 +13,91 @@
 #include "tlapack/base/utils.hpp"
 namespace tlapack {
 
+namespace internal {
+
+    /**
+     * LU factorization with partial pivoting of W interleaved m-by-n matrices.
+     *
+     * Follows getrf_level0(). The pivot of step j of lane l is stored in
+     * piv[j*W + l]. On exit, info[l] is 0 if lane l was factored successfully,
+     * and j+1 if its first zero pivot was found at step j. Zero pivots are
+     * replaced by one so that the other lanes are not affected.
+     *
+     * @tparam M, N Extents of the matrices if known at compile time, or -1.
+     *      When known, they replace m and n as the loop bounds.
+     */
+    template <int W, int M = -1, int N = -1, class T, class idx_t>
+    void getrf_interleaved(idx_t m_, idx_t n_, T* X, idx_t* piv, int* info)
+    {
+        using real_t = real_type<T>;
+
+        // constants
+        const idx_t m = (M >= 0) ? idx_t(M) : m_;
+        const idx_t n = (N >= 0) ? idx_t(N) : n_;
+        const idx_t k = min(m, n);
+
+        for (int l = 0; l < W; ++l)
+            info[l] = 0;
+
+        for (idx_t j = 0; j < k; ++j) {
+            T* Xj = X + j * m * W;
+
+            // find pivots
+            idx_t p[W];
+            real_t pmax[W];
+            for (int l = 0; l < W; ++l) {
+                p[l] = j;
+                pmax[l] = abs1(Xj[j * W + l]);
+            }
+            for (idx_t i = j + 1; i < m; ++i) {
+                for (int l = 0; l < W; ++l) {
+                    const real_t a = abs1(Xj[i * W + l]);
+                    if (a > pmax[l]) {
+                        pmax[l] = a;
+                        p[l] = i;
+                    }
+                }
+            }
+            for (int l = 0; l < W; ++l)
+                piv[j * W + l] = p[l];
+
+            // swap the j-th row and the pivot row of each lane
+            for (idx_t c = 0; c < n; ++c) {
+                T* Xc = X + c * m * W;
+                for (int l = 0; l < W; ++l) {
+                    if (p[l] != j) {
+                        const T tmp = Xc[j * W + l];
+                        Xc[j * W + l] = Xc[p[l] * W + l];
+                        Xc[p[l] * W + l] = tmp;
+                    }
+                }
+            }
+
+            // divide below diagonal part of the j-th column by the pivot
+            T d[W];
+            for (int l = 0; l < W; ++l) {
+                d[l] = Xj[j * W + l];
+                if (d[l] == real_t(0)) {
+                    if (info[l] == 0) info[l] = j + 1;
+                    d[l] = T(1);
+                }
+            }
+            for (idx_t i = j + 1; i < m; ++i)
+                for (int l = 0; l < W; ++l)
+                    Xj[i * W + l] /= d[l];
+
+            // update the submatrix A(j+1:m-1,j+1:n-1)
+            for (idx_t c = j + 1; c < n; ++c) {
+                T* Xc = X + c * m * W;
+                for (idx_t i = j + 1; i < m; ++i)
+                    for (int l = 0; l < W; ++l)
+                        Xc[i * W + l] -= Xj[i * W + l] * Xc[j * W + l];
+            }
+        }
+    }
+
+}  // namespace internal
+
 /** getrf computes an LU factorization of a general m-by-n matrix A
  *  using partial pivoting with row interchanges.
  *
@@ -26,6 +111,9 @@ namespace tlapack {
  *
  *  This is a Level 0 version of the algorithm.
  *
+ *  If the extents of A are known at compile time, the factorization is
+ *  computed on a copy of A in the stack, with constant loop bounds.
+ *
  * @return  0 if success
  * @return  i+1 if failed to compute the LU on iteration i
  *
@@ -64,6 +152,32 @@ int getrf_level0(matrix_t& A, piv_t& piv)
     // quick return
     if (m <= 0 || n <= 0) return 0;
 
+    // Tiny matrices with compile-time extents are factored in a local copy
+    if constexpr (has_small_static_extents<matrix_t>) {
+        constexpr idx_t M = static_nrows<matrix_t>;
+        constexpr idx_t N = static_ncols<matrix_t>;
+        constexpr idx_t K = (M < N) ? M : N;
+
+        T a[M * N];
+        idx_t p[K];
+        for (idx_t j = 0; j < N; ++j)
+            for (idx_t i = 0; i < M; ++i)
+                a[i + j * M] = A(i, j);
+
+        int info;
+        internal::getrf_interleaved<1, int(M), int(N)>(M, N, a, p, &info);
+
+        // On a zero pivot, A is factored again below
+        if (info == 0) {
+            for (idx_t j = 0; j < N; ++j)
+                for (idx_t i = 0; i < M; ++i)
+                    A(i, j) = a[i + j * M];
+            for (idx_t j = 0; j < K; ++j)
+                piv[j] = p[j];
+            return 0;
+        }
+    }
+
     for (idx_t j = 0; j < end; j++) {
         // find pivot and swap the row with pivot row
         piv[j] = j;
@@ -0,0 +1,200 @@
+/// @file getrf_tiled.hpp
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GETRF_TILED_HH
+#define TLAPACK_GETRF_TILED_HH
+
+#include <vector>
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/TiledOpts.hpp"
+#include "tlapack/lapack/getrf.hpp"
+
+namespace tlapack {
+
+/** Computes an LU factorization of a general m-by-n matrix A with a tiled
+ * algorithm and partial pivoting.
+ *
+ * The factorization has the form
+ * \[
+ *   P A = L U
+ * \]
+ * as in getrf(). A is split in tiles of size opts.nb. For each column of
+ * tiles k, the tasks of the TaskRuntime are:
+ *  1. getrf() on the panel formed by the tiles (k:nx-1, k).
+ *  2. for each column of tiles j != k, the row interchanges of the panel on
+ *     the tiles (k:nx-1, j).
+ *  3. trsm() on the tiles (k, j) and gemm() on the tiles (i, j), i, j > k.
+ *
+ * A task runs as soon as the tiles it reads are up to date, so the panel of
+ * step k+1 may start while the trailing matrix of step k is being updated.
+ * The routine returns when all tasks finished.
+ *
+ * Calls that share a runtime, e.g., the default one, run one at a time. This
+ * routine must not be called from a task that runs on the same runtime.
+ *
+ * @param[in,out] A m-by-n matrix.
+ *      On exit, the factors L and U from the factorization P A = L U;
+ *      the unit diagonal elements of L are not stored.
+ *
+ * @param[out] piv Vector of length min(m,n).
+ *      Pivots as in getrf().
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: Tile size.
+ *      - @c opts.runtime: Runtime that executes the tasks.
+ *
+ * @return  0 if success
+ * @return  i+1 if failed to compute the LU on iteration i
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t, TLAPACK_SVECTOR piv_t>
+int getrf_tiled(matrix_t& A, piv_t& piv, const TiledOpts& opts = {})
+{
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+    using Access = TaskRuntime::Access;
+
+    // Constants
+    const T one(1);
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t k = min(m, n);
+    const idx_t nb = (idx_t)opts.nb;
+
+    // check arguments
+    tlapack_check((idx_t)size(piv) >= k);
+    tlapack_check(nb > 0);
+
+    // Quick return
+    if (k <= 0) return 0;
+
+    internal::tiled_session session(opts);
+    TaskRuntime& rt = session.runtime();
+    const idx_t nx = internal::tiled_count(m, nb);
+    const idx_t ny = internal::tiled_count(n, nb);
+    const idx_t nt = internal::tiled_count(k, nb);
+
+    auto key = [&](idx_t i, idx_t j) -> const void* {
+        return &A(i * nb, j * nb);
+    };
+
+    std::vector<int> info(nt, 0);
+
+    for (idx_t kt = 0; kt < nt; ++kt) {
+        const idx_t i0 = kt * nb;
+        const idx_t kb = min(nb, k - i0);
+        const void* pkey = &piv[i0];
+
+        // Factor the panel. If m < n, the last panel is narrower than its
+        // tiles, and the task also updates the remaining columns of the tiles
+        {
+            const idx_t j1 = min(i0 + nb, n);
+            auto Ap = slice(A, range(i0, m), range(i0, i0 + kb));
+            auto Ar = slice(A, range(i0, m), range(i0 + kb, j1));
+            auto pk = slice(piv, range(i0, i0 + kb));
+            std::vector<TaskRuntime::Dependency> deps;
+            for (idx_t it = kt; it < nx; ++it)
+                deps.push_back({key(it, kt), Access::ReadWrite});
+            deps.push_back({pkey, Access::Write});
+            rt.submit(
+                [Ap, Ar, pk, &info, kt, i0, kb, one]() mutable {
+                    info[kt] = getrf(Ap, pk);
+                    if (ncols(Ar) > 0) {
+                        for (idx_t j = 0; j < kb; ++j) {
+                            if (idx_t(pk[j]) != j) {
+                                auto vect1 = row(Ar, j);
+                                auto vect2 = row(Ar, pk[j]);
+                                tlapack::swap(vect1, vect2);
+                            }
+                        }
+                        const idx_t mp = nrows(Ap);
+                        auto L11 = slice(Ap, range(0, kb), range(0, kb));
+                        auto L21 = slice(Ap, range(kb, mp), range(0, kb));
+                        auto A12 = rows(Ar, range(0, kb));
+                        auto A22 = rows(Ar, range(kb, mp));
+                        trsm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG,
+                             one, L11, A12);
+                        gemm(NO_TRANS, NO_TRANS, -one, L21, A12, one, A22);
+                    }
+                    for (idx_t j = 0; j < kb; ++j)
+                        pk[j] += i0;
+                },
+                deps);
+        }
+
+        // Apply the row interchanges to the other columns of tiles
+        for (idx_t jt = 0; jt < ny; ++jt) {
+            if (jt == kt) continue;
+            const idx_t j0 = jt * nb;
+            auto Aj = slice(A, range(0, m), range(j0, min(j0 + nb, n)));
+            auto pk = slice(piv, range(i0, i0 + kb));
+            std::vector<TaskRuntime::Dependency> deps;
+            for (idx_t it = kt; it < nx; ++it)
+                deps.push_back({key(it, jt), Access::ReadWrite});
+            deps.push_back({pkey, Access::Read});
+            rt.submit(
+                [Aj, pk, i0, kb]() mutable {
+                    for (idx_t j = 0; j < kb; ++j) {
+                        if (idx_t(pk[j]) != i0 + j) {
+                            auto vect1 = row(Aj, i0 + j);
+                            auto vect2 = row(Aj, pk[j]);
+                            tlapack::swap(vect1, vect2);
+                        }
+                    }
+                },
+                deps);
+        }
+
+        // Update the trailing matrix
+        auto Akk = slice(A, range(i0, i0 + kb), range(i0, i0 + kb));
+        for (idx_t jt = kt + 1; jt < ny; ++jt) {
+            const idx_t j0 = jt * nb;
+            auto Akj = slice(A, range(i0, i0 + kb), range(j0, min(j0 + nb, n)));
+            rt.submit(
+                [Akk, Akj, one]() mutable {
+                    trsm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, one,
+                         Akk, Akj);
+                },
+                {{key(kt, kt), Access::Read},
+                 {key(kt, jt), Access::ReadWrite}});
+        }
+        for (idx_t it = kt + 1; it < nx; ++it) {
+            const idx_t r0 = it * nb;
+            auto Aik = slice(A, range(r0, min(r0 + nb, m)), range(i0, i0 + kb));
+            for (idx_t jt = kt + 1; jt < ny; ++jt) {
+                const idx_t j0 = jt * nb;
+                auto Akj =
+                    slice(A, range(i0, i0 + kb), range(j0, min(j0 + nb, n)));
+                auto Aij = slice(A, range(r0, min(r0 + nb, m)),
+                                 range(j0, min(j0 + nb, n)));
+                rt.submit(
+                    [Aik, Akj, Aij, one]() mutable {
+                        gemm(NO_TRANS, NO_TRANS, -one, Aik, Akj, one, Aij);
+                    },
+                    {{key(it, kt), Access::Read},
+                     {key(kt, jt), Access::Read},
+                     {key(it, jt), Access::ReadWrite}});
+            }
+        }
+    }
+
+    rt.wait();
+
+    for (idx_t kt = 0; kt < nt; ++kt)
+        if (info[kt] != 0) return kt * nb + info[kt];
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GETRF_TILED_HH
@@ -0,0 +1,99 @@
+/// @file getrs.hpp Apply the LU factorization to solve a linear system.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GETRS_HH
+#define TLAPACK_GETRS_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/swap.hpp"
+#include "tlapack/blas/trsm.hpp"
+
+namespace tlapack {
+
+/** Apply the LU factorization to solve a linear system.
+ * \[
+ *      op(A) X = B,
+ * \]
+ * where $P A = L U$ was computed by getrf().
+ *
+ * The factors and B may have different precisions. In that case, the
+ * triangular solves are computed in the precision of
+ * scalar_type<type_t<matrixA_t>, type_t<matrixB_t>>.
+ *
+ * @param[in] trans
+ *     The form of $op(A)$:
+ *     - Op::NoTrans:   $op(A) = A$.
+ *     - Op::Trans:     $op(A) = A^T$.
+ *     - Op::ConjTrans: $op(A) = A^H$.
+ *
+ * @param[in] A n-by-n matrix.
+ *      The factors L and U from the factorization $P A = L U$;
+ *      the unit diagonal elements of L are not stored.
+ *
+ * @param[in] piv Vector of length n.
+ *      The pivot indices from getrf().
+ *
+ * @param[in,out] B n-by-nrhs matrix.
+ *      On entry, the matrix B.
+ *      On exit,  the matrix X.
+ *
+ * @return = 0: successful exit.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_OP op_t,
+          TLAPACK_MATRIX matrixA_t,
+          TLAPACK_VECTOR piv_t,
+          TLAPACK_MATRIX matrixB_t>
+int getrs(op_t trans, const matrixA_t& A, const piv_t& piv, matrixB_t& B)
+{
+    using T = type_t<matrixB_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<matrixA_t>;
+
+    // Constants
+    const real_t one(1);
+    const idx_t n = nrows(A);
+
+    // Check arguments
+    tlapack_check_false(trans != Op::NoTrans && trans != Op::Trans &&
+                        trans != Op::ConjTrans);
+    tlapack_check_false(nrows(A) != ncols(A));
+    tlapack_check_false(nrows(B) != n);
+    tlapack_check_false((idx_t)size(piv) < n);
+
+    if (trans == Op::NoTrans) {
+        // Solve A*X = B where P*A = L*U.
+        for (idx_t i = 0; i < n; ++i) {
+            if ((idx_t)piv[i] != i) {
+                auto vect1 = row(B, i);
+                auto vect2 = row(B, piv[i]);
+                tlapack::swap(vect1, vect2);
+            }
+        }
+        trsm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, one, A, B);
+        trsm(LEFT_SIDE, UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, one, A, B);
+    }
+    else {
+        // Solve A**T*X = B or A**H*X = B where P*A = L*U.
+        trsm(LEFT_SIDE, UPPER_TRIANGLE, trans, NON_UNIT_DIAG, one, A, B);
+        trsm(LEFT_SIDE, LOWER_TRIANGLE, trans, UNIT_DIAG, one, A, B);
+        for (idx_t i = n; i-- > 0;) {
+            if ((idx_t)piv[i] != i) {
+                auto vect1 = row(B, i);
+                auto vect2 = row(B, piv[i]);
+                tlapack::swap(vect1, vect2);
+            }
+        }
+    }
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GETRS_HH
@@ -0,0 +1,244 @@
+/// @file heev.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zheev.f
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zheevd.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_HEEV_HH
+#define TLAPACK_HEEV_HH
+
+#include "tlapack/base/constants.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/hetrd.hpp"
+#include "tlapack/lapack/lanhe.hpp"
+#include "tlapack/lapack/lascl.hpp"
+#include "tlapack/lapack/stedc.hpp"
+#include "tlapack/lapack/steqr.hpp"
+#include "tlapack/lapack/ungtr.hpp"
+
+namespace tlapack {
+
+/// @brief Variants of the algorithm to compute the eigenvalues and
+/// eigenvectors of the tridiagonal matrix in heev().
+enum class HeevVariant : char { QRIteration = 'Q', DivideConquer = 'D' };
+
+/// @brief Options struct for heev()
+struct HeevOpts : public HetrdOpts {
+    HeevVariant variant = HeevVariant::DivideConquer;
+    size_t smlsiz = 25;  ///< Size of the subproblems solved by steqr() in the
+                         ///< divide and conquer method
+};
+
+/** Worspace query of heev()
+ *
+ * @param[in] want_z bool
+ * @param[in] uplo
+ *      - Uplo::Upper:   Upper triangle of A is referenced;
+ *      - Uplo::Lower:   Lower triangle of A is referenced;
+ * @param[in] A n-by-n Hermitian matrix.
+ * @param[in] w Real vector of length n.
+ *
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T,
+          TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SVECTOR r_vector_t,
+          class uplo_t>
+constexpr WorkInfo heev_worksize(bool want_z,
+                                 uplo_t uplo,
+                                 const matrix_t& A,
+                                 const r_vector_t& w,
+                                 const HeevOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using work_t = matrix_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+
+    const idx_t n = ncols(A);
+
+    WorkInfo workinfo;
+    if constexpr (is_same_v<T, type_t<work_t>>) {
+        if (n > 1) {
+            // Vector tau
+            workinfo = WorkInfo(n - 1);
+
+            auto&& tau = slice(A, range{0, n - 1}, 0);
+            workinfo += hetrd_worksize<T>(uplo, A, tau, opts);
+        }
+    }
+
+    return workinfo;
+}
+
+/** @copybrief heev()
+ * Workspace is provided as an argument.
+ * @copydetails heev()
+ *
+ * @param[out] e Real vector of length n-1.
+ *      Workspace for the off-diagonal of the tridiagonal matrix.
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SVECTOR r_vector_t,
+          TLAPACK_SVECTOR e_t,
+          TLAPACK_WORKSPACE work_t,
+          class uplo_t>
+int heev_work(bool want_z,
+              uplo_t uplo,
+              matrix_t& A,
+              r_vector_t& w,
+              e_t& e,
+              work_t& work,
+              const HeevOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+
+    // constants
+    const real_t one(1);
+    const idx_t n = ncols(A);
+
+    // check arguments
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check(nrows(A) == n);
+    tlapack_check((idx_t)size(w) >= n);
+    tlapack_check((idx_t)size(e) + 1 >= n);
+
+    // quick return
+    if (n <= 0) return 0;
+    if (n == 1) {
+        w[0] = real(A(0, 0));
+        if (want_z) A(0, 0) = one;
+        return 0;
+    }
+
+    // Scale the matrix to allowable range, if necessary
+    const real_t rmin = sqrt(safe_min<real_t>() / ulp<real_t>());
+    const real_t rmax = one / rmin;
+    const real_t anrm = lanhe(MAX_NORM, uplo, A);
+    real_t sigma = one;
+    if (anrm > real_t(0) && anrm < rmin)
+        sigma = rmin / anrm;
+    else if (anrm > rmax)
+        sigma = rmax / anrm;
+    if (sigma != one) lascl(uplo, anrm, anrm * sigma, A);
+
+    // Reduce A to real symmetric tridiagonal form
+    auto [tau, work2] = reshape(work, n - 1);
+    hetrd_work(uplo, A, tau, work2, opts);
+
+    for (idx_t i = 0; i < n; ++i)
+        w[i] = real(A(i, i));
+    for (idx_t i = 0; i < n - 1; ++i)
+        e[i] = (uplo == Uplo::Upper) ? real(A(i, i + 1)) : real(A(i + 1, i));
+
+    // Form the unitary matrix Q only if the eigenvectors are wanted
+    if (want_z) ungtr(uplo, A, tau);
+
+    // Compute the eigenvalues and, optionally, the eigenvectors
+    int info;
+    if (opts.variant == HeevVariant::DivideConquer) {
+        StedcOpts stedcOpts;
+        stedcOpts.smlsiz = opts.smlsiz;
+        info = stedc(want_z, w, e, A, stedcOpts);
+    }
+    else
+        info = steqr(want_z, w, e, A);
+
+    // Undo the scaling of the eigenvalues
+    if (sigma != one) {
+        const idx_t m = (info == 0) ? n : info - 1;
+        for (idx_t i = 0; i < m; ++i)
+            w[i] /= sigma;
+    }
+
+    return info;
+}
+
+/** Computes all eigenvalues and, optionally, eigenvectors of a Hermitian
+ * matrix A.
+ *
+ * The matrix is first reduced to real symmetric tridiagonal form by hetrd().
+ * The eigenvalues and eigenvectors of the tridiagonal matrix are then computed
+ * by either the implicit QR iteration, steqr(), or the divide and conquer
+ * method, stedc(). If only the eigenvalues are wanted, the unitary matrix from
+ * the reduction is never formed.
+ *
+ * @return 0 if success.
+ * @return i > 0 if the algorithm failed to converge. See steqr() and stedc().
+ *
+ * @tparam uplo_t Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] want_z bool
+ *      - false: Compute eigenvalues only.
+ *      - true:  Compute eigenvalues and eigenvectors.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper:   Upper triangle of A is referenced;
+ *      - Uplo::Lower:   Lower triangle of A is referenced;
+ *
+ * @param[in,out] A n-by-n Hermitian matrix.
+ *      On exit, if want_z = true and the return value is 0, A contains the
+ *      orthonormal eigenvectors of the matrix A. If want_z = false, the
+ *      triangle of A referenced by uplo, including the diagonal, is
+ *      destroyed.
+ *
+ * @param[out] w Real vector of length n.
+ *      If the return value is 0, the eigenvalues in ascending order.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.variant: Method used on the tridiagonal matrix.
+ *      - @c opts.nb, @c opts.nx_switch: Options for hetrd().
+ *      - @c opts.smlsiz: Option for stedc().
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_SMATRIX matrix_t, TLAPACK_SVECTOR r_vector_t, class uplo_t>
+int heev(bool want_z,
+         uplo_t uplo,
+         matrix_t& A,
+         r_vector_t& w,
+         const HeevOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using work_t = matrix_type<matrix_t>;
+    using T = type_t<work_t>;
+    using real_t = real_type<T>;
+
+    // Functors
+    Create<work_t> new_matrix;
+    Create<vector_type<r_vector_t>> new_rvector;
+
+    // constants
+    const idx_t n = ncols(A);
+
+    // quick return
+    if (n <= 0) return 0;
+
+    // Gets workspace from the arena
+    WorkInfo workinfo = heev_worksize<T>(want_z, uplo, A, w, opts);
+    auto work_ = workspace_arena<T>().get(workinfo);
+    auto work = new_matrix(work_.vector(), workinfo.m, workinfo.n);
+
+    auto e_ = workspace_arena<real_t>().get(n - 1);
+    auto e = new_rvector(e_.vector(), n - 1);
+
+    return heev_work(want_z, uplo, A, w, e, work, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_HEEV_HH
@@ -0,0 +1,246 @@
+/// @file hetrd.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zhetrd.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_HETRD_HH
+#define TLAPACK_HETRD_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/her2k.hpp"
+#include "tlapack/lapack/hetd2.hpp"
+#include "tlapack/lapack/latrd.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for hetrd
+ */
+struct HetrdOpts {
+    size_t nb = 32;          ///< Block size used in the blocked reduction
+    size_t nx_switch = 128;  ///< If only nx_switch columns are left, the
+                             ///< algorithm will use unblocked code
+};
+
+/** Worspace query of hetrd()
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper:   Upper triangle of A is referenced;
+ *      - Uplo::Lower:   Lower triangle of A is referenced;
+ * @param[in] A n-by-n Hermitian matrix.
+ * @param tau Vector of length n-1.
+ *
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T,
+          TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SVECTOR vector_t,
+          class uplo_t>
+constexpr WorkInfo hetrd_worksize(uplo_t uplo,
+                                  const matrix_t& A,
+                                  const vector_t& tau,
+                                  const HetrdOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using work_t = matrix_type<matrix_t, vector_t>;
+
+    const idx_t n = ncols(A);
+    const idx_t nb = min<idx_t>(opts.nb, n);
+    const idx_t nx = max<idx_t>(nb, opts.nx_switch);
+
+    WorkInfo workinfo;
+    if constexpr (is_same_v<T, type_t<work_t>>) {
+        // The matrix W and the off-diagonal entries of each panel
+        if (nb > 1 && nx < n) workinfo = WorkInfo(n + 1, nb);
+    }
+
+    return workinfo;
+}
+
+/** @copybrief hetrd()
+ * Workspace is provided as an argument.
+ * @copydetails hetrd()
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          TLAPACK_SVECTOR vector_t,
+          TLAPACK_WORKSPACE work_t,
+          class uplo_t>
+int hetrd_work(uplo_t uplo,
+               matrix_t& A,
+               vector_t& tau,
+               work_t& work,
+               const HetrdOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+    using TA = type_t<matrix_t>;
+    using real_t = real_type<TA>;
+
+    // constants
+    const real_t one(1);
+    const idx_t n = ncols(A);
+
+    // Blocksize
+    const idx_t nb = min<idx_t>(opts.nb, n);
+    // Size of the last block which be handled with unblocked code
+    const idx_t nx = max<idx_t>(nb, opts.nx_switch);
+
+    // check arguments
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check(nrows(A) == n);
+    tlapack_check((idx_t)size(tau) >= n - 1);
+
+    // quick return
+    if (n <= 0) return 0;
+
+    // Use unblocked code if the matrix is small
+    if (nb <= 1 || nx >= n) return hetd2(uplo, A, tau);
+
+    // Matrix W and the off-diagonal entries of the current panel
+    auto [W, work2] = reshape(work, n, nb);
+    auto [e, work3] = reshape(work2, nb);
+
+    if (uplo == Uplo::Upper) {
+        // Columns kk:n are reduced with the blocked code
+        const idx_t kk = n - ((n - nx + nb - 1) / nb) * nb;
+
+        for (idx_t i_end = n; i_end > kk; i_end -= nb) {
+            const idx_t i = i_end - nb;
+
+            // Reduce columns i:i+nb to tridiagonal form and form the matrix W
+            // which is needed to update the unreduced part of the matrix
+            auto A1 = slice(A, range{0, i + nb}, range{0, i + nb});
+            auto W1 = slice(W, range{0, i + nb}, range{0, nb});
+            latrd(uplo, A1, e, tau, W1);
+
+            // Update the unreduced submatrix A(0:i,0:i), using an update of
+            // the form:  A := A - V*W**H - W*V**H
+            auto V = slice(A, range{0, i}, range{i, i + nb});
+            auto W2 = slice(W, range{0, i}, range{0, nb});
+            auto A2 = slice(A, range{0, i}, range{0, i});
+            her2k(UPPER_TRIANGLE, NO_TRANS, -one, V, W2, one, A2);
+
+            // Copy the superdiagonal elements back into A
+            for (idx_t j = i; j < i + nb; ++j)
+                A(j - 1, j) = e[j - i];
+        }
+
+        // Use unblocked code to reduce the last or only block
+        auto A1 = slice(A, range{0, kk}, range{0, kk});
+        auto tau1 = slice(tau, range{0, kk - 1});
+        return hetd2(uplo, A1, tau1);
+    }
+    else {
+        idx_t i = 0;
+        for (; i + nx < n; i += nb) {
+            // Reduce columns i:i+nb to tridiagonal form and form the matrix W
+            // which is needed to update the unreduced part of the matrix
+            auto A1 = slice(A, range{i, n}, range{i, n});
+            auto tau1 = slice(tau, range{i, n - 1});
+            auto W1 = slice(W, range{0, n - i}, range{0, nb});
+            latrd(uplo, A1, e, tau1, W1);
+
+            // Update the unreduced submatrix A(i+nb:n,i+nb:n), using an update
+            // of the form:  A := A - V*W**H - W*V**H
+            auto V = slice(A, range{i + nb, n}, range{i, i + nb});
+            auto W2 = slice(W, range{nb, n - i}, range{0, nb});
+            auto A2 = slice(A, range{i + nb, n}, range{i + nb, n});
+            her2k(LOWER_TRIANGLE, NO_TRANS, -one, V, W2, one, A2);
+
+            // Copy the subdiagonal elements back into A
+            for (idx_t j = i; j < i + nb; ++j)
+                A(j + 1, j) = e[j - i];
+        }
+
+        // Use unblocked code to reduce the last or only block
+        auto A1 = slice(A, range{i, n}, range{i, n});
+        auto tau1 = slice(tau, range{i, n - 1});
+        return hetd2(uplo, A1, tau1);
+    }
+}
+
+/** Reduces a Hermitian matrix to real symmetric tridiagonal form by a unitary
+ * similarity transformation:
+ * Q**H * A * Q = T.
+ *
+ * This is the blocked version of hetd2(). Panels of nb columns are reduced by
+ * latrd(), and the remaining part of the matrix is updated with a rank-2k
+ * update her2k(), so that half of the flops are done in level 3 BLAS. The last
+ * nx_switch columns are reduced by hetd2().
+ *
+ * The matrix Q is represented as a product of elementary reflectors. If
+ * uplo = Uplo::Upper,
+ * \[
+ *          Q = H_{n-2} ... H_1 H_0,
+ * \]
+ * where v[i+1:n] = 0 and v[i] = 1 in H_i, and v[0:i] is stored on exit in
+ * A(0:i,i+1). If uplo = Uplo::Lower,
+ * \[
+ *          Q = H_0 H_1 ... H_{n-2},
+ * \]
+ * where v[0:i+1] = 0 and v[i+1] = 1 in H_i, and v[i+2:n] is stored on exit in
+ * A(i+2:n,i). In both cases, H_i = I - tau[i] * v * v**H.
+ *
+ * @return  0 if success
+ *
+ * @tparam uplo_t Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper:   Upper triangle of A is referenced;
+ *      - Uplo::Lower:   Lower triangle of A is referenced;
+ *
+ * @param[in,out] A n-by-n Hermitian matrix.
+ *      On exit, the main diagonal and offdiagonal contain the elements of the
+ * symmetric tridiagonal matrix B. The other positions are used to store
+ * elementary Householder reflectors.
+ *
+ * @param[out] tau Vector of length n-1.
+ *      The scalar factors of the elementary reflectors.
+ *
+ * @param[in] opts Options.
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_SMATRIX matrix_t, TLAPACK_SVECTOR vector_t, class uplo_t>
+int hetrd(uplo_t uplo,
+          matrix_t& A,
+          vector_t& tau,
+          const HetrdOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using work_t = matrix_type<matrix_t, vector_t>;
+    using T = type_t<work_t>;
+
+    // Functor
+    Create<work_t> new_matrix;
+
+    // constants
+    const idx_t n = ncols(A);
+
+    // quick return
+    if (n <= 0) return 0;
+
+    // Gets workspace from the arena
+    WorkInfo workinfo = hetrd_worksize<T>(uplo, A, tau, opts);
+    auto work_ = workspace_arena<T>().get(workinfo);
+    auto work = new_matrix(work_.vector(), workinfo.m, workinfo.n);
+
+    return hetrd_work(uplo, A, tau, work, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_HETRD_HH
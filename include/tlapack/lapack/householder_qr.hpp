@@ -13,11 +13,16 @@
 #include "tlapack/base/utils.hpp"
 #include "tlapack/lapack/geqr2.hpp"
 #include "tlapack/lapack/geqrf.hpp"
+#include "tlapack/lapack/geqrf_recursive.hpp"
 
 namespace tlapack {
 
 /// @brief Variants of the algorithm to compute the QR factorization.
-enum class HouseholderQRVariant : char { Level2 = '2', Blocked = 'B' };
+enum class HouseholderQRVariant : char {
+    Level2 = '2',
+    Blocked = 'B',
+    Recursive = 'R'
+};
 
 /// @brief Options struct for householder_qr()
 struct HouseholderQROpts : public GeqrfOpts {
@@ -45,6 +50,8 @@ constexpr WorkInfo householder_qr_worksize(const matrix_t& A,
     // Call variant
     if (opts.variant == HouseholderQRVariant::Level2)
         return geqr2_worksize<T>(A, tau);
+    else if (opts.variant == HouseholderQRVariant::Recursive)
+        return geqrf_recursive_worksize<T>(A, tau, opts);
     else
         return geqrf_worksize<T>(A, tau, opts);
 }
@@ -68,6 +75,8 @@ int householder_qr_work(matrix_t& A,
     // Call variant
     if (opts.variant == HouseholderQRVariant::Level2)
         return geqr2_work(A, tau, work);
+    else if (opts.variant == HouseholderQRVariant::Recursive)
+        return geqrf_recursive_work(A, tau, work, opts);
     else
         return geqrf_work(A, tau, work, opts);
 }
@@ -102,6 +111,11 @@ int householder_qr_work(matrix_t& A,
  *      The scalar factors of the elementary reflectors.
  *
  * @param[in] opts Options.
+ *      - @c opts.variant:
+ *          - Blocked = 'B': geqrf(),
+ *          - Recursive = 'R': geqrf_recursive(),
+ *          - Level2 = '2': geqr2().
+ *      - @c opts.nb: Block size.
  *
  * @ingroup variant_interface
  */
@@ -113,6 +127,8 @@ int householder_qr(matrix_t& A,
     // Call variant
     if (opts.variant == HouseholderQRVariant::Level2)
         return geqr2(A, tau);
+    else if (opts.variant == HouseholderQRVariant::Recursive)
+        return geqrf_recursive(A, tau, opts);
     else
         return geqrf(A, tau, opts);
 }
@@ -0,0 +1,314 @@
+/// @file iterative_refinement.hpp Iterative refinement of the solution of a
+/// linear system using a low-precision factorization.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_ITERATIVE_REFINEMENT_HH
+#define TLAPACK_ITERATIVE_REFINEMENT_HH
+
+#include <vector>
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/axpy.hpp"
+#include "tlapack/blas/dot.hpp"
+#include "tlapack/blas/nrm2.hpp"
+#include "tlapack/blas/rotg.hpp"
+#include "tlapack/blas/scal.hpp"
+#include "tlapack/lapack/RefinementOpts.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/lange.hpp"
+#include "tlapack/lapack/lascl.hpp"
+#include "tlapack/lapack/laset.hpp"
+
+namespace tlapack {
+
+namespace internal {
+
+    /** Solves A d = r with GMRES preconditioned from the left by M, and adds
+     * the solution to x.
+     *
+     * @param[in] apply_A Callable (alpha, X, beta, Y) that computes
+     *      $Y := \alpha A X + \beta Y$.
+     * @param[in] precond Callable (V) that overwrites the n-by-1 matrix V with
+     *      $M^{-1} V$.
+     * @param[in] r n-by-1 matrix.
+     * @param[in,out] x n-by-1 matrix.
+     * @param V n-by-(m+1) workspace, where m is the maximum number of
+     *      iterations.
+     * @param H (m+1)-by-m workspace.
+     * @param[in] tol Relative tolerance for the preconditioned residual.
+     *
+     * @return Number of iterations.
+     */
+    template <class applyA_t,
+              class precond_t,
+              TLAPACK_SMATRIX matrixR_t,
+              TLAPACK_SMATRIX matrixX_t,
+              TLAPACK_SMATRIX matrixV_t,
+              TLAPACK_SMATRIX matrixH_t>
+    int gmres_correction(applyA_t& apply_A,
+                         precond_t& precond,
+                         const matrixR_t& r,
+                         matrixX_t& x,
+                         matrixV_t& V,
+                         matrixH_t& H,
+                         real_type<type_t<matrixV_t>> tol)
+    {
+        using T = type_t<matrixV_t>;
+        using real_t = real_type<T>;
+        using idx_t = size_type<matrixV_t>;
+        using range = pair<idx_t, idx_t>;
+
+        // Constants
+        const real_t zero(0);
+        const real_t one(1);
+        const idx_t m = ncols(H);
+
+        // Rotations and right-hand side of the least squares problem
+        std::vector<real_t> cs(m);
+        std::vector<T> sn(m);
+        std::vector<T> g(m + 1, T(0));
+
+        // Initial vector
+        auto v0 = cols(V, range(0, 1));
+        lacpy(GENERAL, r, v0);
+        precond(v0);
+        auto v0_ = col(V, 0);
+        const real_t beta = nrm2(v0_);
+        if (beta == zero) return 0;
+        scal(one / beta, v0_);
+        g[0] = beta;
+
+        // Arnoldi process
+        idx_t k = 0;
+        while (k < m) {
+            auto vk = cols(V, range(k, k + 1));
+            auto w = cols(V, range(k + 1, k + 2));
+            apply_A(T(one), vk, T(zero), w);
+            precond(w);
+
+            // Modified Gram-Schmidt
+            auto w_ = col(V, k + 1);
+            for (idx_t i = 0; i <= k; ++i) {
+                auto vi = col(V, i);
+                H(i, k) = dot(vi, w_);
+                axpy(-H(i, k), vi, w_);
+            }
+            const real_t hnrm = nrm2(w_);
+            H(k + 1, k) = hnrm;
+            if (hnrm != zero) scal(one / hnrm, w_);
+
+            // Apply the previous rotations to the new column of H
+            for (idx_t i = 0; i < k; ++i) {
+                const T temp = cs[i] * H(i, k) + sn[i] * H(i + 1, k);
+                H(i + 1, k) = -conj(sn[i]) * H(i, k) + cs[i] * H(i + 1, k);
+                H(i, k) = temp;
+            }
+
+            // Annihilate H(k+1,k)
+            T a = H(k, k);
+            T b = H(k + 1, k);
+            rotg(a, b, cs[k], sn[k]);
+            H(k, k) = a;
+            H(k + 1, k) = zero;
+            g[k + 1] = -conj(sn[k]) * g[k];
+            g[k] = cs[k] * g[k];
+
+            ++k;
+            if (abs(g[k]) <= tol * beta || hnrm == zero) break;
+        }
+
+        // Solve the triangular system H(0:k,0:k) y = g(0:k)
+        for (idx_t i = k; i-- > 0;) {
+            for (idx_t l = i + 1; l < k; ++l)
+                g[i] -= H(i, l) * g[l];
+            g[i] /= H(i, i);
+        }
+
+        // x := x + V(:,0:k) y
+        auto x_ = col(x, 0);
+        for (idx_t l = 0; l < k; ++l)
+            axpy(g[l], col(V, l), x_);
+
+        return (int)k;
+    }
+
+    /** Solves A X = B with iterative refinement using a factorization of A
+     * computed in a lower precision.
+     *
+     * First, the classical iterative refinement computes the corrections with
+     * the low-precision factorization and the residuals in the working
+     * precision. If it stalls and opts.use_gmres is true, each column of X is
+     * refined with GMRES-IR, where the corrections are computed by GMRES
+     * preconditioned with the low-precision factorization.
+     *
+     * The refinement converges when
+     * \[
+     *      \|B_j - A X_j\|_\infty \leq \|A\|_\infty \|X_j\|_\infty
+     *      \sqrt{n} \epsilon
+     * \]
+     * for all columns j, where $\epsilon$ is the machine epsilon of the
+     * working precision.
+     *
+     * @param[in] apply_A Callable (alpha, X, beta, Y) that computes
+     *      $Y := \alpha A X + \beta Y$ in the working precision.
+     * @param[in] solve_low Callable (R) that overwrites R by $M^{-1} R$,
+     *      computed in the low precision. R is scaled to have entries of
+     *      magnitude at most one.
+     * @param[in] precond Callable (V) that overwrites the n-by-1 matrix V with
+     *      $M^{-1} V$, computed in the working precision.
+     * @param[in] anrm Infinity norm of A.
+     * @param[in] B n-by-nrhs matrix.
+     * @param[in,out] X n-by-nrhs matrix.
+     *      On exit, the refined solution.
+     * @param[in,out] opts Options. The statistics are updated on exit.
+     *
+     * @return true if the refinement converged.
+     */
+    template <class applyA_t,
+              class solve_t,
+              class precond_t,
+              TLAPACK_SMATRIX matrixB_t,
+              TLAPACK_SMATRIX matrixX_t>
+    bool mixed_precision_refinement(applyA_t&& apply_A,
+                                    solve_t&& solve_low,
+                                    precond_t&& precond,
+                                    real_type<type_t<matrixX_t>> anrm,
+                                    const matrixB_t& B,
+                                    matrixX_t& X,
+                                    RefinementOpts& opts)
+    {
+        using T = type_t<matrixX_t>;
+        using real_t = real_type<T>;
+        using idx_t = size_type<matrixX_t>;
+        using range = pair<idx_t, idx_t>;
+        using work_t = matrix_type<matrixX_t>;
+
+        // Functor
+        Create<work_t> new_matrix;
+
+        // Constants
+        const real_t zero(0);
+        const real_t one(1);
+        const idx_t n = nrows(X);
+        const idx_t nrhs = ncols(X);
+        const real_t eps = ulp<real_t>();
+        const real_t cte = anrm * eps * sqrt(real_t(n));
+        // The refinement stalls if a step does not reduce the backward error
+        // by this factor
+        const real_t rthresh(0.5);
+
+        // Residual and correction
+        std::vector<T> R_;
+        auto R = new_matrix(R_, n, nrhs);
+        std::vector<T> D_;
+        auto D = new_matrix(D_, n, nrhs);
+
+        // Computes R := B - A X and returns the backward error
+        auto residual = [&](const auto& B_, auto& X_, auto& R_,
+                            bool& converged) -> real_t {
+            lacpy(GENERAL, B_, R_);
+            apply_A(T(-one), X_, T(one), R_);
+            real_t berr(0);
+            converged = true;
+            for (idx_t j = 0; j < ncols(R_); ++j) {
+                const real_t rnrm = lange(MAX_NORM, cols(R_, range(j, j + 1)));
+                const real_t xnrm = lange(MAX_NORM, cols(X_, range(j, j + 1)));
+                const real_t bnrm = lange(MAX_NORM, cols(B_, range(j, j + 1)));
+                if (!(rnrm <= xnrm * cte)) converged = false;
+                if (isnan(rnrm))
+                    berr = rnrm;
+                else if (rnrm > zero)
+                    berr = max(berr, rnrm / (anrm * xnrm + bnrm));
+            }
+            return berr;
+        };
+
+        // Computes R := M^{-1} R in the low precision. R is scaled to avoid
+        // overflow and underflow in the conversion.
+        auto solve_scaled = [&](auto& R_) {
+            const real_t rnrm = lange(MAX_NORM, R_);
+            if (rnrm == zero) return;
+            if (isnan(rnrm) || isinf(rnrm)) {
+                solve_low(R_);
+                return;
+            }
+            lascl(GENERAL, rnrm, one, R_);
+            solve_low(R_);
+            lascl(GENERAL, one, rnrm, R_);
+        };
+
+        // Classical iterative refinement
+        lacpy(GENERAL, B, X);
+        solve_scaled(X);
+        bool converged = false;
+        real_t berr_prev(0);
+        for (int iter = 0;; ++iter) {
+            const real_t berr = residual(B, X, R, converged);
+            opts.backward_error = berr;
+            if (converged) {
+                opts.solver = RefinementSolver::Refinement;
+                return true;
+            }
+            if (iter > 0 && !(berr <= rthresh * berr_prev)) {
+                // Undo the last step, which did not improve the solution
+                for (idx_t j = 0; j < nrhs; ++j)
+                    for (idx_t i = 0; i < n; ++i)
+                        X(i, j) -= D(i, j);
+                opts.backward_error = berr_prev;
+                break;
+            }
+            if (iter >= opts.max_iter) break;
+            berr_prev = berr;
+
+            lacpy(GENERAL, R, D);
+            solve_scaled(D);
+            for (idx_t j = 0; j < nrhs; ++j)
+                for (idx_t i = 0; i < n; ++i)
+                    X(i, j) += D(i, j);
+            opts.n_iter++;
+        }
+
+        if (!opts.use_gmres || opts.gmres_max_iter <= 0) return false;
+
+        // GMRES-IR on each column of X
+        if (isnan(opts.backward_error) || isinf(opts.backward_error))
+            laset(GENERAL, zero, zero, X);
+        const idx_t m = min<idx_t>(opts.gmres_max_iter, n);
+        std::vector<T> V_;
+        auto V = new_matrix(V_, n, m + 1);
+        std::vector<T> H_;
+        auto H = new_matrix(H_, m + 1, m);
+        for (idx_t j = 0; j < nrhs; ++j) {
+            auto xj = cols(X, range(j, j + 1));
+            auto bj = cols(B, range(j, j + 1));
+            auto rj = cols(R, range(j, j + 1));
+            real_t berr_prev(0);
+            for (int iter = 0;; ++iter) {
+                bool converged_j;
+                const real_t berr = residual(bj, xj, rj, converged_j);
+                if (converged_j || iter >= opts.max_iter ||
+                    (iter > 0 && !(berr <= rthresh * berr_prev)))
+                    break;
+                berr_prev = berr;
+
+                opts.n_gmres_step++;
+                opts.n_gmres_iter += gmres_correction(
+                    apply_A, precond, rj, xj, V, H, real_t(opts.gmres_tol));
+            }
+        }
+
+        opts.backward_error = residual(B, X, R, converged);
+        if (converged) opts.solver = RefinementSolver::GMRES;
+        return converged;
+    }
+
+}  // namespace internal
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_ITERATIVE_REFINEMENT_HH
@@ -0,0 +1,104 @@
+/// @file laed0.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlaed0.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LAED0_HH
+#define TLAPACK_LAED0_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/laed1.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/steqr.hpp"
+
+namespace tlapack {
+
+/**
+ * LAED0 used by STEDC. Computes all eigenvalues and corresponding
+ * eigenvectors of an unreduced symmetric tridiagonal matrix using the divide
+ * and conquer method.
+ *
+ * The matrix is split in two halves with a rank-one modification, the
+ * eigensystems of the halves are computed recursively and then merged with
+ * laed1(). Subproblems of size at most smlsiz are solved by steqr().
+ *
+ * @param[in,out] d Real vector of length n.
+ *      On entry, the main diagonal of the tridiagonal matrix.
+ *      On exit, its eigenvalues in ascending order.
+ *
+ * @param[in,out] e Real vector of length n-1.
+ *      The off-diagonal elements of the tridiagonal matrix.
+ *      On exit, e has been destroyed.
+ *
+ * @param[out] Q Real n-by-n matrix.
+ *      On exit, Q contains the orthonormal eigenvectors of the symmetric
+ *      tridiagonal matrix.
+ *
+ * @param[in] smlsiz
+ *      Maximum size of the subproblems at the bottom of the recursion.
+ *
+ * @return 0 if success.
+ * @return 1 if an eigenvalue did not converge.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_VECTOR d_t, TLAPACK_VECTOR e_t, TLAPACK_SMATRIX matrix_t>
+int laed0(d_t& d, e_t& e, matrix_t& Q, size_type<matrix_t> smlsiz)
+{
+    using idx_t = size_type<matrix_t>;
+    using real_t = type_t<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const idx_t n = size(d);
+
+    // check arguments
+    tlapack_check(nrows(Q) == n && ncols(Q) == n);
+    tlapack_check(smlsiz > 0);
+
+    // Solve small subproblems with the QR iteration
+    if (n <= smlsiz) {
+        laset(GENERAL, zero, one, Q);
+        return steqr(true, d, e, Q);
+    }
+
+    // Divide the matrix into two submatrices using a rank-one modification
+    const idx_t n1 = n / 2;
+    const real_t rho = e[n1 - 1];
+    d[n1 - 1] -= abs(rho);
+    d[n1] -= abs(rho);
+
+    // Solve each submatrix eigenproblem
+    {
+        auto d1 = slice(d, range{0, n1});
+        auto e1 = slice(e, range{0, n1 - 1});
+        auto Q1 = slice(Q, range{0, n1}, range{0, n1});
+        int info = laed0(d1, e1, Q1, smlsiz);
+        if (info != 0) return info;
+
+        auto d2 = slice(d, range{n1, n});
+        auto e2 = slice(e, range{n1, n - 1});
+        auto Q2 = slice(Q, range{n1, n}, range{n1, n});
+        info = laed0(d2, e2, Q2, smlsiz);
+        if (info != 0) return info;
+
+        auto Q12 = slice(Q, range{0, n1}, range{n1, n});
+        auto Q21 = slice(Q, range{n1, n}, range{0, n1});
+        laset(GENERAL, zero, zero, Q12);
+        laset(GENERAL, zero, zero, Q21);
+    }
+
+    // Merge the eigensystems of the two submatrices
+    return laed1(d, Q, rho, n1);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LAED0_HH
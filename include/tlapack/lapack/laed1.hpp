@@ -0,0 +1,147 @@
+/// @file laed1.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlaed1.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LAED1_HH
+#define TLAPACK_LAED1_HH
+
+#include <algorithm>
+#include <array>
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/copy.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/laed2.hpp"
+#include "tlapack/lapack/laed3.hpp"
+
+namespace tlapack {
+
+/**
+ * LAED1 used by STEDC. Computes the updated eigensystem of a diagonal matrix
+ * after modification by a rank-one symmetric matrix.
+ *
+ *   T = Q(in) ( D(in) + rho * z*z**T ) Q**T(in) = Q(out) * D(out) * Q**T(out)
+ *
+ * where z = Q**T*u, u is a vector of length n with ones in the n1-1 and n1
+ * entries and zeros elsewhere.
+ *
+ * The eigenvectors of the original matrix are stored in Q, and the
+ * eigenvalues are in d. The algorithm consists of three stages:
+ *
+ * The first stage consists of deflating the size of the problem when there
+ * are multiple eigenvalues or if there is a zero in the z vector. For each
+ * such occurrence the dimension of the secular equation problem is reduced
+ * by one. This stage is performed by the routine laed2().
+ *
+ * The second stage consists of calculating the updated eigenvalues. This is
+ * done by finding the roots of the secular equation via the routine laed4()
+ * (as called by laed3()). This routine also calculates the eigenvectors of
+ * the current problem.
+ *
+ * The final stage consists of computing the updated eigenvectors directly
+ * using the updated eigenvalues with a matrix-matrix multiplication, and
+ * sorting the eigenpairs in ascending order.
+ *
+ * @param[in,out] d Real vector of length n.
+ *      On entry, d[0:n1] and d[n1:n] contain the eigenvalues of the two
+ *      submatrices to be combined, each set sorted in ascending order.
+ *      On exit, the eigenvalues of the repaired matrix in ascending order.
+ *
+ * @param[in,out] Q Real n-by-n matrix.
+ *      On entry, the block-diagonal matrix of eigenvectors of the two
+ *      submatrices.
+ *      On exit, Q contains the eigenvectors of the repaired tridiagonal
+ *      matrix.
+ *
+ * @param[in] rho
+ *      The subdiagonal entry used to create the rank-1 modification.
+ *
+ * @param[in] n1
+ *      The location of the last eigenvalue in the leading sub-matrix.
+ *      0 < n1 < n.
+ *
+ * @return 0 if success.
+ * @return 1 if an eigenvalue did not converge.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_VECTOR d_t, TLAPACK_MATRIX matrix_t, TLAPACK_REAL real_t>
+int laed1(d_t& d, matrix_t& Q, real_t rho, size_type<matrix_t> n1)
+{
+    using idx_t = size_type<matrix_t>;
+
+    // Functors
+    Create<matrix_t> new_matrix;
+    Create<vector_type<matrix_t>> new_vector;
+
+    // constants
+    const idx_t n = nrows(Q);
+
+    // check arguments
+    tlapack_check(n1 > 0 && n1 < n);
+    tlapack_check(ncols(Q) == n);
+    tlapack_check((idx_t)size(d) == n);
+
+    // Allocates workspace
+    auto work_ = workspace_arena<real_t>().get(WorkInfo(n, 3));
+    auto W = new_matrix(work_.vector(), n, 3);
+    auto z = col(W, 0);
+    auto dlambda = col(W, 1);
+    auto w = col(W, 2);
+
+    auto Q2_ = workspace_arena<real_t>().get(WorkInfo(n, n));
+    auto Q2 = new_matrix(Q2_.vector(), n, n);
+
+    auto iwork_ = workspace_arena<idx_t>().get(n);
+    auto indxc = new_vector(iwork_.vector(), n);
+
+    // Form the z-vector which consists of the last row of Q1 and the first
+    // row of Q2
+    for (idx_t i = 0; i < n1; ++i)
+        z[i] = Q(n1 - 1, i);
+    for (idx_t i = n1; i < n; ++i)
+        z[i] = Q(n1, i);
+
+    // Deflate eigenvalues
+    idx_t k;
+    std::array<idx_t, 4> ctot;
+    int info = laed2(k, n1, d, Q, rho, z, dlambda, w, Q2, indxc, ctot);
+    if (info != 0) return info;
+
+    // Solve the secular equation
+    if (k > 0) {
+        auto S_ = workspace_arena<real_t>().get(WorkInfo(k, k));
+        auto S = new_matrix(S_.vector(), k, k);
+        info = laed3(k, n1, ctot, d, Q, rho, dlambda, w, Q2, indxc, S);
+        if (info != 0) return info;
+    }
+
+    // Sort the eigenpairs into ascending order. laed2() already sorts them if
+    // all eigenvalues were deflated, and the first k eigenvalues are sorted.
+    if (0 < k && k < n) {
+        auto& perm = iwork_.vector();
+        for (idx_t i = 0; i < n; ++i)
+            perm[i] = i;
+        std::stable_sort(perm.begin(), perm.begin() + n,
+                         [&d](idx_t i, idx_t j) { return d[i] < d[j]; });
+        for (idx_t j = 0; j < n; ++j) {
+            auto q2 = col(Q2, j);
+            copy(col(Q, perm[j]), q2);
+            z[j] = d[perm[j]];
+        }
+        lacpy(GENERAL, Q2, Q);
+        copy(z, d);
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LAED1_HH
@@ -1,5 +1,7 @@
 /// @file laed2.hpp
 /// @author Thijs Steel, KU Leuven, Belgium
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlaed2.f
 //
 // Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
 //
@@ -7,394 +9,293 @@
 // <T>LAPACK is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-// TODO: Need to finished laed2
-
 #ifndef TLAPACK_LAED2_HH
 #define TLAPACK_LAED2_HH
 
-//
-#include "tlapack/base/utils.hpp"
+#include <array>
 
-//
-#include <tlapack/blas/copy.hpp>
-#include <tlapack/blas/iamax.hpp>
-#include <tlapack/blas/rot.hpp>
-#include <tlapack/blas/scal.hpp>
-#include <tlapack/lapack/lacpy.hpp>
-#include <tlapack/lapack/laed4.hpp>
-#include <tlapack/lapack/lamrg.hpp>
-#include <tlapack/lapack/lapy2.hpp>
+#include "tlapack/base/constants.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/copy.hpp"
+#include "tlapack/blas/iamax.hpp"
+#include "tlapack/blas/rot.hpp"
+#include "tlapack/blas/scal.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/lamrg.hpp"
+#include "tlapack/lapack/lapy2.hpp"
 
 namespace tlapack {
 
-template <class idx_t,
-          class matrixQ_t,
-          class d_t,
-          class indxq_t,
-          class real_t,
-          class z_t,
-          class dlambda_t,
-          class w_t,
-          class matrixQ2_t,
-          class indx_t,
-          class indxc_t,
-          class indxp_t,
-          class coltyp_t>
-int laed2(idx_t& k,
-          idx_t n,
-          idx_t n1,
+/**
+ * LAED2 used by STEDC. Merges the two sets of eigenvalues together into a
+ * single sorted set. Then it tries to deflate the size of the problem.
+ *
+ * There are two ways in which deflation can occur: when two or more
+ * eigenvalues are close together or if there is a tiny entry in the z
+ * vector. For each such occurrence the order of the related secular
+ * equation problem is reduced by one.
+ *
+ * The columns of Q are classified in four types:
+ *  - 0: nonzero only in the first n1 rows;
+ *  - 1: dense, i.e., the result of a rotation between the two subproblems;
+ *  - 2: nonzero only in the last n-n1 rows;
+ *  - 3: deflated.
+ * The non-deflated columns are copied to Q2 grouped by type, so that the
+ * eigenvector update in laed3() can skip the zero blocks.
+ *
+ * @param[out] k
+ *      The number of non-deflated eigenvalues, and the order of the
+ *      related secular equation. 0 <= k <= n.
+ *
+ * @param[in] n1
+ *      The location of the last eigenvalue in the leading sub-matrix.
+ *      0 < n1 < n.
+ *
+ * @param[in,out] d Real vector of length n.
+ *      On entry, d[0:n1] and d[n1:n] contain the eigenvalues of the two
+ *      submatrices to be combined, each set sorted in ascending order.
+ *      On exit, d[k:n] contains the deflated eigenvalues.
+ *
+ * @param[in,out] Q Real n-by-n matrix.
+ *      On entry, Q contains the eigenvectors of the two submatrices in the
+ *      two square blocks with corners at (0,0), (n1-1,n1-1) and (n1,n1),
+ *      (n-1,n-1).
+ *      On exit, Q[:,k:n] contains the eigenvectors of the deflated
+ *      eigenvalues.
+ *
+ * @param[in,out] rho
+ *      On entry, the off-diagonal element associated with the rank-1 cut
+ *      which originally split the two submatrices which are now being
+ *      recombined.
+ *      On exit, rho has been modified to the value required by laed3().
+ *
+ * @param[in,out] z Real vector of length n.
+ *      On entry, z contains the updating vector (the last row of the first
+ *      sub-eigenvector matrix and the first row of the second sub-eigenvector
+ *      matrix).
+ *      On exit, the contents of z have been destroyed by the updating
+ *      process.
+ *
+ * @param[out] dlambda Real vector of length n.
+ *      dlambda[0:k] contains the non-deflated eigenvalues in ascending order,
+ *      which are the poles of the secular equation.
+ *
+ * @param[out] w Real vector of length n.
+ *      w[0:k] contains the components of the deflation-adjusted updating
+ *      vector, in the same order as dlambda.
+ *
+ * @param[out] Q2 Real n-by-n matrix.
+ *      Q2[:,0:k] contains the eigenvectors associated to dlambda grouped by
+ *      column type.
+ *
+ * @param[out] indxc Integer vector of length n.
+ *      Q2[:,j] is the eigenvector associated to dlambda[indxc[j]], for
+ *      j = 0, ..., k-1.
+ *
+ * @param[out] ctot Number of columns of each type.
+ *      ctot[3] = n - k is the number of deflated eigenvalues.
+ *
+ * @return 0 if success.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_VECTOR d_t,
+          TLAPACK_MATRIX matrixQ_t,
+          TLAPACK_REAL real_t,
+          TLAPACK_VECTOR z_t,
+          TLAPACK_VECTOR dlambda_t,
+          TLAPACK_VECTOR w_t,
+          TLAPACK_MATRIX matrixQ2_t,
+          class indxc_t>
+int laed2(size_type<matrixQ_t>& k,
+          size_type<matrixQ_t> n1,
           d_t& d,
-          matrixQ_t& q,
-          idx_t ldq,
-          indxq_t& indxq,
+          matrixQ_t& Q,
           real_t& rho,
-          z_t z,
+          z_t& z,
           dlambda_t& dlambda,
           w_t& w,
-          matrixQ2_t& q2,
-          indx_t& indx,
+          matrixQ2_t& Q2,
           indxc_t& indxc,
-          indxp_t& indxp,
-          coltyp_t& coltyp)
+          std::array<size_type<matrixQ_t>, 4>& ctot)
 {
-    std::cout << std::setprecision(15);
+    using idx_t = size_type<matrixQ_t>;
     using range = pair<idx_t, idx_t>;
-    // Functor
-    Create<matrixQ_t> new_matrix;
-
-    int info = 0;
 
-    if (n < 0) {
-        info = -2;
-    }
-    else if (ldq < max(idx_t(1), n)) {
-        info = -6;
-    }
-    else if (min(idx_t(1), (n / 2)) > n1 || (n / 2) < n1) {
-        info = -3;
-    }
-    if (info != 0) {
-        // Call Xerbla
-        return info;
-    }
-
-    // Quick Return if Possible
-    if (n == 0) {
-        return info;
-    }
+    // constants
+    const real_t zero(0);
+    const real_t two(2);
+    const real_t eight(8);
+    const idx_t n = size(d);
+    const idx_t n2 = n - n1;
+
+    // check arguments
+    tlapack_check(n1 > 0 && n1 < n);
+    tlapack_check(nrows(Q) == n && ncols(Q) == n);
+    tlapack_check(nrows(Q2) == n && ncols(Q2) == n);
+    tlapack_check((idx_t)size(z) >= n);
+    tlapack_check((idx_t)size(dlambda) >= n);
+    tlapack_check((idx_t)size(w) >= n);
+    tlapack_check((idx_t)size(indxc) >= n);
+
+    // Functors
+    Create<matrixQ_t> new_matrix;
 
-    idx_t n2 = n - n1;
-    idx_t n1p1 = n1 + 1;
+    // Integer workspace
+    auto iwork_ = workspace_arena<idx_t>().get(WorkInfo(n, 3));
+    auto iW = new_matrix(iwork_.vector(), n, 3);
+    auto indx = col(iW, 0);
+    auto indxp = col(iW, 1);
+    auto coltyp = col(iW, 2);
 
-    if (rho < 0) {
-        auto zView = slice(z, range(n1p1 - 1, n));
-        scal(real_t(-1.0), zView);
+    if (rho < zero) {
+        auto z2 = slice(z, range{n1, n});
+        scal(real_t(-1), z2);
     }
 
-    // Normalize z so that norm(z) = 1. Since z is the concatenation of a two
+    // Normalize z so that norm(z) = 1. Since z is the concatenation of two
     // normalized vectors, norm2(z) = sqrt(2).
-    real_t t = real_t(1.0 / sqrt(2.0));
-    scal(t, z);
+    scal(real_t(1) / sqrt(two), z);
 
-    // RHO = ABS(norm(z)**2 * RHO)
-    rho = abs(real_t(2.0) * rho);
+    // rho = abs(norm(z)**2 * rho)
+    rho = abs(two * rho);
 
     // Sort the eigenvalues into increasing order
-    for (idx_t i = n1p1 - 1; i < n; i++) {
-        indxq[i] = indxq[i] + n1;
-        std::cout << "INDXQ[I] =" << indxq[i] << std::endl;
-    }
-
-    // re-integrate the dflated parts from the last pass
-    for (idx_t i = 0; i < n; i++) {
-        dlambda[i] = d[indxq[i]];
-        std::cout << "DLAMBDA[I] = " << dlambda[i] << std::endl;
-    }
-    lamrg(n1, n2, dlambda, 1, 1, indxc);
-    for (idx_t i = 0; i < n; i++) {
-        indx[i] = indxq[indxc[i]];
-        std::cout << "INDXQ[INDXC[I]] = " << indxq[indxc[i]] << std::endl;
-    }
+    lamrg(n1, n2, d, 1, 1, indx);
 
     // Calculate the allowable deflation tolerance
-    idx_t imax = iamax(z);
-    idx_t jmax = iamax(d);
-
-    real_t eps = ulp<real_t>() / real_t(2.);
-
-    real_t tol = real_t(8.0) * eps * max(abs(d[jmax]), abs(z[imax]));
-
-    // If the rank-1 modifier is small enough, everything is already deflated,
-    // we set k to zero, no more needs to be done except to reorganize Q so that
-    // its columns correspond with the elements in D.
-
+    const idx_t imax = iamax(z);
+    const idx_t jmax = iamax(d);
+    const real_t eps = uroundoff<real_t>();
+    const real_t tol = eight * eps * max(abs(d[jmax]), abs(z[imax]));
+
+    // If the rank-1 modifier is small enough, everything is already deflated.
+    // We set k to zero, no more needs to be done except to reorganize Q so
+    // that its columns correspond with the elements in d.
     if (rho * abs(z[imax]) <= tol) {
         k = 0;
-        idx_t iq2 = 0;
-        for (idx_t j = 0; j < n; j++) {
-            idx_t i = indx[j];
-
-            auto qView = slice(q, range(0, n), i);
-            auto q2View = slice(q2, range(iq2, n));
-            copy(qView, q2View);
-
-            dlambda[j] = d[i];
-            iq2 = iq2 + n;
+        for (idx_t j = 0; j < n; ++j) {
+            const idx_t i = indx[j];
+            auto q2 = col(Q2, j);
+            copy(col(Q, i), q2);
+            z[j] = d[i];
         }
-
-        auto q2View = new_matrix(q2, n, n);
-        lacpy(GENERAL, q2View, q);
-        copy(dlambda, d);
-        return info;
+        lacpy(GENERAL, Q2, Q);
+        copy(z, d);
+        ctot = {0, 0, 0, n};
+        return 0;
     }
 
-    // If there are multiple eigenvalues then the problem deflates.  Here the
-    // number of equal eigenvalues are found.  As each equal eigenvalue is
+    // If there are multiple eigenvalues then the problem deflates. Here the
+    // number of equal eigenvalues are found. As each equal eigenvalue is
     // found, an elementary reflector is computed to rotate the corresponding
-    // eigensubspace so that the corresponding components of Z are zero in this
+    // eigensubspace so that the corresponding components of z are zero in this
     // new basis.
-
-    for (idx_t i = 0; i < n1; i++) {
-        coltyp[i] = real_t(0);
-    }
-
-    for (idx_t i = n1p1 - 1; i < n; i++) {
-        coltyp[i] = real_t(2);
-    }
+    for (idx_t i = 0; i < n1; ++i)
+        coltyp[i] = 0;
+    for (idx_t i = n1; i < n; ++i)
+        coltyp[i] = 2;
 
     k = 0;
     idx_t k2 = n;
-    idx_t pj = 0;
-    real_t nj;
-    bool deflate = false;
-    for (idx_t j = 0; j < n; j++) {
-        nj = indx[j];
+    idx_t pj = n;  // Index of the last non-deflated eigenvalue, n if none
+    for (idx_t j = 0; j < n; ++j) {
+        const idx_t nj = indx[j];
         if (rho * abs(z[nj]) <= tol) {
             // Deflate due to small z component
-
-            k2 = k2 - 1;
-            coltyp[nj] = real_t(3.0);
+            --k2;
+            coltyp[nj] = 3;
             indxp[k2] = nj;
-            if (j == n - 1) {
-                deflate = true;
-            }
+            continue;
         }
-        else {
+        if (pj == n) {
             pj = nj;
+            continue;
         }
 
-        std::cout << "NJ = " << nj << std::endl;
-        std::cout << "J = " << j << std::endl;
-        std::cout << "K = " << k << std::endl;
-        std::cout << "K2 = " << k2 << std::endl;
-        std::cout << "PJ = " << pj << std::endl;
-
-        // // LINE 80
-        // if (!deflate) {
-        //     if (j < n) {
-        //         nj = indx[j + 1];
-        //     }
-        //     else {
-        //         nj = 0;
-        //     }
-        //     std::cout << "NJ = " << nj << std::endl;
-        //     if (j > n - 1) {
-        //         break;
-        //     }
-        //     if (rho * abs(z[nj]) <= tol) {
-        //         // Deflate due to small z component
-
-        //         k2 = k2 - 1;
-        //         coltyp[nj] = real_t(3);
-        //         indxp[k2] = nj;
-        //     }
-        //     else {
-        //         // Check fi eign values are close enought to allow deflation
-        //         real_t s = z[pj];
-        //         real_t c = z[nj];
-
-        //         // Find sqrt(a**2 + b**2) without overflow or destructive
-        //         // underflow
-        //         auto tau = lapy2(c, s);
-        //         t = d[nj] - d[pj];
-        //         c = c / tau;
-        //         s = -s / tau;
-
-        //         if (abs(t * c * s) <= tol) {
-        //             // Deflation is possible
-
-        //             z[nj] = tau;
-        //             z[pj] = real_t(0.0);
-        //             if (coltyp[nj] != coltyp[pj]) {
-        //                 coltyp[nj] = real_t(0);
-        //             }
-        //             coltyp[pj] = real_t(0);
-
-        //             auto qView1 = slice(q, range(0, n), pj);
-        //             auto qView2 = slice(q, range(0, n), nj);
-        //             rot(qView1, qView2, c, s);
-
-        //             t = d[pj] * (c * c) + d[nj] * (s * s);
-        //             d[nj] = d[pj] * (s * s) + d[nj] * (c * c);
-        //             d[pj] = t;
-        //             k2 = k2 - 1;
-        //             real_t i = 0;
-        //             while (true) {
-        //                 if (k2 + i < n) {
-        //                     if (d[pj] < d[indxp[k2 + i]]) {
-        //                         indxp[k2 + i - 1] = indxp[k2 + i];
-        //                         indxp[k2 + i] = pj;
-        //                         i = i + 1;
-        //                         continue;
-        //                     }
-        //                     else {
-        //                         indxp[k2 + i - 1] = pj;
-        //                     }
-        //                 }
-        //                 else {
-        //                     indxp[k2 + i - 1] = pj;
-        //                 }
-
-        //                 pj = nj;
-        //                 break;
-        //             }
-        //         }
-        //         else {
-        //             dlambda[k - 1] = d[pj];
-        //             w[k] = z[pj];
-        //             indxp[k - 1] = pj;
-        //             pj = nj;
-        //             k = k + 1;
-        //         }
-        //     }
-        // }
+        // Check if eigenvalues are close enough to allow deflation
+        real_t s = z[pj];
+        real_t c = z[nj];
+        const real_t tau = lapy2(c, s);
+        const real_t t = d[nj] - d[pj];
+        c = c / tau;
+        s = -s / tau;
+        if (abs(t * c * s) <= tol) {
+            // Deflation is possible
+            z[nj] = tau;
+            z[pj] = zero;
+            if (coltyp[nj] != coltyp[pj]) coltyp[nj] = 1;
+            coltyp[pj] = 3;
+
+            auto qpj = col(Q, pj);
+            auto qnj = col(Q, nj);
+            rot(qpj, qnj, c, s);
+
+            const real_t dpj = d[pj] * (c * c) + d[nj] * (s * s);
+            d[nj] = d[pj] * (s * s) + d[nj] * (c * c);
+            d[pj] = dpj;
+
+            --k2;
+            indxp[k2] = pj;
+        }
+        else {
+            dlambda[k] = d[pj];
+            w[k] = z[pj];
+            indxp[k] = pj;
+            ++k;
+        }
+        pj = nj;
     }
 
-    /////////////////////////////////////////////////////////////BREAKS HERE
-
-    /////////////////////////////////////////////////////////////BREAKS HERE
-
-    // Recored the last eigenvalue
-    k = k + 1;
+    // Record the last eigenvalue
     dlambda[k] = d[pj];
     w[k] = z[pj];
     indxp[k] = pj;
+    ++k;
 
-    // Count up the total number of the various types of columns, then form
-    // a permutation which positions the four column types into four uniform
+    // Count up the total number of the various types of columns, then form a
+    // permutation which positions the four column types into four uniform
     // groups (although one or more of these groups may be empty).
+    ctot = {0, 0, 0, 0};
+    for (idx_t j = 0; j < n; ++j)
+        ++ctot[coltyp[j]];
 
-    std::vector<real_t> ctot(4);
-
-    for (idx_t j = 0; j < 4; j++) {
-        ctot[j] = real_t(0);
-    }
-
-    for (idx_t j = 0; j < n; j++) {
-        idx_t ct = coltyp[j];
-        ctot[ct] = ctot[ct] + real_t(1);
-    }
-
-    std::vector<real_t> psm(4);
-    // // PSM(*) = Position in SubMatrix (of types 1 through 4)
-
-    psm[0] = real_t(0);
+    // psm[ct] is the position in Q2 of the next column of type ct
+    std::array<idx_t, 4> psm;
+    psm[0] = 0;
     psm[1] = ctot[0];
     psm[2] = psm[1] + ctot[1];
     psm[3] = psm[2] + ctot[2];
-    k = n - ctot[3] - 1;
 
-    // Fill out the INDXC array so that the permutation which it induces will
-    // place all type-1 columns first, all type-2 columns next then all
-    // type-3's, and finally all type-4's.
-
-    for (idx_t j = 0; j < n; j++) {
-        idx_t js = indxp[j];
-        idx_t ct = coltyp[js];
-        indx[psm[ct]] = js;
-        indxc[psm[ct]] = j;
-        psm[ct] = psm[ct] + real_t(1);
-    }
-
-    // Sort the eigenvalues and corresponding eigenvectors into DLAMBDA and Q2
-    // respectively.  The eigenvalues/vectors which were not deflated go
-    // into the first K slots of DLAMBDA and Q2 respectively while those
-    // which were deflated go into the last N - K slots.
-
-    idx_t i = 0;
-    idx_t iq1 = 0;
-    idx_t iq2 = (ctot[0] + ctot[1]) * n1;
-
-    for (idx_t j = 0; j < ctot[0]; j++) {
-        real_t js = indx[i];
-
-        auto qView = slice(q, range(0, n1), js);
-        auto q2View = slice(q2, range{iq1, iq1 + n1});
-        copy(qView, q2View);
-
-        z[i] = d[js];
-        i = i + 1;
-        iq1 = iq1 + n1;
-    }
-
-    for (idx_t j = 0; j < ctot[1]; j++) {
-        real_t js = indx[i];
-
-        auto qView = slice(q, range(0, n1), js);
-        auto q2View = slice(q2, range(iq1, iq1 + n1));
-        copy(qView, q2View);
-
-        qView = slice(q, range(n1, n1 + n2), js);
-        q2View = slice(q2, range(iq2, iq2 + n2));
-        copy(qView, q2View);
-
-        i = i + 1;
-        iq1 = iq1 + n1;
-        iq2 = iq2 + n2;
-    }
-
-    for (idx_t j = 0; j < ctot[2]; j++) {
-        real_t js = indx[i];
-
-        auto qView = slice(q, range(n1, n1 + n2), js);
-        auto q2View = slice(q2, range(iq2, iq2 + n2));
-        copy(qView, q2View);
-
-        z[i] = d[js];
-        i = i + 1;
-        iq2 = iq2 + n2;
-    }
-
-    iq1 = iq2;
-
-    for (idx_t j = 0; j < ctot[3]; j++) {
-        idx_t js = indx[i];
-        auto qView = slice(q, range(0, n), js);
-        iq2 = iq2 + n;
-        z[i] = d[js];
-        i = i + 1;
+    // Sort the eigenvectors into Q2 grouped by type. The eigenvectors which
+    // were not deflated go into the first k columns of Q2, while those which
+    // were deflated go into the last n-k columns. The deflated eigenvalues are
+    // stored in z[k:n].
+    for (idx_t j = 0; j < n; ++j) {
+        const idx_t js = indxp[j];
+        const idx_t ct = coltyp[js];
+        const idx_t pos = psm[ct]++;
+        auto q2 = col(Q2, pos);
+        copy(col(Q, js), q2);
+        if (ct == 3)
+            z[pos] = d[js];
+        else
+            indxc[pos] = j;
     }
 
     // The deflated eigenvalues and their corresponding vectors go back into
-    // the last N - K slots of D and Q respectively.
-
-    // if (k < n - 1) {
-    //     auto q2Mat = new_matrix(q2, n, n);
-    //     auto q2View = slice(q2Mat, range(iq1, n), ctot[3]);
-    //     auto q1View = slice(q, range(0, n), k);
-    //     lacpy(GENERAL, q2View, q1View);
-
-    //     copy(slice(z, range{k + 1, n - k}), slice(d, range{k + 1, n - k}));
-    // }
-
-    // Copy CTOT into COLTYP for referencing in DLAED3.
-
-    for (idx_t j = 0; j < 4; j++) {
-        coltyp[j] = ctot[j];
+    // the last n-k slots of d and Q respectively.
+    if (k < n) {
+        auto Q2d = slice(Q2, range{0, n}, range{k, n});
+        auto Qd = slice(Q, range{0, n}, range{k, n});
+        lacpy(GENERAL, Q2d, Qd);
+        for (idx_t j = k; j < n; ++j)
+            d[j] = z[j];
     }
 
-    return info;
+    return 0;
 }
+
 }  // namespace tlapack
 
-#endif  // TLAPACK_LAED2_HH
\ No newline at end of file
+#endif  // TLAPACK_LAED2_HH
@@ -0,0 +1,177 @@
+/// @file laed3.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlaed3.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LAED3_HH
+#define TLAPACK_LAED3_HH
+
+#include <array>
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/nrm2.hpp"
+#include "tlapack/blas/scal.hpp"
+#include "tlapack/lapack/laed4.hpp"
+#include "tlapack/lapack/laset.hpp"
+
+namespace tlapack {
+
+/**
+ * LAED3 used by STEDC. Finds the roots of the secular equation, as defined by
+ * the values in d, w, and rho, between 0 and k-1. It makes the appropriate
+ * calls to laed4() and then updates the eigenvectors by multiplying the
+ * matrix of eigenvectors of the pair of eigensystems being combined by the
+ * matrix of eigenvectors of the k-by-k system which is solved here.
+ *
+ * The components of the eigenvectors of the secular equation are computed
+ * from the formula of Gu and Eisenstat, which guarantees their numerical
+ * orthogonality.
+ *
+ * @param[in] k
+ *      The number of terms in the rational function to be solved by laed4().
+ *      k >= 0.
+ *
+ * @param[in] n1
+ *      The location of the last eigenvalue in the leading submatrix.
+ *
+ * @param[in] ctot Number of columns of each type, as computed by laed2().
+ *
+ * @param[out] d Real vector of length n.
+ *      d[0:k] contains the updated eigenvalues in ascending order.
+ *
+ * @param[out] Q Real n-by-n matrix.
+ *      Q[:,0:k] contains the updated eigenvectors.
+ *
+ * @param[in] rho
+ *      The value of the parameter in the rank one update equation.
+ *      rho >= 0 required.
+ *
+ * @param[in] dlambda Real vector of length k.
+ *      The first k elements of this array contain the old roots of the
+ *      deflated updating problem. These are the poles of the secular
+ *      equation.
+ *
+ * @param[in,out] w Real vector of length k.
+ *      On entry, the first k components of the deflation-adjusted updating
+ *      vector. On exit, w has been destroyed.
+ *
+ * @param[in] Q2 Real n-by-k matrix.
+ *      The eigenvectors associated to dlambda, grouped by column type as in
+ *      laed2().
+ *
+ * @param[in] indxc Integer vector of length k.
+ *      Q2[:,j] is the eigenvector associated to dlambda[indxc[j]].
+ *
+ * @param S Real k-by-k matrix. Workspace.
+ *
+ * @return 0 if success.
+ * @return 1 if an eigenvalue did not converge.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_VECTOR d_t,
+          TLAPACK_MATRIX matrixQ_t,
+          TLAPACK_REAL real_t,
+          TLAPACK_VECTOR dlambda_t,
+          TLAPACK_VECTOR w_t,
+          TLAPACK_MATRIX matrixQ2_t,
+          class indxc_t,
+          TLAPACK_MATRIX matrixS_t>
+int laed3(size_type<matrixQ_t> k,
+          size_type<matrixQ_t> n1,
+          const std::array<size_type<matrixQ_t>, 4>& ctot,
+          d_t& d,
+          matrixQ_t& Q,
+          real_t rho,
+          const dlambda_t& dlambda,
+          w_t& w,
+          const matrixQ2_t& Q2,
+          const indxc_t& indxc,
+          matrixS_t& S)
+{
+    using idx_t = size_type<matrixQ_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const idx_t n = nrows(Q);
+
+    // check arguments
+    tlapack_check(nrows(S) >= k && ncols(S) >= k);
+
+    // Quick return if possible
+    if (k == 0) return 0;
+
+    auto S_ = slice(S, range{0, k}, range{0, k});
+
+    // Find the roots of the secular equation. Column j of S stores
+    // dlambda[i] - d[j], or the normalized eigenvector if k <= 2.
+    for (idx_t j = 0; j < k; ++j) {
+        auto s = col(S_, j);
+        const int info = laed4(k, j, dlambda, w, s, rho, d[j]);
+        if (info != 0) return info;
+    }
+
+    if (k > 2) {
+        // Compute updated w
+        for (idx_t i = 0; i < k; ++i) {
+            real_t wi = S_(i, i);
+            for (idx_t j = 0; j < k; ++j) {
+                if (j != i) wi *= S_(i, j) / (dlambda[i] - dlambda[j]);
+            }
+            w[i] = (w[i] >= zero) ? sqrt(-wi) : -sqrt(-wi);
+        }
+
+        // Compute eigenvectors of the modified rank-1 modification
+        for (idx_t j = 0; j < k; ++j) {
+            for (idx_t i = 0; i < k; ++i)
+                S_(i, j) = w[i] / S_(i, j);
+            auto s = col(S_, j);
+            scal(one / nrm2(s), s);
+        }
+    }
+
+    // Permute the rows of S so that they follow the column order of Q2
+    for (idx_t j = 0; j < k; ++j) {
+        for (idx_t i = 0; i < k; ++i)
+            w[i] = S_(indxc[i], j);
+        for (idx_t i = 0; i < k; ++i)
+            S_(i, j) = w[i];
+    }
+
+    // Compute the updated eigenvectors. Columns of type 0 are zero in the
+    // last n-n1 rows and columns of type 2 are zero in the first n1 rows.
+    const idx_t n12 = ctot[0] + ctot[1];
+    const idx_t n23 = ctot[1] + ctot[2];
+
+    auto Q1 = slice(Q, range{0, n1}, range{0, k});
+    if (n12 > 0) {
+        auto Q21 = slice(Q2, range{0, n1}, range{0, n12});
+        auto S1 = slice(S_, range{0, n12}, range{0, k});
+        gemm(NO_TRANS, NO_TRANS, one, Q21, S1, Q1);
+    }
+    else
+        laset(GENERAL, zero, zero, Q1);
+
+    auto Q3 = slice(Q, range{n1, n}, range{0, k});
+    if (n23 > 0) {
+        auto Q23 = slice(Q2, range{n1, n}, range{ctot[0], k});
+        auto S3 = slice(S_, range{ctot[0], k}, range{0, k});
+        gemm(NO_TRANS, NO_TRANS, one, Q23, S3, Q3);
+    }
+    else
+        laset(GENERAL, zero, zero, Q3);
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LAED3_HH
@@ -606,10 +606,10 @@ int laed4(
             }
             zz[1] = z[ii] * z[ii];
 
-            std::vector<real_t> sub(delta.begin() + iim1, delta.end());
+            real_t sub[3] = {delta[iim1], delta[ii], delta[iip1]};
             info = laed6(niter, orgati, c, sub, zz, w, eta);
 
-            if (info == 0) {
+            if (info != 0) {
                 return info;
             }
         }
@@ -792,10 +792,10 @@ int laed4(
                     }
                 }
 
-                std::vector<real_t> sub(delta.begin() + iim1, delta.end());
+                real_t sub[3] = {delta[iim1], delta[ii], delta[iip1]};
                 info = laed6(niter, orgati, c, sub, zz, w, eta);
 
-                if (info == 0) {
+                if (info != 0) {
                     return info;
                 }
             }
@@ -0,0 +1,146 @@
+/// @file lasd0.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlasd0.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LASD0_HH
+#define TLAPACK_LASD0_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/lartg.hpp"
+#include "tlapack/blas/rot.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/lasd1.hpp"
+#include "tlapack/lapack/svd_qr.hpp"
+
+namespace tlapack {
+
+/**
+ * LASD0 used by BDSDC. Computes the singular values and the left and right
+ * singular vectors of a real upper bidiagonal n-by-m matrix B, m = n + sqre,
+ * using the divide and conquer method.
+ *
+ *      B = U * ( S  0 ) * VT
+ *
+ * The matrix is split at the middle row into two blocks, the SVDs of the
+ * blocks are computed recursively and then merged with lasd1().
+ * Subproblems of size at most smlsiz are solved by svd_qr().
+ *
+ * @param[in,out] d Real vector of length n.
+ *      On entry, the main diagonal of the bidiagonal matrix.
+ *      On exit, its singular values, not necessarily sorted.
+ *
+ * @param[in,out] e Real vector of length m-1.
+ *      The off-diagonal elements of the bidiagonal matrix.
+ *      On exit, e has been destroyed.
+ *
+ * @param[out] U Real n-by-n matrix.
+ *      On exit, U contains the left singular vectors.
+ *
+ * @param[out] VT Real m-by-m matrix, m = n or m = n + 1.
+ *      On exit, VT[0:n,:] contains the transposed right singular vectors. If
+ *      m = n + 1, VT[n,:] contains the null vector of B.
+ *
+ * @param[in] smlsiz
+ *      Maximum size of the subproblems at the bottom of the recursion.
+ *      smlsiz >= 2.
+ *
+ * @return 0 if success.
+ * @return 1 if a singular value did not converge.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_VECTOR d_t, TLAPACK_VECTOR e_t, TLAPACK_SMATRIX matrix_t>
+int lasd0(d_t& d, e_t& e, matrix_t& U, matrix_t& VT, size_type<matrix_t> smlsiz)
+{
+    using idx_t = size_type<matrix_t>;
+    using real_t = type_t<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const idx_t n = size(d);
+    const idx_t m = nrows(VT);
+
+    // check arguments
+    tlapack_check(nrows(U) == n && ncols(U) == n);
+    tlapack_check(ncols(VT) == m && (m == n || m == n + 1));
+    tlapack_check((idx_t)size(e) + 1 >= m);
+    tlapack_check(smlsiz >= 2);
+
+    // Solve small subproblems with the QR iteration
+    if (n <= smlsiz) {
+        laset(GENERAL, zero, one, U);
+        laset(GENERAL, zero, one, VT);
+        if (n == 0) return 0;
+
+        auto e1 = slice(e, range{0, n - 1});
+        auto U1 = slice(U, range{0, n}, range{0, n});
+        auto VT1 = slice(VT, range{0, n}, range{0, m});
+        if (m == n) return svd_qr(Uplo::Upper, true, true, d, e1, U1, VT1);
+
+        // Rotate from the right to make B lower bidiagonal with a zero last
+        // column. VT[n,:] becomes the null vector of B.
+        for (idx_t i = 0; i < n; ++i) {
+            real_t c, s, r;
+            lartg(d[i], e[i], c, s, r);
+            d[i] = r;
+            if (i + 1 < n) {
+                e[i] = s * d[i + 1];
+                d[i + 1] = c * d[i + 1];
+            }
+            auto vt1 = row(VT, i);
+            auto vt2 = row(VT, i + 1);
+            rot(vt1, vt2, c, s);
+        }
+        return svd_qr(Uplo::Lower, true, true, d, e1, U1, VT1);
+    }
+
+    // Divide the matrix into two blocks with the middle row nl
+    const idx_t nl = n / 2;
+    const real_t alpha = d[nl];
+    const real_t beta = e[nl];
+
+    // Solve each subproblem
+    {
+        auto d1 = slice(d, range{0, nl});
+        auto e1 = slice(e, range{0, nl});
+        auto U1 = slice(U, range{0, nl}, range{0, nl});
+        auto VT1 = slice(VT, range{0, nl + 1}, range{0, nl + 1});
+        int info = lasd0(d1, e1, U1, VT1, smlsiz);
+        if (info != 0) return info;
+
+        auto d2 = slice(d, range{nl + 1, n});
+        auto e2 = slice(e, range{nl + 1, m - 1});
+        auto U2 = slice(U, range{nl + 1, n}, range{nl + 1, n});
+        auto VT2 = slice(VT, range{nl + 1, m}, range{nl + 1, m});
+        info = lasd0(d2, e2, U2, VT2, smlsiz);
+        if (info != 0) return info;
+
+        auto U12 = slice(U, range{0, nl}, range{nl, n});
+        auto U21 = slice(U, range{nl + 1, n}, range{0, nl + 1});
+        auto Unl = slice(U, range{nl, nl + 1}, range{0, n});
+        laset(GENERAL, zero, zero, U12);
+        laset(GENERAL, zero, zero, U21);
+        laset(GENERAL, zero, zero, Unl);
+        U(nl, nl) = one;
+
+        auto VT12 = slice(VT, range{0, nl + 1}, range{nl + 1, m});
+        auto VT21 = slice(VT, range{nl + 1, m}, range{0, nl + 1});
+        laset(GENERAL, zero, zero, VT12);
+        laset(GENERAL, zero, zero, VT21);
+    }
+
+    // Merge the SVDs of the two blocks
+    return lasd1(nl, d, alpha, beta, U, VT);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LASD0_HH
@@ -0,0 +1,163 @@
+/// @file lasd1.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlasd1.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LASD1_HH
+#define TLAPACK_LASD1_HH
+
+#include <array>
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/lasd2.hpp"
+#include "tlapack/lapack/lasd3.hpp"
+
+namespace tlapack {
+
+/**
+ * LASD1 used by BDSDC. Computes the SVD of an upper bidiagonal n-by-m matrix
+ * B, where n = nl + nr + 1 and m = n + sqre, from the SVDs of its upper and
+ * lower blocks.
+ *
+ *      B = ( B1    0   )  = U * ( D  0 ) * VT
+ *          ( alpha beta )
+ *          ( 0     B2  )
+ *
+ * where B1 is nl-by-(nl+1), B2 is nr-by-(nr+sqre), alpha is the diagonal
+ * and beta the off-diagonal element of the middle row nl.
+ *
+ * The algorithm consists of three stages:
+ *
+ * The first stage consists of deflating the size of the problem when there
+ * are multiple singular values or when there are zeros in the z vector. For
+ * each such occurrence the dimension of the secular equation problem is
+ * reduced by one. This stage is performed by the routine lasd2().
+ *
+ * The second stage consists of calculating the updated singular values. This
+ * is done by finding the square roots of the roots of the secular equation
+ * via the routine lasd4() (as called by lasd3()). This routine also
+ * calculates the singular vectors of the current problem.
+ *
+ * The final stage consists of computing the updated singular vectors
+ * directly using the updated singular values with matrix-matrix products.
+ *
+ * @param[in] nl
+ *      The row dimension of the upper block. nl >= 1.
+ *
+ * @param[in,out] d Real vector of length n.
+ *      On entry, d[0:nl] and d[nl+1:n] contain the singular values of the
+ *      upper and lower blocks. d[nl] is not referenced.
+ *      On exit, the singular values of B. d[0:k] is in ascending order, where
+ *      k is the size of the secular equation, and d[k:n] contains the
+ *      deflated singular values.
+ *
+ * @param[in] alpha
+ *      The diagonal element of the middle row.
+ *
+ * @param[in] beta
+ *      The off-diagonal element of the middle row.
+ *
+ * @param[in,out] U Real n-by-n matrix.
+ *      On entry, U[0:nl,0:nl] contains the left singular vectors of the upper
+ *      block, U[nl+1:n,nl+1:n] contains the left singular vectors of the
+ *      lower block, U(nl,nl) = 1, and U is zero elsewhere.
+ *      On exit, U contains the left singular vectors of B.
+ *
+ * @param[in,out] VT Real m-by-m matrix.
+ *      On entry, VT[0:nl+1,0:nl+1] contains the transposed right singular
+ *      vectors of the upper block, VT[nl+1:m,nl+1:m] contains the transposed
+ *      right singular vectors of the lower block, and VT is zero elsewhere.
+ *      On exit, VT contains the transposed right singular vectors of B. If
+ *      sqre = 1, VT[m-1,:] is the null vector of B.
+ *
+ * @return 0 if success.
+ * @return 1 if a singular value did not converge.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_VECTOR d_t,
+          TLAPACK_REAL real_t,
+          TLAPACK_MATRIX matrixU_t,
+          TLAPACK_MATRIX matrixVT_t>
+int lasd1(size_type<matrixU_t> nl,
+          d_t& d,
+          real_t alpha,
+          real_t beta,
+          matrixU_t& U,
+          matrixVT_t& VT)
+{
+    using idx_t = size_type<matrixU_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functors
+    Create<matrixU_t> new_matrix;
+    Create<vector_type<d_t>> new_vector;
+
+    // constants
+    const real_t zero(0);
+    const idx_t n = nrows(U);
+    const idx_t m = ncols(VT);
+
+    // check arguments
+    tlapack_check(nl >= 1 && nl < n);
+    tlapack_check(ncols(U) == n);
+    tlapack_check(nrows(VT) == m && (m == n || m == n + 1));
+    tlapack_check((idx_t)size(d) == n);
+
+    // Scale
+    d[nl] = zero;
+    real_t orgnrm = max(abs(alpha), abs(beta));
+    for (idx_t i = 0; i < n; ++i)
+        orgnrm = max(orgnrm, abs(d[i]));
+    if (orgnrm == zero) return 0;
+    for (idx_t i = 0; i < n; ++i)
+        d[i] /= orgnrm;
+    alpha /= orgnrm;
+    beta /= orgnrm;
+
+    // Allocates workspace
+    auto work_ = workspace_arena<real_t>().get(WorkInfo(n, 2));
+    auto W = new_matrix(work_.vector(), n, 2);
+    auto z = col(W, 0);
+    auto dsigma = col(W, 1);
+
+    auto U2_ = workspace_arena<real_t>().get(WorkInfo(n, n));
+    auto U2 = new_matrix(U2_.vector(), n, n);
+    auto VT2_ = workspace_arena<real_t>().get(WorkInfo(n, m));
+    auto VT2 = new_matrix(VT2_.vector(), n, m);
+
+    auto iwork_ = workspace_arena<idx_t>().get(n);
+    auto idxc = new_vector(iwork_.vector(), n);
+
+    // Deflate singular values
+    idx_t k;
+    std::array<idx_t, 4> ctot;
+    int info =
+        lasd2(k, nl, d, U, VT, alpha, beta, z, dsigma, U2, VT2, idxc, ctot);
+    if (info != 0) return info;
+
+    // Solve the secular equation and update the singular vectors
+    {
+        auto S_ = workspace_arena<real_t>().get(WorkInfo(k, 2 * k));
+        auto S = new_matrix(S_.vector(), k, 2 * k);
+        auto U2k = slice(U2, range{0, n}, range{0, k});
+        auto VT2k = slice(VT2, range{0, k}, range{0, m});
+        info = lasd3(k, nl, ctot, d, U, VT, dsigma, z, U2k, VT2k, idxc, S);
+        if (info != 0) return info;
+    }
+
+    // Unscale
+    for (idx_t i = 0; i < n; ++i)
+        d[i] *= orgnrm;
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LASD1_HH
@@ -0,0 +1,345 @@
+/// @file lasd2.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlasd2.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LASD2_HH
+#define TLAPACK_LASD2_HH
+
+#include <algorithm>
+#include <array>
+
+#include "tlapack/base/constants.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/copy.hpp"
+#include "tlapack/blas/rot.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/lapy2.hpp"
+
+namespace tlapack {
+
+/**
+ * LASD2 used by BDSDC. Merges the two sets of singular values together into
+ * a single sorted set. Then it tries to deflate the size of the problem.
+ *
+ * The n-by-m upper bidiagonal matrix, m = n + sqre, is written as
+ *
+ *      B = U * ( D1   0    0  0 ) * VT,
+ *              ( z1'  0   z2' 0 )
+ *              ( 0    0   D2  0 )
+ *
+ * where the middle row is row nl, D1 and D2 are the singular values of the
+ * two subproblems and z1' and z2' are alpha times the column nl of VT and
+ * beta times the column nl+1 of VT. If sqre = 1, the components of z that
+ * correspond to the null vectors of the two subproblems are first merged
+ * with a rotation of rows nl and m-1 of VT.
+ *
+ * There are two ways in which deflation can occur: when two or more singular
+ * values are close together or if there is a tiny entry in the z vector. For
+ * each such occurrence the order of the related secular equation problem is
+ * reduced by one.
+ *
+ * The columns of U, and the rows of VT, are classified in four types:
+ *  - 0: nonzero only in the first nl+1 rows of U and columns of VT;
+ *  - 1: dense, i.e., the result of a rotation between the two subproblems;
+ *  - 2: nonzero only in the last n-nl-1 rows of U and m-nl-1 columns of VT;
+ *  - 3: deflated.
+ * The non-deflated vectors are copied to U2 and VT2 grouped by type, so that
+ * the update in lasd3() can skip the zero blocks.
+ *
+ * @param[out] k
+ *      The number of non-deflated singular values, and the order of the
+ *      related secular equation. 1 <= k <= n.
+ *
+ * @param[in] nl
+ *      The row dimension of the upper block. nl >= 1.
+ *
+ * @param[in,out] d Real vector of length n.
+ *      On entry, d[0:nl] and d[nl+1:n] contain the singular values of the two
+ *      subproblems. d[nl] is not referenced.
+ *      On exit, d[k:n] contains the deflated singular values.
+ *
+ * @param[in,out] U Real n-by-n matrix.
+ *      On entry, U contains the left singular vectors of the two subproblems
+ *      in the two square blocks with corners at (0,0), (nl-1,nl-1) and
+ *      (nl+1,nl+1), (n-1,n-1), and U(nl,nl) = 1.
+ *      On exit, U[:,k:n] contains the left singular vectors of the deflated
+ *      singular values.
+ *
+ * @param[in,out] VT Real m-by-m matrix.
+ *      On entry, VT contains the transposed right singular vectors of the
+ *      two subproblems in the two square blocks with corners at (0,0),
+ *      (nl,nl) and (nl+1,nl+1), (m-1,m-1).
+ *      On exit, VT[k:n,:] contains the transposed right singular vectors of
+ *      the deflated singular values and, if sqre = 1, VT[m-1,:] contains the
+ *      null vector of B.
+ *
+ * @param[in] alpha
+ *      The diagonal element of the middle row.
+ *
+ * @param[in] beta
+ *      The off-diagonal element of the middle row.
+ *
+ * @param[out] z Real vector of length n.
+ *      z[0:k] contains the components of the deflation-adjusted updating
+ *      vector, in the same order as dsigma.
+ *
+ * @param[out] dsigma Real vector of length n.
+ *      dsigma[0:k] contains the non-deflated singular values in ascending
+ *      order, which are the poles of the secular equation. dsigma[0] = 0.
+ *
+ * @param[out] U2 Real n-by-n matrix.
+ *      U2[:,0:k] contains the left singular vectors associated to dsigma,
+ *      grouped by type.
+ *
+ * @param[out] VT2 Real n-by-m matrix.
+ *      VT2[0:k,:] contains the transposed right singular vectors associated
+ *      to dsigma, grouped by type.
+ *
+ * @param[out] idxc Integer vector of length n.
+ *      U2[:,j] and VT2[j,:] are associated to dsigma[idxc[j]], for
+ *      j = 0, ..., k-1.
+ *
+ * @param[out] ctot Number of columns of each type.
+ *      ctot[3] = n - k is the number of deflated singular values.
+ *
+ * @return 0 if success.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_VECTOR d_t,
+          TLAPACK_MATRIX matrixU_t,
+          TLAPACK_MATRIX matrixVT_t,
+          TLAPACK_REAL real_t,
+          TLAPACK_VECTOR z_t,
+          TLAPACK_VECTOR dsigma_t,
+          TLAPACK_MATRIX matrixU2_t,
+          TLAPACK_MATRIX matrixVT2_t,
+          TLAPACK_VECTOR idxc_t>
+int lasd2(size_type<matrixU_t>& k,
+          size_type<matrixU_t> nl,
+          d_t& d,
+          matrixU_t& U,
+          matrixVT_t& VT,
+          real_t alpha,
+          real_t beta,
+          z_t& z,
+          dsigma_t& dsigma,
+          matrixU2_t& U2,
+          matrixVT2_t& VT2,
+          idxc_t& idxc,
+          std::array<size_type<matrixU_t>, 4>& ctot)
+{
+    using idx_t = size_type<matrixU_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const real_t zero(0);
+    const real_t two(2);
+    const real_t eight(8);
+    const idx_t n = nrows(U);
+    const idx_t m = ncols(VT);
+
+    // check arguments
+    tlapack_check(nl >= 1 && nl < n);
+    tlapack_check(ncols(U) == n);
+    tlapack_check(nrows(VT) == m && (m == n || m == n + 1));
+    tlapack_check((idx_t)size(d) == n);
+    tlapack_check((idx_t)size(z) >= n);
+    tlapack_check((idx_t)size(dsigma) >= n);
+    tlapack_check(nrows(U2) == n && ncols(U2) == n);
+    tlapack_check(nrows(VT2) == n && ncols(VT2) == m);
+    tlapack_check((idx_t)size(idxc) >= n);
+
+    // Functors
+    Create<matrixU_t> new_matrix;
+    Create<vector_type<z_t>> new_vector;
+
+    // Workspace. Here, zp[i] is the component of the updating vector
+    // associated to U[:,i] and VT[i,:].
+    auto zp_ = workspace_arena<real_t>().get(m);
+    auto zp = new_vector(zp_.vector(), m);
+
+    auto iwork_ = workspace_arena<idx_t>().get(WorkInfo(n, 2));
+    auto iW = new_matrix(iwork_.vector(), n, 2);
+    auto idxp = col(iW, 0);
+    auto coltyp = col(iW, 1);
+
+    auto indx_ = workspace_arena<idx_t>().get(n);
+    auto& indx = indx_.vector();
+
+    // Form the updating vector
+    for (idx_t i = 0; i <= nl; ++i)
+        zp[i] = alpha * VT(i, nl);
+    for (idx_t i = nl + 1; i < m; ++i)
+        zp[i] = beta * VT(i, nl + 1);
+    d[nl] = zero;
+
+    for (idx_t i = 0; i < nl; ++i)
+        coltyp[i] = 0;
+    coltyp[nl] = 0;
+    for (idx_t i = nl + 1; i < n; ++i)
+        coltyp[i] = 2;
+
+    // Calculate the allowable deflation tolerance
+    const real_t eps = uroundoff<real_t>();
+    real_t tol = max(abs(alpha), abs(beta));
+    for (idx_t i = 0; i < n; ++i)
+        tol = max(tol, abs(d[i]));
+    tol = eight * eps * tol;
+
+    // If sqre = 1, rotate the null vectors of the two subproblems so that the
+    // last component of z is zero. VT[m-1,:] is then a null vector of B.
+    if (m > n) {
+        const real_t z1 = lapy2(zp[nl], zp[n]);
+        if (z1 <= tol)
+            zp[nl] = tol;
+        else {
+            const real_t c = zp[nl] / z1;
+            const real_t s = zp[n] / z1;
+            zp[nl] = z1;
+            auto vt1 = row(VT, nl);
+            auto vt2 = row(VT, n);
+            rot(vt1, vt2, c, s);
+            coltyp[nl] = 1;
+        }
+    }
+    else if (abs(zp[nl]) <= tol)
+        zp[nl] = tol;
+
+    // Sort the singular values of the subproblems into increasing order
+    indx.resize(n - 1);
+    for (idx_t i = 0; i < nl; ++i)
+        indx[i] = i;
+    for (idx_t i = nl + 1; i < n; ++i)
+        indx[i - 1] = i;
+    std::stable_sort(indx.begin(), indx.end(),
+                     [&d](idx_t i, idx_t j) { return d[i] < d[j]; });
+
+    // The middle row is associated to the pole zero, which is never deflated
+    dsigma[0] = zero;
+    z[0] = zp[nl];
+    idxp[0] = nl;
+
+    // If there are multiple singular values then the problem deflates. Here
+    // the number of equal singular values are found. As each equal singular
+    // value is found, a rotation is computed to rotate the corresponding
+    // singular subspace so that the corresponding components of z are zero in
+    // this new basis.
+    k = 1;
+    idx_t k2 = n;
+    idx_t pj = n;  // Index of the last non-deflated singular value, n if none
+    for (idx_t j = 0; j + 1 < n; ++j) {
+        const idx_t nj = indx[j];
+        if (abs(zp[nj]) <= tol) {
+            // Deflate due to small z component
+            --k2;
+            coltyp[nj] = 3;
+            idxp[k2] = nj;
+            continue;
+        }
+        if (pj == n) {
+            pj = nj;
+            continue;
+        }
+
+        // Check if singular values are close enough to allow deflation
+        if (abs(d[nj] - d[pj]) <= tol) {
+            // Deflation is possible
+            real_t s = zp[pj];
+            real_t c = zp[nj];
+            const real_t tau = lapy2(c, s);
+            c = c / tau;
+            s = -s / tau;
+            zp[nj] = tau;
+            zp[pj] = zero;
+            if (coltyp[nj] != coltyp[pj]) coltyp[nj] = 1;
+            coltyp[pj] = 3;
+
+            auto upj = col(U, pj);
+            auto unj = col(U, nj);
+            rot(upj, unj, c, s);
+            auto vtpj = row(VT, pj);
+            auto vtnj = row(VT, nj);
+            rot(vtpj, vtnj, c, s);
+
+            --k2;
+            idxp[k2] = pj;
+        }
+        else {
+            dsigma[k] = d[pj];
+            z[k] = zp[pj];
+            idxp[k] = pj;
+            ++k;
+        }
+        pj = nj;
+    }
+
+    // Record the last singular value
+    if (pj < n) {
+        dsigma[k] = d[pj];
+        z[k] = zp[pj];
+        idxp[k] = pj;
+        ++k;
+    }
+
+    // Keep the smallest nonzero pole away from zero
+    const real_t hlftol = tol / two;
+    if (k > 1 && abs(dsigma[1]) <= hlftol) dsigma[1] = hlftol;
+
+    // Count up the total number of the various types of columns, then form a
+    // permutation which positions the four column types into four uniform
+    // groups (although one or more of these groups may be empty).
+    ctot = {0, 0, 0, 0};
+    for (idx_t j = 0; j < n; ++j)
+        ++ctot[coltyp[j]];
+
+    // psm[ct] is the position in U2 of the next column of type ct
+    std::array<idx_t, 4> psm;
+    psm[0] = 0;
+    psm[1] = ctot[0];
+    psm[2] = psm[1] + ctot[1];
+    psm[3] = psm[2] + ctot[2];
+
+    // Sort the singular vectors into U2 and VT2 grouped by type. The singular
+    // vectors which were not deflated go into the first k columns of U2 and
+    // rows of VT2, while those which were deflated go into the last n-k. The
+    // deflated singular values are stored in zp[k:n].
+    for (idx_t j = 0; j < n; ++j) {
+        const idx_t js = idxp[j];
+        const idx_t ct = coltyp[js];
+        const idx_t pos = psm[ct]++;
+        auto u2 = col(U2, pos);
+        copy(col(U, js), u2);
+        auto vt2 = row(VT2, pos);
+        copy(row(VT, js), vt2);
+        if (ct == 3)
+            zp[pos] = d[js];
+        else
+            idxc[pos] = j;
+    }
+
+    // The deflated singular values and their corresponding vectors go back
+    // into the last n-k slots of d, U and VT respectively.
+    if (k < n) {
+        auto U2d = slice(U2, range{0, n}, range{k, n});
+        auto Ud = slice(U, range{0, n}, range{k, n});
+        lacpy(GENERAL, U2d, Ud);
+        auto VT2d = slice(VT2, range{k, n}, range{0, m});
+        auto VTd = slice(VT, range{k, n}, range{0, m});
+        lacpy(GENERAL, VT2d, VTd);
+        for (idx_t j = k; j < n; ++j)
+            d[j] = zp[j];
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LASD2_HH
@@ -0,0 +1,217 @@
+/// @file lasd3.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlasd3.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LASD3_HH
+#define TLAPACK_LASD3_HH
+
+#include <array>
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/nrm2.hpp"
+#include "tlapack/blas/scal.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/lasd4.hpp"
+
+namespace tlapack {
+
+/**
+ * LASD3 used by BDSDC. Finds the roots of the secular equation, as defined by
+ * the values in dsigma and z, between 0 and k-1. It makes the appropriate
+ * calls to lasd4() and then updates the singular vectors by multiplying the
+ * matrices of singular vectors of the pair of subproblems being combined by
+ * the matrices of singular vectors of the k-by-k problem which is solved
+ * here.
+ *
+ * The components of the singular vectors of the secular equation are
+ * computed from the formula of Gu and Eisenstat, which guarantees their
+ * numerical orthogonality.
+ *
+ * @param[in] k
+ *      The size of the secular equation. 1 <= k <= n.
+ *
+ * @param[in] nl
+ *      The row dimension of the upper block.
+ *
+ * @param[in] ctot Number of columns of each type, as computed by lasd2().
+ *
+ * @param[out] d Real vector of length n.
+ *      d[0:k] contains the updated singular values in ascending order.
+ *
+ * @param[out] U Real n-by-n matrix.
+ *      U[:,0:k] contains the updated left singular vectors.
+ *
+ * @param[out] VT Real m-by-m matrix.
+ *      VT[0:k,:] contains the updated transposed right singular vectors.
+ *
+ * @param[in] dsigma Real vector of length k.
+ *      The poles of the secular equation, in increasing order, with
+ *      dsigma[0] = 0.
+ *
+ * @param[in,out] z Real vector of length k.
+ *      On entry, the components of the deflation-adjusted updating vector.
+ *      On exit, z has been destroyed.
+ *
+ * @param[in] U2 Real n-by-k matrix.
+ *      The left singular vectors associated to dsigma, grouped by type as in
+ *      lasd2().
+ *
+ * @param[in] VT2 Real k-by-m matrix.
+ *      The transposed right singular vectors associated to dsigma, grouped
+ *      by type as in lasd2().
+ *
+ * @param[in] idxc Integer vector of length k.
+ *      U2[:,j] and VT2[j,:] are associated to dsigma[idxc[j]].
+ *
+ * @param S Real k-by-2k matrix. Workspace.
+ *
+ * @return 0 if success.
+ * @return 1 if a singular value did not converge.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_VECTOR d_t,
+          TLAPACK_MATRIX matrixU_t,
+          TLAPACK_MATRIX matrixVT_t,
+          TLAPACK_VECTOR dsigma_t,
+          TLAPACK_VECTOR z_t,
+          TLAPACK_MATRIX matrixU2_t,
+          TLAPACK_MATRIX matrixVT2_t,
+          TLAPACK_VECTOR idxc_t,
+          TLAPACK_MATRIX matrixS_t>
+int lasd3(size_type<matrixU_t> k,
+          size_type<matrixU_t> nl,
+          const std::array<size_type<matrixU_t>, 4>& ctot,
+          d_t& d,
+          matrixU_t& U,
+          matrixVT_t& VT,
+          const dsigma_t& dsigma,
+          z_t& z,
+          const matrixU2_t& U2,
+          const matrixVT2_t& VT2,
+          const idxc_t& idxc,
+          matrixS_t& S)
+{
+    using idx_t = size_type<matrixU_t>;
+    using real_t = type_t<matrixU_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const idx_t n = nrows(U);
+    const idx_t m = ncols(VT);
+
+    // check arguments
+    tlapack_check(k >= 1 && k <= n);
+    tlapack_check(nrows(S) >= k && ncols(S) >= 2 * k);
+
+    auto dsig = slice(dsigma, range{0, k});
+    auto zk = slice(z, range{0, k});
+
+    // Columns j of Q and W store dsigma[i] - d[j] and dsigma[i] + d[j],
+    // respectively, and later the left and right singular vectors of the
+    // secular equation.
+    auto Q = slice(S, range{0, k}, range{0, k});
+    auto W = slice(S, range{0, k}, range{k, 2 * k});
+
+    // Normalize z
+    real_t rho = nrm2(zk);
+    scal(one / rho, zk);
+    rho = rho * rho;
+
+    // Find the roots of the secular equation
+    for (idx_t j = 0; j < k; ++j) {
+        auto q = col(Q, j);
+        auto w = col(W, j);
+        const int info = lasd4(j, dsig, zk, q, rho, d[j], w);
+        if (info != 0) return info;
+    }
+
+    // Compute updated z
+    for (idx_t i = 0; i < k; ++i) {
+        real_t zi = Q(i, k - 1) * W(i, k - 1);
+        for (idx_t j = 0; j < i; ++j)
+            zi *= Q(i, j) * W(i, j) / (dsig[i] - dsig[j]) /
+                  (dsig[i] + dsig[j]);
+        for (idx_t j = i; j + 1 < k; ++j)
+            zi *= Q(i, j) * W(i, j) / (dsig[i] - dsig[j + 1]) /
+                  (dsig[i] + dsig[j + 1]);
+        zk[i] = (zk[i] >= zero) ? sqrt(abs(zi)) : -sqrt(abs(zi));
+    }
+
+    // Compute the left and right singular vectors of the secular equation
+    for (idx_t j = 0; j < k; ++j) {
+        W(0, j) = zk[0] / Q(0, j) / W(0, j);
+        Q(0, j) = -one;
+        for (idx_t i = 1; i < k; ++i) {
+            W(i, j) = zk[i] / Q(i, j) / W(i, j);
+            Q(i, j) = dsig[i] * W(i, j);
+        }
+        auto q = col(Q, j);
+        scal(one / nrm2(q), q);
+        auto w = col(W, j);
+        scal(one / nrm2(w), w);
+    }
+
+    // Permute the rows of Q and W so that they follow the order of U2 and VT2
+    for (idx_t j = 0; j < k; ++j) {
+        for (idx_t i = 0; i < k; ++i)
+            zk[i] = Q(idxc[i], j);
+        for (idx_t i = 0; i < k; ++i)
+            Q(i, j) = zk[i];
+        for (idx_t i = 0; i < k; ++i)
+            zk[i] = W(idxc[i], j);
+        for (idx_t i = 0; i < k; ++i)
+            W(i, j) = zk[i];
+    }
+
+    // Compute the updated singular vectors. Vectors of type 0 are zero in the
+    // last n-nl-1 rows of U and m-nl-1 columns of VT, and vectors of type 2
+    // are zero in the first nl+1 rows of U and columns of VT.
+    const idx_t n12 = ctot[0] + ctot[1];
+    const idx_t n23 = ctot[1] + ctot[2];
+
+    auto U1 = slice(U, range{0, nl + 1}, range{0, k});
+    auto VT1 = slice(VT, range{0, k}, range{0, nl + 1});
+    if (n12 > 0) {
+        auto U21 = slice(U2, range{0, nl + 1}, range{0, n12});
+        auto Q1 = slice(Q, range{0, n12}, range{0, k});
+        gemm(NO_TRANS, NO_TRANS, one, U21, Q1, U1);
+        auto VT21 = slice(VT2, range{0, n12}, range{0, nl + 1});
+        auto W1 = slice(W, range{0, n12}, range{0, k});
+        gemm(TRANSPOSE, NO_TRANS, one, W1, VT21, VT1);
+    }
+    else {
+        laset(GENERAL, zero, zero, U1);
+        laset(GENERAL, zero, zero, VT1);
+    }
+
+    auto U3 = slice(U, range{nl + 1, n}, range{0, k});
+    auto VT3 = slice(VT, range{0, k}, range{nl + 1, m});
+    if (n23 > 0) {
+        auto U23 = slice(U2, range{nl + 1, n}, range{ctot[0], k});
+        auto Q3 = slice(Q, range{ctot[0], k}, range{0, k});
+        gemm(NO_TRANS, NO_TRANS, one, U23, Q3, U3);
+        auto VT23 = slice(VT2, range{ctot[0], k}, range{nl + 1, m});
+        auto W3 = slice(W, range{ctot[0], k}, range{0, k});
+        gemm(TRANSPOSE, NO_TRANS, one, W3, VT23, VT3);
+    }
+    else {
+        laset(GENERAL, zero, zero, U3);
+        laset(GENERAL, zero, zero, VT3);
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LASD3_HH
@@ -0,0 +1,303 @@
+/// @file lasd4.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlasd4.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LASD4_HH
+#define TLAPACK_LASD4_HH
+
+#include "tlapack/base/constants.hpp"
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/**
+ * LASD4 used by BDSDC. Computes the square root of the i-th updated
+ * eigenvalue of a positive symmetric rank-one modification to a positive
+ * diagonal matrix
+ *
+ *      diag( d ) * diag( d ) + rho * z * z**T,
+ *
+ * where 0 <= d[0] < d[1] < ... < d[n-1], rho > 0 and the Euclidean norm of z
+ * is one.
+ *
+ * The root sigma of the secular equation
+ *
+ *      1/rho + sum_j z[j]**2 / ( (d[j] - sigma) * (d[j] + sigma) ) = 0
+ *
+ * is computed as an offset from the closest pole d[org], so that the
+ * differences d[j] - sigma and the sums d[j] + sigma are obtained to high
+ * relative accuracy. These are the quantities needed to compute the singular
+ * vectors in lasd3(). The iteration is the one of laed4(), applied to the
+ * squares of the singular values.
+ *
+ * @param[in] i
+ *      The index of the singular value to be computed. 0 <= i < n.
+ *
+ * @param[in] d Real vector of length n.
+ *      The original singular values, in strictly increasing order.
+ *
+ * @param[in] z Real vector of length n.
+ *      The components of the updating vector.
+ *
+ * @param[out] delta Real vector of length n.
+ *      delta[j] = d[j] - sigma.
+ *
+ * @param[in] rho
+ *      The scalar in the symmetric updating formula. rho > 0.
+ *
+ * @param[out] sigma
+ *      The computed sigma_i, the i-th updated singular value.
+ *
+ * @param[out] work Real vector of length n.
+ *      work[j] = d[j] + sigma.
+ *
+ * @return 0 if success.
+ * @return 1 if the iteration did not converge.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_VECTOR d_t,
+          TLAPACK_VECTOR z_t,
+          TLAPACK_VECTOR delta_t,
+          TLAPACK_VECTOR work_t,
+          TLAPACK_REAL real_t>
+int lasd4(size_type<d_t> i,
+          const d_t& d,
+          const z_t& z,
+          delta_t& delta,
+          real_t rho,
+          real_t& sigma,
+          work_t& work)
+{
+    using idx_t = size_type<d_t>;
+
+    // constants
+    const real_t zero(0);
+    const real_t two(2);
+    const real_t four(4);
+    const idx_t n = size(d);
+    const idx_t maxit = 400;
+    const real_t eps = ulp<real_t>();
+
+    // check arguments
+    tlapack_check(i < n);
+    tlapack_check((idx_t)size(z) >= n);
+    tlapack_check((idx_t)size(delta) >= n);
+    tlapack_check((idx_t)size(work) >= n);
+
+    if (n == 1) {
+        sigma = sqrt(d[0] * d[0] + rho * z[0] * z[0]);
+        work[0] = d[0] + sigma;
+        delta[0] = -rho * z[0] * z[0] / work[0];
+        return 0;
+    }
+
+    const real_t rhoinv = real_t(1) / rho;
+
+    // Initial guess tau for sigma**2 - d[org]**2, and the interval
+    // [dltlb, dltub] that contains the root
+    idx_t org;
+    bool orgati = true;
+    real_t tau, dltlb, dltub;
+    if (i == n - 1) {
+        // sigma**2 lies in (d[n-1]**2, d[n-1]**2 + rho]
+        org = n - 1;
+        const real_t midpt = rho / two;
+        const real_t dn = d[n - 1];
+        for (idx_t j = 0; j < n; ++j)
+            delta[j] = (d[j] - dn) * (d[j] + dn) - midpt;
+
+        real_t psi = zero;
+        for (idx_t j = 0; j + 2 < n; ++j)
+            psi += z[j] * z[j] / delta[j];
+
+        const real_t c = rhoinv + psi;
+        const real_t w = c + z[n - 2] * z[n - 2] / delta[n - 2] +
+                         z[n - 1] * z[n - 1] / delta[n - 1];
+
+        const real_t delsq = (dn - d[n - 2]) * (dn + d[n - 2]);
+        const real_t a = -c * delsq + z[n - 2] * z[n - 2] + z[n - 1] * z[n - 1];
+        const real_t b = z[n - 1] * z[n - 1] * delsq;
+        const real_t sq = sqrt(a * a + four * b * c);
+        if (w <= zero) {
+            const real_t temp =
+                z[n - 2] * z[n - 2] / (delsq + rho) + z[n - 1] * z[n - 1] / rho;
+            if (c <= temp)
+                tau = rho;
+            else
+                tau = (a < zero) ? two * b / (sq - a) : (a + sq) / (two * c);
+            dltlb = midpt;
+            dltub = rho;
+        }
+        else {
+            tau = (a < zero) ? two * b / (sq - a) : (a + sq) / (two * c);
+            dltlb = zero;
+            dltub = midpt;
+        }
+    }
+    else {
+        // sigma**2 lies in (d[i]**2, d[i+1]**2)
+        const idx_t ip1 = i + 1;
+        const real_t delsq = (d[ip1] - d[i]) * (d[ip1] + d[i]);
+        const real_t midpt = delsq / two;
+        for (idx_t j = 0; j < n; ++j)
+            delta[j] = (d[j] - d[i]) * (d[j] + d[i]) - midpt;
+
+        real_t c = rhoinv;
+        for (idx_t j = 0; j < i; ++j)
+            c += z[j] * z[j] / delta[j];
+        for (idx_t j = i + 2; j < n; ++j)
+            c += z[j] * z[j] / delta[j];
+
+        const real_t w = c + z[i] * z[i] / delta[i] +
+                         z[ip1] * z[ip1] / delta[ip1];
+
+        if (w > zero) {
+            // d[i]**2 < sigma**2 < ( d[i]**2 + d[i+1]**2 ) / 2
+            orgati = true;
+            org = i;
+            const real_t a = c * delsq + z[i] * z[i] + z[ip1] * z[ip1];
+            const real_t b = z[i] * z[i] * delsq;
+            const real_t sq = sqrt(abs(a * a - four * b * c));
+            tau = (a > zero) ? two * b / (a + sq) : (a - sq) / (two * c);
+            dltlb = zero;
+            dltub = midpt;
+        }
+        else {
+            // ( d[i]**2 + d[i+1]**2 ) / 2 <= sigma**2 < d[i+1]**2
+            orgati = false;
+            org = ip1;
+            const real_t a = c * delsq - z[i] * z[i] - z[ip1] * z[ip1];
+            const real_t b = z[ip1] * z[ip1] * delsq;
+            const real_t sq = sqrt(abs(a * a + four * b * c));
+            tau = (a < zero) ? two * b / (a - sq) : -(a + sq) / (two * c);
+            dltlb = -midpt;
+            dltub = zero;
+        }
+    }
+    if (!(tau > dltlb && tau < dltub)) tau = (dltlb + dltub) / two;
+
+    // sigma = d[org] + eta
+    const real_t dorg = d[org];
+    real_t eta = tau / (dorg + sqrt(dorg * dorg + tau));
+    for (idx_t j = 0; j < n; ++j) {
+        delta[j] = (d[j] - dorg) - eta;
+        work[j] = (d[j] + dorg) + eta;
+    }
+
+    for (idx_t iter = 0; iter < maxit; ++iter) {
+        // Evaluate psi, phi and their derivatives
+        real_t psi = zero, dpsi = zero, erretm = zero;
+        for (idx_t j = 0; j < org; ++j) {
+            const real_t temp = z[j] / (work[j] * delta[j]);
+            psi += z[j] * temp;
+            dpsi += temp * temp;
+            erretm += psi;
+        }
+        erretm = abs(erretm);
+
+        real_t phi = zero, dphi = zero;
+        for (idx_t j = n - 1; j > org; --j) {
+            const real_t temp = z[j] / (work[j] * delta[j]);
+            phi += z[j] * temp;
+            dphi += temp * temp;
+            erretm += phi;
+        }
+
+        // The secular function and its derivative
+        const real_t tau2 = work[org] * delta[org];
+        real_t temp = z[org] / tau2;
+        const real_t dorgsq = temp * temp;
+        const real_t dw = dpsi + dphi + dorgsq;
+        temp = z[org] * temp;
+        const real_t w = rhoinv + phi + psi + temp;
+        erretm = real_t(8) * (phi - psi) + erretm + two * rhoinv +
+                 real_t(3) * abs(temp) + abs(tau2) * dw;
+
+        // Test for convergence
+        if (abs(w) <= eps * erretm) {
+            sigma = dorg + eta;
+            return 0;
+        }
+
+        tau = -tau2;
+        if (w <= zero)
+            dltlb = max(dltlb, tau);
+        else
+            dltub = min(dltub, tau);
+
+        // Calculate the new step from a rational interpolation of the two
+        // poles that enclose the root
+        const idx_t ia = (i == n - 1) ? n - 2 : i;
+        const idx_t ib = ia + 1;
+        const real_t da = work[ia] * delta[ia];
+        const real_t db = work[ib] * delta[ib];
+        real_t step;
+        if (i == n - 1) {
+            real_t c = w - da * dpsi - db * dorgsq;
+            const real_t a = (da + db) * w - da * db * (dpsi + dorgsq);
+            const real_t b = da * db * w;
+            if (c < zero) c = -c;
+            if (c == zero)
+                step = -w / (dpsi + dorgsq);
+            else if (a >= zero)
+                step = (a + sqrt(abs(a * a - four * b * c))) / (two * c);
+            else
+                step = two * b / (a - sqrt(abs(a * a - four * b * c)));
+        }
+        else {
+            const real_t delsq = (d[ib] - d[ia]) * (d[ib] + d[ia]);
+            real_t c;
+            if (orgati) {
+                temp = z[ia] / da;
+                c = w - db * dw + delsq * temp * temp;
+            }
+            else {
+                temp = z[ib] / db;
+                c = w - da * dw - delsq * temp * temp;
+            }
+            real_t a = (da + db) * w - da * db * dw;
+            const real_t b = da * db * w;
+            if (c == zero) {
+                if (a == zero) {
+                    a = (orgati) ? z[ia] * z[ia] + db * db * (dpsi + dphi)
+                                 : z[ib] * z[ib] + da * da * (dpsi + dphi);
+                }
+                step = b / a;
+            }
+            else if (a <= zero)
+                step = (a - sqrt(abs(a * a - four * b * c))) / (two * c);
+            else
+                step = two * b / (a + sqrt(abs(a * a - four * b * c)));
+        }
+
+        // The step must have the sign of -w. Otherwise, or if it leaves the
+        // interval that contains the root, use a Newton step or bisection.
+        if (w * step >= zero) step = -w / dw;
+        if (tau + step > dltub || tau + step < dltlb)
+            step = (w < zero) ? (dltub - tau) / two : (dltlb - tau) / two;
+
+        // Update eta so that ( dorg + eta )**2 = dorg**2 + tau + step
+        const real_t sig = dorg + eta;
+        const real_t deta = step / (sig + sqrt(abs(sig * sig + step)));
+        eta += deta;
+        for (idx_t j = 0; j < n; ++j) {
+            delta[j] -= deta;
+            work[j] += deta;
+        }
+    }
+
+    // The iteration did not converge
+    sigma = dorg + eta;
+    return 1;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LASD4_HH
@@ -0,0 +1,213 @@
+/// @file latrd.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zlatrd.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LATRD_HH
+#define TLAPACK_LATRD_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/axpy.hpp"
+#include "tlapack/blas/dot.hpp"
+#include "tlapack/blas/gemv.hpp"
+#include "tlapack/blas/hemv.hpp"
+#include "tlapack/blas/scal.hpp"
+#include "tlapack/lapack/conjugate.hpp"
+#include "tlapack/lapack/larfg.hpp"
+
+namespace tlapack {
+
+/** Reduces nb rows and columns of a Hermitian matrix A to real symmetric
+ * tridiagonal form by a unitary similarity transformation Q**H * A * Q, and
+ * returns the matrices V and W which are needed to apply the transformation to
+ * the unreduced part of A.
+ *
+ * If uplo = Uplo::Upper, the last nb columns of A are reduced and the update
+ * of the leading block is
+ * \[
+ *      A(0:n-nb,0:n-nb) := A(0:n-nb,0:n-nb) - V * W**H - W * V**H,
+ * \]
+ * with V = A(0:n-nb,n-nb:n) and W = W(0:n-nb,0:nb).
+ *
+ * If uplo = Uplo::Lower, the first nb columns of A are reduced and the update
+ * of the trailing block is
+ * \[
+ *      A(nb:n,nb:n) := A(nb:n,nb:n) - V * W**H - W * V**H,
+ * \]
+ * with V = A(nb:n,0:nb) and W = W(nb:n,0:nb).
+ *
+ * This is an auxiliary routine called by hetrd().
+ *
+ * @tparam uplo_t Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper:   Upper triangle of A is referenced;
+ *      - Uplo::Lower:   Lower triangle of A is referenced;
+ *
+ * @param[in,out] A n-by-n Hermitian matrix.
+ *      On exit, the nb reduced columns contain the Householder vectors in the
+ *      same layout used by hetd2(). The off-diagonal entries adjacent to the
+ *      reduced columns are set to one and their values are returned in e.
+ *
+ * @param[out] e Vector of length nb.
+ *      If uplo = Uplo::Upper, e[j] contains the element A(n-nb+j-1,n-nb+j) of
+ *      the tridiagonal matrix. If uplo = Uplo::Lower, e[j] contains the
+ *      element A(j+1,j). The entries of e are real.
+ *
+ * @param[out] tau Vector of length n-1.
+ *      The scalar factors of the elementary reflectors, stored as in hetd2().
+ *
+ * @param[out] W n-by-nb matrix.
+ *      The matrix W required to update the unreduced part of A.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_SMATRIX A_t,
+          TLAPACK_SVECTOR e_t,
+          TLAPACK_SVECTOR tau_t,
+          TLAPACK_SMATRIX W_t,
+          class uplo_t>
+void latrd(uplo_t uplo, A_t& A, e_t& e, tau_t& tau, W_t& W)
+{
+    using T = type_t<A_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<A_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const idx_t n = ncols(A);
+    const idx_t nb = ncols(W);
+    const real_t one(1);
+    const real_t half(0.5);
+
+    // check arguments
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check(nrows(A) == n);
+    tlapack_check(nrows(W) == n);
+    tlapack_check(nb <= n);
+    tlapack_check((idx_t)size(e) >= nb);
+    tlapack_check((idx_t)size(tau) >= n - 1);
+
+    // quick return
+    if (n <= 0) return;
+
+    if (uplo == Uplo::Upper) {
+        //
+        // Reduce last nb columns of upper triangle
+        //
+        for (idx_t j = nb - 1; j != idx_t(-1); --j) {
+            // Column i of A corresponds to column j of W
+            const idx_t i = n - nb + j;
+
+            // Update A(0:i+1,i)
+            A(i, i) = real(A(i, i));
+            if (i < n - 1) {
+                auto a = slice(A, range{0, i + 1}, i);
+
+                auto wrow = slice(W, i, range{j + 1, nb});
+                conjugate(wrow);
+                gemv(NO_TRANS, -one,
+                     slice(A, range{0, i + 1}, range{i + 1, n}), wrow, one,
+                     a);
+                conjugate(wrow);
+
+                auto arow = slice(A, i, range{i + 1, n});
+                conjugate(arow);
+                gemv(NO_TRANS, -one,
+                     slice(W, range{0, i + 1}, range{j + 1, nb}), arow, one,
+                     a);
+                conjugate(arow);
+
+                A(i, i) = real(A(i, i));
+            }
+            if (i > 0) {
+                // Generate elementary reflector H(i-1) to annihilate
+                // A(0:i-1,i)
+                auto v = slice(A, range{0, i}, i);
+                larfg(BACKWARD, COLUMNWISE_STORAGE, v, tau[i - 1]);
+                e[j] = real(A(i - 1, i));
+                A(i - 1, i) = one;
+
+                // Compute W(0:i,j)
+                auto w = slice(W, range{0, i}, j);
+                hemv(UPPER_TRIANGLE, one, slice(A, range{0, i}, range{0, i}),
+                     v, w);
+                if (i < n - 1) {
+                    auto A12 = slice(A, range{0, i}, range{i + 1, n});
+                    auto W12 = slice(W, range{0, i}, range{j + 1, nb});
+                    auto t = slice(W, range{i + 1, n}, j);
+
+                    gemv(CONJ_TRANS, one, W12, v, t);
+                    gemv(NO_TRANS, -one, A12, t, one, w);
+                    gemv(CONJ_TRANS, one, A12, v, t);
+                    gemv(NO_TRANS, -one, W12, t, one, w);
+                }
+                scal(tau[i - 1], w);
+
+                // Compute w := w - (1/2) * tau * (w**H * v) * v
+                axpy(-half * tau[i - 1] * dot(w, v), v, w);
+            }
+        }
+    }
+    else {
+        //
+        // Reduce first nb columns of lower triangle
+        //
+        for (idx_t i = 0; i < nb; ++i) {
+            // Update A(i:n,i)
+            A(i, i) = real(A(i, i));
+            if (i > 0) {
+                auto a = slice(A, range{i, n}, i);
+
+                auto wrow = slice(W, i, range{0, i});
+                conjugate(wrow);
+                gemv(NO_TRANS, -one, slice(A, range{i, n}, range{0, i}), wrow,
+                     one, a);
+                conjugate(wrow);
+
+                auto arow = slice(A, i, range{0, i});
+                conjugate(arow);
+                gemv(NO_TRANS, -one, slice(W, range{i, n}, range{0, i}), arow,
+                     one, a);
+                conjugate(arow);
+
+                A(i, i) = real(A(i, i));
+            }
+            if (i < n - 1) {
+                // Generate elementary reflector H(i) to annihilate A(i+2:n,i)
+                auto v = slice(A, range{i + 1, n}, i);
+                larfg(FORWARD, COLUMNWISE_STORAGE, v, tau[i]);
+                e[i] = real(A(i + 1, i));
+                A(i + 1, i) = one;
+
+                // Compute W(i+1:n,i)
+                auto w = slice(W, range{i + 1, n}, i);
+                hemv(LOWER_TRIANGLE, one,
+                     slice(A, range{i + 1, n}, range{i + 1, n}), v, w);
+                if (i > 0) {
+                    auto A21 = slice(A, range{i + 1, n}, range{0, i});
+                    auto W21 = slice(W, range{i + 1, n}, range{0, i});
+                    auto t = slice(W, range{0, i}, i);
+
+                    gemv(CONJ_TRANS, one, W21, v, t);
+                    gemv(NO_TRANS, -one, A21, t, one, w);
+                    gemv(CONJ_TRANS, one, A21, v, t);
+                    gemv(NO_TRANS, -one, W21, t, one, w);
+                }
+                scal(tau[i], w);
+
+                // Compute w := w - (1/2) * tau * (w**H * v) * v
+                axpy(-half * tau[i] * dot(w, v), v, w);
+            }
+        }
+    }
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LATRD_HH
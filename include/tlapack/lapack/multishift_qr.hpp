@@ -12,6 +12,8 @@
 #ifndef TLAPACK_MULTISHIFT_QR_HH
 #define TLAPACK_MULTISHIFT_QR_HH
 
+#include <chrono>
+
 #include "tlapack/base/utils.hpp"
 #include "tlapack/lapack/FrancisOpts.hpp"
 #include "tlapack/lapack/aggressive_early_deflation.hpp"
@@ -154,6 +156,14 @@ int multishift_qr_work(bool want_t,
     int n_sweep = 0;
     int n_shifts_total = 0;
 
+    // Timers
+    using clock = std::chrono::steady_clock;
+    double t_aed = 0;
+    double t_sweep = 0;
+    opts.t_aed_schur = 0;
+    opts.t_aed_deflate = 0;
+    opts.t_aed_update = 0;
+
     // check arguments
     tlapack_check_false(n != nrows(A));
     tlapack_check_false((idx_t)size(w) != n);
@@ -240,8 +250,10 @@ int multishift_qr_work(bool want_t,
 
         idx_t ls, ld;
         n_aed = n_aed + 1;
+        const auto t0_aed = clock::now();
         aggressive_early_deflation_work(want_t, want_z, istart, istop, nw, A, w,
                                         Z, ls, ld, work, opts);
+        t_aed += std::chrono::duration<double>(clock::now() - t0_aed).count();
 
         istop = istop - ld;
 
@@ -352,13 +364,18 @@ int multishift_qr_work(bool want_t,
 
         n_sweep = n_sweep + 1;
         n_shifts_total = n_shifts_total + ns;
+        const auto t0_sweep = clock::now();
         multishift_QR_sweep_work(want_t, want_z, istart, istop, A, shifts, Z,
-                                 work);
+                                 work, opts);
+        t_sweep +=
+            std::chrono::duration<double>(clock::now() - t0_sweep).count();
     }
 
     opts.n_aed = n_aed;
     opts.n_shifts_total = n_shifts_total;
     opts.n_sweep = n_sweep;
+    opts.t_aed = t_aed;
+    opts.t_sweep = t_sweep;
 
     return info;
 }
@@ -435,8 +452,10 @@ int multishift_qr_work(bool want_t,
  * @param[in,out] opts Options.
  *      - Output parameters
  *          @c opts.n_aed,
- *          @c opts.n_sweep and
- *          @c opts.n_shifts_total
+ *          @c opts.n_sweep,
+ *          @c opts.n_shifts_total and
+ *          the timers @c opts.t_aed, @c opts.t_aed_schur,
+ *          @c opts.t_aed_deflate, @c opts.t_aed_update and @c opts.t_sweep
  *      are updated inside the routine.
  *
  * @ingroup alloc_workspace
@@ -476,11 +495,11 @@ int multishift_qr(bool want_t,
         return lahqr(want_t, want_z, ilo, ihi, A, w, Z);
     }
 
-    // Allocates workspace
+    // Gets workspace from the arena
     WorkInfo workinfo =
         multishift_qr_worksize<TA>(want_t, want_z, ilo, ihi, A, w, Z, opts);
-    std::vector<TA> work_;
-    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+    auto work_ = workspace_arena<TA>().get(workinfo);
+    auto work = new_matrix(work_.vector(), workinfo.m, workinfo.n);
 
     return multishift_qr_work(want_t, want_z, ilo, ihi, A, w, Z, work, opts);
 }
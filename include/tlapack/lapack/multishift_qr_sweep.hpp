@@ -10,13 +10,83 @@
 #ifndef TLAPACK_QR_SWEEP_HH
 #define TLAPACK_QR_SWEEP_HH
 
+#include "tlapack/base/threads.hpp"
 #include "tlapack/base/utils.hpp"
+#include "tlapack/base/workspaceArena.hpp"
 #include "tlapack/blas/gemm.hpp"
+#include "tlapack/lapack/FrancisOpts.hpp"
+#include "tlapack/lapack/lacpy.hpp"
 #include "tlapack/lapack/lahqr_shiftcolumn.hpp"
 #include "tlapack/lapack/larfg.hpp"
+#include "tlapack/lapack/laset.hpp"
 #include "tlapack/lapack/move_bulge.hpp"
 
 namespace tlapack {
+
+namespace internal {
+
+    /// Number of OpenMP threads used by multishift_QR_sweep_work().
+    inline int multishift_QR_sweep_num_threads(const FrancisOpts& opts)
+    {
+#ifdef _OPENMP
+        return (opts.nthreads > 0) ? opts.nthreads : omp_get_max_threads();
+#else
+        (void)opts;
+        return 1;
+#endif
+    }
+
+    /**
+     * Computes B := U^H B if side = Side::Left, or B := B U if
+     * side = Side::Right, in OpenMP tasks that update at most nb columns
+     * (side = Side::Left) or rows (side = Side::Right) of B each. Each task
+     * takes its workspace from the tlapack::workspace_arena() of the thread
+     * that runs it.
+     *
+     * @tparam matrix_t Matrix type used to allocate the workspace.
+     */
+    template <TLAPACK_SMATRIX matrix_t,
+              TLAPACK_MATRIX matrixU_t,
+              TLAPACK_SMATRIX matrixB_t>
+    void multishift_QR_sweep_tasks(Side side,
+                                   const matrixU_t& U,
+                                   matrixB_t& B,
+                                   size_type<matrixB_t> nb)
+    {
+        using T = type_t<matrixB_t>;
+        using real_t = real_type<T>;
+        using idx_t = size_type<matrixB_t>;
+        using range = pair<idx_t, idx_t>;
+
+        const real_t one(1);
+        const idx_t m = nrows(B);
+        const idx_t n = ncols(B);
+        const idx_t len = (side == Side::Left) ? n : m;
+
+        for (idx_t i = 0; i < len; i += nb) {
+            const idx_t ib = min(nb, len - i);
+            const range ri = (side == Side::Left) ? range{0, m}
+                                                  : range{i, i + ib};
+            const range ci = (side == Side::Left) ? range{i, i + ib}
+                                                  : range{0, n};
+            auto Bi = slice(B, ri, ci);
+            TLAPACK_OMP(task firstprivate(Bi, U))
+            {
+                Create<matrix_t> new_matrix;
+                auto W_ =
+                    workspace_arena<T>().get(WorkInfo(nrows(Bi), ncols(Bi)));
+                auto W = new_matrix(W_.vector(), nrows(Bi), ncols(Bi));
+                if (side == Side::Left)
+                    gemm(CONJ_TRANS, NO_TRANS, one, U, Bi, W);
+                else
+                    gemm(NO_TRANS, NO_TRANS, one, Bi, U, W);
+                lacpy(GENERAL, W, Bi);
+            }
+        }
+    }
+
+}  // namespace internal
+
 /** Worspace query of multishift_QR_sweep()
  *
  * @param[in] want_t bool.
@@ -81,13 +151,17 @@ void multishift_QR_sweep_work(bool want_t,
                               matrix_t& A,
                               const vector_t& s,
                               matrix_t& Z,
-                              work_t& work)
+                              work_t& work,
+                              const FrancisOpts& opts = {})
 {
     using TA = type_t<matrix_t>;
     using real_t = real_type<TA>;
     using idx_t = size_type<matrix_t>;
     using range = pair<idx_t, idx_t>;
 
+    // Functor
+    Create<matrix_t> new_matrix;
+
     const real_t one(1);
     const real_t zero(0);
     const idx_t n = ncols(A);
@@ -102,6 +176,21 @@ void multishift_QR_sweep_work(bool want_t,
         tlapack_check(nrows(Z) == n);
     }
 
+    // With more than one thread, the bulges are chased by a single thread of
+    // an OpenMP parallel region, and the other threads run the tasks with the
+    // off-diagonal updates
+    const int nt = internal::multishift_QR_sweep_num_threads(opts);
+    const bool use_tasks = (nt > 1);
+#ifdef _OPENMP
+    if (use_tasks && !omp_in_parallel()) {
+#pragma omp parallel num_threads(nt)
+#pragma omp single
+        multishift_QR_sweep_work(want_t, want_z, ilo, ihi, A, s, Z, work,
+                                 opts);
+        return;
+    }
+#endif
+
     // Matrix V
     auto [V, work1] = reshape(work, 3, size(s) / 2);
 
@@ -129,6 +218,35 @@ void multishift_QR_sweep_work(bool want_t,
     auto WV = slice(A, range{n_block_desired + 3, n - n_block_desired},
                     range{0, n_block_desired});
 
+    // With tasks, the blocks of bulge chasing alternate between U and Ualt
+    // for the orthogonal transformations, so that the next block can be
+    // chased while the tasks of the previous block still read its U
+    const idx_t nUalt = (use_tasks) ? n_block_desired : 0;
+    auto Ualt_ = workspace_arena<TA>().get(WorkInfo(nUalt, nUalt));
+    auto Ualt_matrix = new_matrix(Ualt_.vector(), nUalt, nUalt);
+    auto Ualt = slice(Ualt_matrix, range{0, nUalt}, range{0, nUalt});
+    bool use_Ualt = false;
+
+    // Defers the off-diagonal updates of the block of bulge chasing
+    // A(i0:i1,i0:i1) to OpenMP tasks: the columns j0:j1 of the rows i0:i1 of
+    // A, the rows k0:i0 of the columns i0:i1 of A and the columns i0:i1 of Z.
+    // Each task updates at most nb_task rows or columns
+    const idx_t nb_task = max<idx_t>(n_block_desired, 64);
+    auto defer_updates = [&](const auto& U2, idx_t i0, idx_t i1, idx_t j0,
+                             idx_t j1, idx_t k0) {
+        auto A_h = slice(A, range{i0, i1}, range{j0, j1});
+        internal::multishift_QR_sweep_tasks<matrix_t>(LEFT_SIDE, U2, A_h,
+                                                      nb_task);
+        auto A_v = slice(A, range{k0, i0}, range{i0, i1});
+        internal::multishift_QR_sweep_tasks<matrix_t>(RIGHT_SIDE, U2, A_v,
+                                                      nb_task);
+        if (want_z) {
+            auto Z_v = slice(Z, range{0, n}, range{i0, i1});
+            internal::multishift_QR_sweep_tasks<matrix_t>(RIGHT_SIDE, U2, Z_v,
+                                                          nb_task);
+        }
+    };
+
     // i_pos_block points to the start of the block of bulges
     idx_t i_pos_block;
 
@@ -299,11 +417,16 @@ void multishift_QR_sweep_work(bool want_t,
             istart_m = ilo;
             istop_m = ihi;
         }
+        // With tasks, only the columns of the next block are updated here.
+        // The remaining updates run while the next block is chased
+        const idx_t hstop =
+            (use_tasks) ? min(istop_m, ilo + n_block + n_block_desired)
+                        : istop_m;
         // Horizontal multiply
         if (ilo + n_shifts + 1 < istop_m) {
             idx_t i = ilo + n_block;
-            while (i < istop_m) {
-                idx_t iblock = std::min<idx_t>(istop_m - i, ncols(WH));
+            while (i < hstop) {
+                idx_t iblock = std::min<idx_t>(hstop - i, ncols(WH));
                 auto A_slice =
                     slice(A, range{ilo, ilo + n_block}, range{i, i + iblock});
                 auto WH_slice = slice(WH, range{0, nrows(A_slice)},
@@ -313,8 +436,12 @@ void multishift_QR_sweep_work(bool want_t,
                 i = i + iblock;
             }
         }
+        if (use_tasks) {
+            defer_updates(U2, ilo, ilo + n_block, hstop, istop_m, istart_m);
+            use_Ualt = !use_Ualt;
+        }
         // Vertical multiply
-        if (istart_m < ilo) {
+        if (!use_tasks && istart_m < ilo) {
             idx_t i = istart_m;
             while (i < ilo) {
                 idx_t iblock = std::min<idx_t>(ilo - i, nrows(WV));
@@ -328,7 +455,7 @@ void multishift_QR_sweep_work(bool want_t,
             }
         }
         // Update Z (also a vertical multiplication)
-        if (want_z) {
+        if (!use_tasks && want_z) {
             idx_t i = 0;
             while (i < n) {
                 idx_t iblock = std::min<idx_t>(n - i, nrows(WV));
@@ -356,7 +483,8 @@ void multishift_QR_sweep_work(bool want_t,
         // Actual blocksize
         idx_t n_block = n_shifts + n_pos;
 
-        auto U2 = slice(U, range{0, n_block}, range{0, n_block});
+        auto U2 =
+            slice(use_Ualt ? Ualt : U, range{0, n_block}, range{0, n_block});
         laset(GENERAL, zero, one, U2);
 
         // Near-the-diagonal bulge chase
@@ -511,11 +639,18 @@ void multishift_QR_sweep_work(bool want_t,
             istart_m = ilo;
             istop_m = ihi;
         }
+        // With tasks, only the columns of the next block are updated here.
+        // The tasks of the previous block must finish first, since they
+        // update the same rows of the columns on the right
+        const idx_t hstop =
+            (use_tasks) ? min(istop_m, i_pos_block + n_block + n_block_desired)
+                        : istop_m;
+        TLAPACK_OMP(taskwait)
         // Horizontal multiply
         if (i_pos_block + n_block < istop_m) {
             idx_t i = i_pos_block + n_block;
-            while (i < istop_m) {
-                idx_t iblock = std::min<idx_t>(istop_m - i, ncols(WH));
+            while (i < hstop) {
+                idx_t iblock = std::min<idx_t>(hstop - i, ncols(WH));
                 auto A_slice =
                     slice(A, range{i_pos_block, i_pos_block + n_block},
                           range{i, i + iblock});
@@ -526,8 +661,13 @@ void multishift_QR_sweep_work(bool want_t,
                 i = i + iblock;
             }
         }
+        if (use_tasks) {
+            defer_updates(U2, i_pos_block, i_pos_block + n_block, hstop,
+                          istop_m, istart_m);
+            use_Ualt = !use_Ualt;
+        }
         // Vertical multiply
-        if (istart_m < i_pos_block) {
+        if (!use_tasks && istart_m < i_pos_block) {
             idx_t i = istart_m;
             while (i < i_pos_block) {
                 idx_t iblock = std::min<idx_t>(i_pos_block - i, nrows(WV));
@@ -541,7 +681,7 @@ void multishift_QR_sweep_work(bool want_t,
             }
         }
         // Update Z (also a vertical multiplication)
-        if (want_z) {
+        if (!use_tasks && want_z) {
             idx_t i = 0;
             while (i < n) {
                 idx_t iblock = std::min<idx_t>(n - i, nrows(WV));
@@ -564,7 +704,8 @@ void multishift_QR_sweep_work(bool want_t,
     {
         idx_t n_block = ihi - i_pos_block;
 
-        auto U2 = slice(U, range{0, n_block}, range{0, n_block});
+        auto U2 =
+            slice(use_Ualt ? Ualt : U, range{0, n_block}, range{0, n_block});
         laset(GENERAL, zero, one, U2);
 
         // Near-the-diagonal bulge chase
@@ -771,8 +912,13 @@ void multishift_QR_sweep_work(bool want_t,
             istart_m = ilo;
             istop_m = ihi;
         }
+        if (use_tasks) {
+            // There is no next block, so all updates run in tasks
+            TLAPACK_OMP(taskwait)
+            defer_updates(U2, i_pos_block, ihi, ihi, istop_m, istart_m);
+        }
         // Horizontal multiply
-        if (ihi < istop_m) {
+        if (!use_tasks && ihi < istop_m) {
             idx_t i = ihi;
             while (i < istop_m) {
                 idx_t iblock = std::min<idx_t>(istop_m - i, ncols(WH));
@@ -786,7 +932,7 @@ void multishift_QR_sweep_work(bool want_t,
             }
         }
         // Vertical multiply
-        if (istart_m < i_pos_block) {
+        if (!use_tasks && istart_m < i_pos_block) {
             idx_t i = istart_m;
             while (i < i_pos_block) {
                 idx_t iblock = std::min<idx_t>(i_pos_block - i, nrows(WV));
@@ -800,7 +946,7 @@ void multishift_QR_sweep_work(bool want_t,
             }
         }
         // Update Z (also a vertical multiplication)
-        if (want_z) {
+        if (!use_tasks && want_z) {
             idx_t i = 0;
             while (i < n) {
                 idx_t iblock = std::min<idx_t>(n - i, nrows(WV));
@@ -814,6 +960,8 @@ void multishift_QR_sweep_work(bool want_t,
             }
         }
     }
+
+    TLAPACK_OMP(taskwait)
 }
 
 /** multishift_QR_sweep performs a single small-bulge multi-shift QR sweep.
@@ -841,6 +989,11 @@ void multishift_QR_sweep_work(bool want_t,
  *      On exit, the orthogonal updates applied to A accumulated
  *      into Z.
  *
+ * @param[in] opts Options.
+ *      - @c opts.nthreads: Number of OpenMP threads. With more than one
+ *      thread, the off-diagonal updates of each block of bulge chasing run in
+ *      OpenMP tasks while the next block of bulges is chased.
+ *
  * @ingroup alloc_workspace
  */
 template <TLAPACK_SMATRIX matrix_t,
@@ -852,7 +1005,8 @@ void multishift_QR_sweep(bool want_t,
                          size_type<matrix_t> ihi,
                          matrix_t& A,
                          const vector_t& s,
-                         matrix_t& Z)
+                         matrix_t& Z,
+                         const FrancisOpts& opts = {})
 {
     using TA = type_t<matrix_t>;
 
@@ -865,7 +1019,7 @@ void multishift_QR_sweep(bool want_t,
     std::vector<TA> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
-    multishift_QR_sweep_work(want_t, want_z, ilo, ihi, A, s, Z, work);
+    multishift_QR_sweep_work(want_t, want_z, ilo, ihi, A, s, Z, work, opts);
 }
 
 }  // namespace tlapack
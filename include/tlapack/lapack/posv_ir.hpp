@@ -0,0 +1,224 @@
+/// @file posv_ir.hpp Mixed-precision Cholesky solver with iterative
+/// refinement.
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dsposv.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_POSV_IR_HH
+#define TLAPACK_POSV_IR_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/hemm.hpp"
+#include "tlapack/lapack/RefinementOpts.hpp"
+#include "tlapack/lapack/iterative_refinement.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/lanhe.hpp"
+#include "tlapack/lapack/potrf.hpp"
+#include "tlapack/lapack/potrs.hpp"
+
+namespace tlapack {
+
+/** Computes the solution to a system of linear equations
+ * \[
+ *      A X = B,
+ * \]
+ * where A is Hermitian positive definite, using a Cholesky factorization
+ * computed in a lower precision and iterative refinement.
+ *
+ * The precision of the factorization is the precision of C, and the working
+ * precision is the one of X. The routine:
+ *  1. Copies the triangle uplo of A to C and computes $A = U^H U$ or
+ *     $A = L L^H$ with potrf() in the low precision.
+ *  2. Refines the solution with corrections computed in the low precision
+ *     and residuals computed in the working precision.
+ *  3. If the refinement stalls and opts.use_gmres is true, continues with
+ *     GMRES-IR preconditioned with the low-precision factor.
+ *  4. If the refinement does not converge, the entries of A overflow in the
+ *     low precision, or A is not positive definite in the low precision,
+ *     and opts.fallback is true, factors A with potrf() in the working
+ *     precision and solves the system with the factor.
+ *
+ * The refinement converges under the same condition as in gesv_ir().
+ *
+ * @tparam uplo_t
+ *      Access type: Upper or Lower.
+ *      Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is referenced;
+ *      - Uplo::Lower: Lower triangle of A is referenced.
+ *
+ * @param[in,out] A n-by-n Hermitian matrix.
+ *      On entry, the matrix A.
+ *      On exit, unchanged if the refinement converged. Otherwise, the factor
+ *      U or L from the Cholesky factorization in the working precision.
+ *
+ * @param[out] C n-by-n matrix in the low precision.
+ *      On exit, if the low-precision factorization was computed, the factor
+ *      U or L from the Cholesky factorization of A. Only the triangle uplo
+ *      is referenced.
+ *
+ * @param[in] B n-by-nrhs matrix.
+ *
+ * @param[out] X n-by-nrhs matrix.
+ *      On exit, the solution X.
+ *
+ * @param[in,out] opts Options. See gesv_ir().
+ *
+ * @return 0 if success.
+ * @return i, 0 < i <= n, if the leading minor of order i of A is not
+ *      positive definite in the working precision. The solution could not
+ *      be computed.
+ * @return n+1 if the refinement did not converge and opts.fallback is false.
+ *      X contains the best solution found.
+ * @return n+2 if the low-precision factorization could not be computed, i.e.,
+ *      the entries of A overflow in the low precision or A is not positive
+ *      definite in the low precision, and opts.fallback is false. X is not
+ *      modified.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t,
+          TLAPACK_SMATRIX matrixA_t,
+          TLAPACK_SMATRIX matrixC_t,
+          TLAPACK_SMATRIX matrixB_t,
+          TLAPACK_SMATRIX matrixX_t>
+int posv_ir(uplo_t uplo,
+            matrixA_t& A,
+            matrixC_t& C,
+            const matrixB_t& B,
+            matrixX_t& X,
+            RefinementOpts& opts)
+{
+    using T = type_t<matrixX_t>;
+    using real_t = real_type<T>;
+    using TC = type_t<matrixC_t>;
+    using real_low_t = real_type<TC>;
+    using idx_t = size_type<matrixA_t>;
+    using range = pair<idx_t, idx_t>;
+    using workC_t = matrix_type<matrixC_t>;
+
+    // Functor
+    Create<workC_t> new_matrix;
+
+    // Constants
+    const idx_t n = nrows(A);
+    const idx_t nrhs = ncols(B);
+
+    // Check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check(ncols(A) == n);
+    tlapack_check(nrows(C) == n && ncols(C) == n);
+    tlapack_check(nrows(B) == n);
+    tlapack_check(nrows(X) == n && ncols(X) == nrhs);
+
+    opts.n_iter = 0;
+    opts.n_gmres_step = 0;
+    opts.n_gmres_iter = 0;
+    opts.backward_error = 0;
+    opts.solver = RefinementSolver::Refinement;
+
+    // Quick return
+    if (n <= 0 || nrhs <= 0) return 0;
+
+    // Factor A in the low precision, unless its entries overflow
+    bool use_low =
+        (lanhe(MAX_NORM, uplo, A) <= real_t(safe_max<real_low_t>()));
+    if (use_low) {
+        // A failure in the low precision is not an error
+        PotrfOpts potrfOpts(NO_ERROR_CHECK);
+        potrfOpts.variant = PotrfVariant::Recursive;
+        lacpy(uplo, A, C);
+        use_low = (potrf(uplo, C, potrfOpts) == 0);
+    }
+
+    if (use_low) {
+        // Low-precision copy of the right-hand sides
+        std::vector<TC> W_;
+        auto W = new_matrix(W_, n, nrhs);
+
+        auto apply_A = [&A, uplo](const T& alpha, const auto& X_,
+                                  const T& beta, auto& Y_) {
+            hemm(LEFT_SIDE, uplo, alpha, A, X_, beta, Y_);
+        };
+        auto solve_low = [&](auto& R_) {
+            auto WR = cols(W, range(0, ncols(R_)));
+            lacpy(GENERAL, R_, WR);
+            potrs(uplo, C, WR);
+            lacpy(GENERAL, WR, R_);
+        };
+        // Applies the low-precision factor in the working precision
+        auto precond = [&](auto& V_) {
+            auto v = col(V_, 0);
+            if (uplo == Uplo::Upper) {
+                // Solve U^H U x = v
+                for (idx_t j = 0; j < n; ++j) {
+                    for (idx_t i = 0; i < j; ++i)
+                        v[j] -= conj(T(C(i, j))) * v[i];
+                    v[j] /= T(C(j, j));
+                }
+                for (idx_t j = n; j-- > 0;) {
+                    v[j] /= T(C(j, j));
+                    for (idx_t i = 0; i < j; ++i)
+                        v[i] -= T(C(i, j)) * v[j];
+                }
+            }
+            else {
+                // Solve L L^H x = v
+                for (idx_t j = 0; j < n; ++j) {
+                    v[j] /= T(C(j, j));
+                    for (idx_t i = j + 1; i < n; ++i)
+                        v[i] -= T(C(i, j)) * v[j];
+                }
+                for (idx_t j = n; j-- > 0;) {
+                    for (idx_t i = j + 1; i < n; ++i)
+                        v[j] -= conj(T(C(i, j))) * v[i];
+                    v[j] /= T(C(j, j));
+                }
+            }
+        };
+
+        const real_t anrm = lanhe(INF_NORM, uplo, A);
+        if (internal::mixed_precision_refinement(apply_A, solve_low, precond,
+                                                 anrm, B, X, opts))
+            return 0;
+    }
+
+    if (!opts.fallback) return use_low ? n + 1 : n + 2;
+
+    // Solve in the working precision
+    opts.solver = RefinementSolver::FullPrecision;
+    int info = potrf(uplo, A);
+    if (info != 0) return info;
+    lacpy(GENERAL, B, X);
+    potrs(uplo, A, X);
+
+    return 0;
+}
+
+/** @overload int posv_ir(uplo_t uplo, matrixA_t& A, matrixC_t& C,
+ *                       const matrixB_t& B, matrixX_t& X,
+ *                       RefinementOpts& opts)
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t,
+          TLAPACK_SMATRIX matrixA_t,
+          TLAPACK_SMATRIX matrixC_t,
+          TLAPACK_SMATRIX matrixB_t,
+          TLAPACK_SMATRIX matrixX_t>
+int posv_ir(
+    uplo_t uplo, matrixA_t& A, matrixC_t& C, const matrixB_t& B, matrixX_t& X)
+{
+    RefinementOpts opts = {};
+    return posv_ir(uplo, A, C, B, X, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_POSV_IR_HH
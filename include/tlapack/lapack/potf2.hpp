@@ -18,6 +18,62 @@
 
 namespace tlapack {
 
+namespace internal {
+
+    /**
+     * Cholesky factorization $A = L L^H$ of W interleaved n-by-n matrices.
+     *
+     * Only the lower triangle of each matrix is referenced. On exit, info[l]
+     * is 0 if lane l was factored successfully, and j+1 if the leading minor
+     * of order j+1 is not positive definite. Non-positive pivots are replaced
+     * by one so that the other lanes are not affected.
+     *
+     * @tparam N Order of the matrices if known at compile time, or -1. When
+     *      known, it replaces n as the loop bound.
+     */
+    template <int W, int N = -1, class T, class idx_t>
+    void potrf_interleaved(idx_t n_, T* X, int* info)
+    {
+        using real_t = real_type<T>;
+
+        // constants
+        const idx_t n = (N >= 0) ? idx_t(N) : n_;
+
+        for (int l = 0; l < W; ++l)
+            info[l] = 0;
+
+        for (idx_t j = 0; j < n; ++j) {
+            T* Xj = X + j * n * W;
+
+            // compute the diagonal entry
+            real_t d[W];
+            for (int l = 0; l < W; ++l) {
+                d[l] = real(Xj[j * W + l]);
+                if (!(d[l] > real_t(0))) {
+                    if (info[l] == 0) info[l] = j + 1;
+                    d[l] = real_t(1);
+                }
+                d[l] = sqrt(d[l]);
+                Xj[j * W + l] = d[l];
+            }
+
+            // scale the j-th column
+            for (idx_t i = j + 1; i < n; ++i)
+                for (int l = 0; l < W; ++l)
+                    Xj[i * W + l] /= d[l];
+
+            // update the lower triangle of A(j+1:n-1,j+1:n-1)
+            for (idx_t c = j + 1; c < n; ++c) {
+                T* Xc = X + c * n * W;
+                for (idx_t i = c; i < n; ++i)
+                    for (int l = 0; l < W; ++l)
+                        Xc[i * W + l] -= Xj[i * W + l] * conj(Xj[c * W + l]);
+            }
+        }
+    }
+
+}  // namespace internal
+
 /** Computes the Cholesky factorization of a Hermitian
  * positive definite matrix A using a level-2 algorithm.
  *
@@ -50,6 +106,9 @@ namespace tlapack {
  * @return i, 0 < i <= n, if the leading minor of order i is not
  *     positive definite, and the factorization could not be completed.
  *
+ * @note If the extents of A are known at compile time, the factorization is
+ * computed on a copy of A in the stack, with constant loop bounds.
+ *
  * @ingroup computational
  */
 template <TLAPACK_UPLO uplo_t,
@@ -74,6 +133,32 @@ int potf2(uplo_t uplo, matrix_t& A)
     // Quick return
     if (n <= 0) return 0;
 
+    // Tiny matrices with compile-time extents are factored in a local copy
+    if constexpr (has_small_static_extents<matrix_t>) {
+        constexpr idx_t N = static_nrows<matrix_t>;
+
+        // Lower triangle of A or of A^H
+        T a[N * N];
+        for (idx_t j = 0; j < N; ++j)
+            for (idx_t i = j; i < N; ++i)
+                a[i + j * N] = (uplo == Uplo::Lower) ? A(i, j) : conj(A(j, i));
+
+        int info;
+        internal::potrf_interleaved<1, int(N)>(N, a, &info);
+
+        // If A is not positive definite, the error is raised below
+        if (info == 0) {
+            for (idx_t j = 0; j < N; ++j)
+                for (idx_t i = j; i < N; ++i) {
+                    if (uplo == Uplo::Lower)
+                        A(i, j) = a[i + j * N];
+                    else
+                        A(j, i) = conj(a[i + j * N]);
+                }
+            return 0;
+        }
+    }
+
     if (uplo == Uplo::Upper) {
         // Compute the Cholesky factorization A = U^H * U
         for (idx_t j = 0; j < n; ++j) {
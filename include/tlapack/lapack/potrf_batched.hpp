@@ -0,0 +1,129 @@
+/// @file potrf_batched.hpp Computes the Cholesky factorizations of a batch of
+/// small matrices.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_POTRF_BATCHED_HH
+#define TLAPACK_POTRF_BATCHED_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/BatchedOpts.hpp"
+#include "tlapack/lapack/potrf.hpp"
+
+namespace tlapack {
+
+/** Computes the Cholesky factorizations of a batch of small Hermitian
+ * positive definite matrices.
+ *
+ * Each matrix A[b] of the batch is factored as in potrf(),
+ *      $A_b = U_b^H U_b,$ if uplo = Upper, or
+ *      $A_b = L_b L_b^H,$ if uplo = Lower.
+ * Groups of internal::batch_lanes<T> matrices are copied to an interleaved
+ * buffer and factored together, so that the innermost loops run over the
+ * batch. The groups are distributed among OpenMP threads.
+ *
+ * Matrices that are not positive definite are reported in info and left
+ * unchanged. Contrary to potrf(), no error is raised for them.
+ *
+ * @return The number of matrices for which the factorization failed.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of each A[b] is referenced;
+ *      - Uplo::Lower: Lower triangle of each A[b] is referenced.
+ *
+ * @param[in,out] A Strided or pointer-array batch of n-by-n matrices.
+ *      On successful exit, the factors U or L of each matrix.
+ *
+ * @param[out] info Array of length A.size(), or nullptr.
+ *      If not nullptr, info[b] is 0 if A[b] was factored successfully, or i,
+ *      0 < i <= n, if the leading minor of order i of A[b] is not positive
+ *      definite.
+ *
+ * @param[in] opts Options.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t, class batch_t>
+int potrf_batched(uplo_t uplo,
+                  batch_t& A,
+                  int* info = nullptr,
+                  const BatchedOpts& opts = {})
+{
+    using matrix_t = typename batch_t::matrix_type;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    constexpr int W = internal::batch_lanes<T>;
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check(A.m == A.n);
+
+    // constants
+    const idx_t n = A.n;
+    const idx_t count = A.size();
+
+    // quick return
+    if (count <= 0 || n <= 0) {
+        if (info)
+            for (idx_t b = 0; b < count; ++b)
+                info[b] = 0;
+        return 0;
+    }
+
+    int nfailed = 0;
+    internal::batch_for_each_group<W, T>(
+        count, opts,
+        [&](idx_t b0, idx_t nb, std::vector<T>& work, std::vector<idx_t>&) {
+            work.resize(n * n * W);
+            T* X = work.data();
+            int linfo[W];
+
+            // Copy the lower triangle of A[b] or of A[b]^H
+            for (idx_t l = 0; l < idx_t(W); ++l) {
+                if (l < nb) {
+                    const auto Al = A[b0 + l];
+                    for (idx_t j = 0; j < n; ++j)
+                        for (idx_t i = j; i < n; ++i)
+                            X[(i + j * n) * W + l] =
+                                (uplo == Uplo::Lower) ? Al(i, j)
+                                                      : conj(Al(j, i));
+                }
+                else {
+                    for (idx_t j = 0; j < n; ++j)
+                        for (idx_t i = j; i < n; ++i)
+                            X[(i + j * n) * W + l] = (i == j) ? T(1) : T(0);
+                }
+            }
+
+            internal::potrf_interleaved<W>(n, X, linfo);
+
+            for (idx_t l = 0; l < nb; ++l) {
+                const idx_t b = b0 + l;
+                auto Ab = A[b];
+                if (linfo[l] == 0) {
+                    for (idx_t j = 0; j < n; ++j)
+                        for (idx_t i = j; i < n; ++i) {
+                            if (uplo == Uplo::Lower)
+                                Ab(i, j) = X[(i + j * n) * W + l];
+                            else
+                                Ab(j, i) = conj(X[(i + j * n) * W + l]);
+                        }
+                }
+                else {
+                    TLAPACK_OMP(atomic)
+                    ++nfailed;
+                }
+                if (info) info[b] = linfo[l];
+            }
+        });
+
+    return nfailed;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_POTRF_BATCHED_HH
@@ -0,0 +1,185 @@
+/// @file potrf_tiled.hpp
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_POTRF_TILED_HH
+#define TLAPACK_POTRF_TILED_HH
+
+#include <vector>
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/herk.hpp"
+#include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/TiledOpts.hpp"
+#include "tlapack/lapack/potrf.hpp"
+
+namespace tlapack {
+
+/** Computes the Cholesky factorization of a Hermitian positive definite
+ * matrix A with a tiled algorithm.
+ *
+ * The factorization has the form
+ *      $A = U^H U,$ if uplo = Upper, or
+ *      $A = L L^H,$ if uplo = Lower,
+ * where U is an upper triangular matrix and L is lower triangular.
+ *
+ * A is split in tiles of size opts.nb. Every call to potrf(), trsm(), herk()
+ * and gemm() on a tile is a task of the TaskRuntime, which runs a task as
+ * soon as the tiles it reads are up to date. The routine returns when all
+ * tasks finished.
+ *
+ * Calls that share a runtime, e.g., the default one, run one at a time. This
+ * routine must not be called from a task that runs on the same runtime.
+ *
+ * @tparam uplo_t
+ *      Access type: Upper or Lower.
+ *      Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is referenced;
+ *      - Uplo::Lower: Lower triangle of A is referenced.
+ *
+ * @param[in,out] A
+ *      On entry, the Hermitian matrix A of size n-by-n.
+ *      On successful exit, the factor U or L from the Cholesky
+ *      factorization $A = U^H U$ or $A = L L^H.$
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: Tile size.
+ *      - @c opts.runtime: Runtime that executes the tasks.
+ *
+ * @return 0: successful exit.
+ * @return i, 0 < i <= n, if the leading minor of order i is not
+ *      positive definite, and the factorization could not be completed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t, TLAPACK_SMATRIX matrix_t>
+int potrf_tiled(uplo_t uplo, matrix_t& A, const TiledOpts& opts = {})
+{
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+    using Access = TaskRuntime::Access;
+
+    // Constants
+    const real_t one(1);
+    const idx_t n = nrows(A);
+    const idx_t nb = (idx_t)opts.nb;
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check(nrows(A) == ncols(A));
+    tlapack_check(nb > 0);
+
+    // Quick return
+    if (n <= 0) return 0;
+
+    internal::tiled_session session(opts);
+    TaskRuntime& rt = session.runtime();
+    const idx_t nt = internal::tiled_count(n, nb);
+
+    auto tile = [&](idx_t i, idx_t j) {
+        return slice(A, range(i * nb, min(i * nb + nb, n)),
+                     range(j * nb, min(j * nb + nb, n)));
+    };
+    auto key = [&](idx_t i, idx_t j) -> const void* {
+        return &A(i * nb, j * nb);
+    };
+
+    std::vector<int> info(nt, 0);
+
+    for (idx_t k = 0; k < nt; ++k) {
+        auto Akk = tile(k, k);
+        rt.submit(
+            [Akk, &info, uplo, k]() mutable {
+                info[k] = potrf(uplo, Akk);
+            },
+            {{key(k, k), Access::ReadWrite}});
+
+        if (uplo == Uplo::Lower) {
+            for (idx_t i = k + 1; i < nt; ++i) {
+                auto Aik = tile(i, k);
+                rt.submit(
+                    [Akk, Aik, one]() mutable {
+                        trsm(RIGHT_SIDE, LOWER_TRIANGLE, CONJ_TRANS,
+                             NON_UNIT_DIAG, one, Akk, Aik);
+                    },
+                    {{key(k, k), Access::Read},
+                     {key(i, k), Access::ReadWrite}});
+            }
+            for (idx_t j = k + 1; j < nt; ++j) {
+                auto Ajk = tile(j, k);
+                auto Ajj = tile(j, j);
+                rt.submit(
+                    [Ajk, Ajj, one]() mutable {
+                        herk(LOWER_TRIANGLE, NO_TRANS, -one, Ajk, one, Ajj);
+                    },
+                    {{key(j, k), Access::Read},
+                     {key(j, j), Access::ReadWrite}});
+                for (idx_t i = j + 1; i < nt; ++i) {
+                    auto Aik = tile(i, k);
+                    auto Aij = tile(i, j);
+                    rt.submit(
+                        [Aik, Ajk, Aij, one]() mutable {
+                            gemm(NO_TRANS, CONJ_TRANS, -one, Aik, Ajk, one,
+                                 Aij);
+                        },
+                        {{key(i, k), Access::Read},
+                         {key(j, k), Access::Read},
+                         {key(i, j), Access::ReadWrite}});
+                }
+            }
+        }
+        else {
+            for (idx_t j = k + 1; j < nt; ++j) {
+                auto Akj = tile(k, j);
+                rt.submit(
+                    [Akk, Akj, one]() mutable {
+                        trsm(LEFT_SIDE, UPPER_TRIANGLE, CONJ_TRANS,
+                             NON_UNIT_DIAG, one, Akk, Akj);
+                    },
+                    {{key(k, k), Access::Read},
+                     {key(k, j), Access::ReadWrite}});
+            }
+            for (idx_t j = k + 1; j < nt; ++j) {
+                auto Akj = tile(k, j);
+                auto Ajj = tile(j, j);
+                rt.submit(
+                    [Akj, Ajj, one]() mutable {
+                        herk(UPPER_TRIANGLE, CONJ_TRANS, -one, Akj, one, Ajj);
+                    },
+                    {{key(k, j), Access::Read},
+                     {key(j, j), Access::ReadWrite}});
+                for (idx_t i = k + 1; i < j; ++i) {
+                    auto Aki = tile(k, i);
+                    auto Aij = tile(i, j);
+                    rt.submit(
+                        [Aki, Akj, Aij, one]() mutable {
+                            gemm(CONJ_TRANS, NO_TRANS, -one, Aki, Akj, one,
+                                 Aij);
+                        },
+                        {{key(k, i), Access::Read},
+                         {key(k, j), Access::Read},
+                         {key(i, j), Access::ReadWrite}});
+                }
+            }
+        }
+    }
+
+    rt.wait();
+
+    for (idx_t k = 0; k < nt; ++k)
+        if (info[k] != 0) return k * nb + info[k];
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_POTRF_TILED_HH
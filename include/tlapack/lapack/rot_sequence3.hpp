@@ -12,9 +12,124 @@
 
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/rot.hpp"
+#include "tlapack/blas/simd_kernels.hpp"
 
 namespace tlapack {
 
+namespace internal {
+
+    /**
+     * rot_sequence3() for real matrices whose rotated lines are contiguous in
+     * memory, i.e., side = Side::Right with a column-major matrix or side =
+     * Side::Left with a row-major matrix.
+     *
+     * Line g, 0 <= g <= k, has len contiguous entries starting at A + g*ld,
+     * where k is the number of rows of C and S. The rotations are applied
+     * with the vectorized kernels simd_rot() and simd_rot4().
+     */
+    template <class T, class idx_t, class C_t, class S_t>
+    void rot_sequence3_contiguous(
+        Direction direction, const C_t& C, const S_t& S, T* A, idx_t ld, idx_t len)
+    {
+        // constants
+        const idx_t k = nrows(C);
+        const idx_t l = ncols(C);
+
+        // Blocking parameter
+        const idx_t nb = 256;
+
+        if (direction == Direction::Forward) {
+#pragma omp parallel for
+            for (idx_t ib = 0; ib < len; ib += nb) {
+                const idx_t nn = std::min(nb, len - ib);
+                T* A0 = A + ib;
+                // Startup phase
+                for (idx_t j = 0; j < l - 1; ++j) {
+                    for (idx_t i = 0, g2 = j; i < j + 1; ++i, --g2) {
+                        idx_t g = k - 1 - g2;
+                        simd_rot<T>(nn, A0 + g * ld, A0 + (g + 1) * ld,
+                                    C(g, i), S(g, i));
+                    }
+                }
+                // Pipeline phase
+                for (idx_t j = l - 1; j + 1 < k; j += 2) {
+                    for (idx_t i = 0, g2 = j; i + 1 < l; i += 2, g2 -= 2) {
+                        idx_t g = k - 1 - g2;
+                        const T c[4] = {C(g, i), C(g - 1, i), C(g + 1, i + 1),
+                                        C(g, i + 1)};
+                        const T s[4] = {S(g, i), S(g - 1, i), S(g + 1, i + 1),
+                                        S(g, i + 1)};
+                        simd_rot4<T>(nn, A0 + (g - 1) * ld, A0 + g * ld,
+                                     A0 + (g + 1) * ld, A0 + (g + 2) * ld, c,
+                                     s);
+                    }
+                    if (l % 2 == 1) {
+                        // Apply two more rotations that could not be fused
+                        idx_t i = l - 1;
+                        idx_t g2 = j - (l - 1);
+                        idx_t g = k - 1 - g2;
+                        simd_rot<T>(nn, A0 + g * ld, A0 + (g + 1) * ld,
+                                    C(g, i), S(g, i));
+                        simd_rot<T>(nn, A0 + (g - 1) * ld, A0 + g * ld,
+                                    C(g - 1, i), S(g - 1, i));
+                    }
+                }
+                // Shutdown phase
+                for (idx_t j = ((k + 2 - l) % 2); j < l; ++j) {
+                    for (idx_t i = j, g2 = k - 1; i < l; ++i, --g2) {
+                        idx_t g = k - 1 - g2;
+                        simd_rot<T>(nn, A0 + g * ld, A0 + (g + 1) * ld,
+                                    C(g, i), S(g, i));
+                    }
+                }
+            }
+        }
+        else {
+#pragma omp parallel for
+            for (idx_t ib = 0; ib < len; ib += nb) {
+                const idx_t nn = std::min(nb, len - ib);
+                T* A0 = A + ib;
+                // Startup phase
+                for (idx_t j = 0; j < l - 1; ++j) {
+                    for (idx_t i = 0, g = j; i < j + 1; ++i, --g) {
+                        simd_rot<T>(nn, A0 + g * ld, A0 + (g + 1) * ld,
+                                    C(g, i), S(g, i));
+                    }
+                }
+                // Pipeline phase
+                for (idx_t j = l - 1; j + 1 < k; j += 2) {
+                    for (idx_t i = 0, g = j; i + 1 < l; i += 2, g -= 2) {
+                        const T c[4] = {C(g, i), C(g - 1, i + 1), C(g + 1, i),
+                                        C(g, i + 1)};
+                        const T s[4] = {S(g, i), S(g - 1, i + 1), S(g + 1, i),
+                                        S(g, i + 1)};
+                        simd_rot4<T>(nn, A0 + (g - 1) * ld, A0 + g * ld,
+                                     A0 + (g + 1) * ld, A0 + (g + 2) * ld, c,
+                                     s);
+                    }
+                    if (l % 2 == 1) {
+                        // Apply two more rotations that could not be fused
+                        idx_t i = l - 1;
+                        idx_t g = j - (l - 1);
+                        simd_rot<T>(nn, A0 + g * ld, A0 + (g + 1) * ld,
+                                    C(g, i), S(g, i));
+                        simd_rot<T>(nn, A0 + (g + 1) * ld, A0 + (g + 2) * ld,
+                                    C(g + 1, i), S(g + 1, i));
+                    }
+                }
+                // Shutdown phase
+                for (idx_t j = ((k + 2 - l) % 2); j < l; ++j) {
+                    for (idx_t i = j, g = k - 1; i < l; ++i, --g) {
+                        simd_rot<T>(nn, A0 + g * ld, A0 + (g + 1) * ld,
+                                    C(g, i), S(g, i));
+                    }
+                }
+            }
+        }
+    }
+
+}  // namespace internal
+
 /** Applies a sequence of plane rotations to an (m-by-n) matrix
  *
  * When side = Side::Left, the transformation takes the form
@@ -124,6 +239,21 @@ void rot_sequence3(
         return;
     }
 
+    // Real float or double matrices whose rotated lines are contiguous use
+    // the vectorized kernels
+    if constexpr (traits::internal::is_simd_type<T> &&
+                  traits::internal::has_legacy_matrix<A_t>::value &&
+                  (layout<A_t> == Layout::ColMajor ||
+                   layout<A_t> == Layout::RowMajor)) {
+        if ((side == Side::Right && layout<A_t> == Layout::ColMajor) ||
+            (side == Side::Left && layout<A_t> == Layout::RowMajor)) {
+            auto A_ = legacy_matrix(A);
+            return internal::rot_sequence3_contiguous<T, idx_t>(
+                direction, C, S, A_.ptr, (idx_t)A_.ldim,
+                (side == Side::Left) ? n : m);
+        }
+    }
+
     // Apply rotations
     if constexpr (layout<A_t> == Layout::ColMajor) {
         if (side == Side::Left) {
@@ -133,7 +263,7 @@ void rot_sequence3(
                 for (idx_t ib = 0; ib < n; ib += nb) {
                     idx_t ib2 = std::min(ib + nb, n);
                     // Startup phase
-                    for (idx_t i1 = 0; i1 < n; ++i1) {
+                    for (idx_t i1 = ib; i1 < ib2; ++i1) {
                         for (idx_t j = 0; j < l - 1; ++j) {
                             for (idx_t i = 0, g2 = j; i < j + 1; ++i, --g2) {
                                 idx_t g = m - 2 - g2;
@@ -536,7 +666,7 @@ void rot_sequence3(
                     for (idx_t j = 0; j < l - 1; ++j) {
                         for (idx_t i = 0, g2 = j; i < j + 1; ++i, --g2) {
                             idx_t g = m - 2 - g2;
-                            for (idx_t i1 = 0; i1 < n; ++i1) {
+                            for (idx_t i1 = ib; i1 < ib2; ++i1) {
                                 T temp =
                                     C(g, i) * A(g, i1) + S(g, i) * A(g + 1, i1);
                                 A(g + 1, i1) = -conj(S(g, i)) * A(g, i1) +
@@ -0,0 +1,341 @@
+/// @file schur_reorder.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dtrsen.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_SCHUR_REORDER_HH
+#define TLAPACK_SCHUR_REORDER_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/schur_move.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for schur_reorder()
+ */
+struct SchurReorderOpts {
+    size_t nb_window = 64;  ///< Maximum size of the reordering windows
+    size_t nb_select = 32;  ///< Maximum number of eigenvalues moved together.
+                            ///< At most nb_window/2 are used.
+};
+
+namespace internal {
+
+    /** Applies the orthogonal factor Qw of the window A(i0:i1, i0:i1) to the
+     * rest of A and, if want_q is true, to Q. The updates are done with gemm()
+     * in blocks of nrows(W) rows or columns.
+     *
+     * @param[in] want_q bool
+     * @param[in,out] A n-by-n matrix.
+     * @param[in,out] Q n-by-n matrix.
+     * @param[in] i0 First row of the window.
+     * @param[in] i1 Last row of the window plus one.
+     * @param[in] Qw (i1-i0)-by-(i1-i0) orthogonal matrix.
+     * @param W Square workspace matrix with at least i1-i0 rows.
+     *
+     * @ingroup auxiliary
+     */
+    template <TLAPACK_SMATRIX matrix_t,
+              TLAPACK_SMATRIX matrixQw_t,
+              TLAPACK_SMATRIX matrixW_t>
+    void schur_reorder_apply_window(bool want_q,
+                                    matrix_t& A,
+                                    matrix_t& Q,
+                                    size_type<matrix_t> i0,
+                                    size_type<matrix_t> i1,
+                                    const matrixQw_t& Qw,
+                                    matrixW_t& W)
+    {
+        using T = type_t<matrix_t>;
+        using idx_t = size_type<matrix_t>;
+        using range = pair<idx_t, idx_t>;
+
+        const T one(1);
+        const idx_t n = ncols(A);
+        const idx_t nw = i1 - i0;
+        const idx_t w = nrows(W);
+
+        // Horizontal multiply
+        for (idx_t j = i1; j < n; j += w) {
+            const idx_t jb = min(w, n - j);
+            auto A_slice = slice(A, range(i0, i1), range(j, j + jb));
+            auto W_slice = slice(W, range(0, nw), range(0, jb));
+            gemm(CONJ_TRANS, NO_TRANS, one, Qw, A_slice, W_slice);
+            lacpy(GENERAL, W_slice, A_slice);
+        }
+        // Vertical multiply
+        for (idx_t i = 0; i < i0; i += w) {
+            const idx_t ib = min(w, i0 - i);
+            auto A_slice = slice(A, range(i, i + ib), range(i0, i1));
+            auto W_slice = slice(W, range(0, ib), range(0, nw));
+            gemm(NO_TRANS, NO_TRANS, one, A_slice, Qw, W_slice);
+            lacpy(GENERAL, W_slice, A_slice);
+        }
+        // Update Q (also a vertical multiplication)
+        if (want_q) {
+            for (idx_t i = 0; i < n; i += w) {
+                const idx_t ib = min(w, n - i);
+                auto Q_slice = slice(Q, range(i, i + ib), range(i0, i1));
+                auto W_slice = slice(W, range(0, ib), range(0, nw));
+                gemm(NO_TRANS, NO_TRANS, one, Q_slice, Qw, W_slice);
+                lacpy(GENERAL, W_slice, Q_slice);
+            }
+        }
+    }
+
+}  // namespace internal
+
+/** Workspace query of schur_reorder()
+ *
+ * @param[in] want_q bool
+ *      Whether or not to apply the transformations to Q
+ * @param[in] A n-by-n matrix.
+ * @param[in] Q n-by-n matrix.
+ * @param[in] select Vector of length n.
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T, TLAPACK_SMATRIX matrix_t, class select_t>
+constexpr WorkInfo schur_reorder_worksize(bool want_q,
+                                          const matrix_t& A,
+                                          const matrix_t& Q,
+                                          const select_t& select,
+                                          const SchurReorderOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+
+    const idx_t n = ncols(A);
+    const idx_t w = min(n, max<idx_t>(opts.nb_window, 4));
+
+    // Copy of the window, its orthogonal factor and a buffer for gemm
+    return WorkInfo(w, 3 * w);
+}
+
+/** @copybrief schur_reorder()
+ * Workspace is provided as an argument.
+ * @copydetails schur_reorder()
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t, class select_t, TLAPACK_WORKSPACE work_t>
+int schur_reorder_work(bool want_q,
+                       matrix_t& A,
+                       matrix_t& Q,
+                       const select_t& select,
+                       size_type<matrix_t>& m,
+                       work_t& work,
+                       const SchurReorderOpts& opts = {})
+{
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // Constants
+    const real_t zero(0);
+    const T one(1);
+    const idx_t n = ncols(A);
+    // Size of the windows
+    const idx_t w = min(n, max<idx_t>(opts.nb_window, 4));
+    // Maximum number of rows of the selected blocks moved together
+    const idx_t nbs = max<idx_t>(1, min<idx_t>(opts.nb_select, w / 2));
+
+    // check arguments
+    tlapack_check(nrows(A) == n);
+    if (want_q) {
+        tlapack_check(nrows(Q) == n);
+        tlapack_check(ncols(Q) == n);
+    }
+    tlapack_check((idx_t)size(select) >= n);
+
+    // Quick return
+    m = 0;
+    if (n == 0) return 0;
+
+    // Workspace. W holds the copy of the window and its orthogonal factor
+    auto [W, work2] = reshape(work, w, 2 * w);
+    auto Wb = reshape(work2, w, w).first;
+
+    // Size of the eigenvalue block of A that starts at row k
+    auto block_size = [&](idx_t k) -> idx_t {
+        if (is_real<T>)
+            if (k + 1 < n)
+                if (A(k + 1, k) != zero) return 2;
+        return 1;
+    };
+
+    // Rows 0:ks hold the selected eigenvalues that are already in place, and
+    // rows ks:k hold eigenvalues that are not selected
+    idx_t ks = 0;
+    idx_t k = 0;
+    while (k < n) {
+        // Look for the next selected block
+        {
+            const idx_t nbk = block_size(k);
+            if (!(select[k] || (nbk == 2 && select[k + 1]))) {
+                k = k + nbk;
+                continue;
+            }
+            if (k == ks) {
+                ks = ks + nbk;
+                k = k + nbk;
+                continue;
+            }
+        }
+
+        // Group the selected blocks in rows p1:i1 so that they fit in a
+        // window and at most nbs rows are moved together
+        const idx_t p1 = k;
+        idx_t cnt = 0;
+        idx_t i1 = k;
+        while (k < n) {
+            const idx_t nbk = block_size(k);
+            if (k + nbk - p1 > w) break;
+            if (select[k] || (nbk == 2 && select[k + 1])) {
+                if (cnt > 0 && cnt + nbk > nbs) break;
+                cnt = cnt + nbk;
+                i1 = k + nbk;
+            }
+            k = k + nbk;
+        }
+
+        // Move the group up to row ks. Each window ends at the last row of
+        // the group, and the group is moved to the top of the window.
+        bool first_window = true;
+        while (true) {
+            idx_t i0 = (i1 - ks > w) ? i1 - w : ks;
+            // Do not split a 2x2 block
+            if (is_real<T>)
+                if (i0 > ks)
+                    if (A(i0, i0 - 1) != zero) i0 = i0 + 1;
+            const idx_t nw = i1 - i0;
+
+            auto Aw = slice(W, range(0, nw), range(0, nw));
+            auto Qw = slice(W, range(0, nw), range(w, w + nw));
+            laset(GENERAL, zero, zero, Aw);
+            for (idx_t j = 0; j < nw; ++j)
+                for (idx_t i = 0; i < min(j + 2, nw); ++i)
+                    Aw(i, j) = A(i0 + i, i0 + j);
+            laset(GENERAL, zero, one, Qw);
+
+            // In the first window, the selected blocks are found using
+            // select. In the next ones, they are the last cnt rows.
+            int ierr = 0;
+            idx_t ilst = 0;
+            idx_t j = (first_window) ? p1 - i0 : nw - cnt;
+            while (j < nw) {
+                idx_t nbj = 1;
+                if (is_real<T>)
+                    if (j + 1 < nw)
+                        if (Aw(j + 1, j) != zero) nbj = 2;
+                if (!first_window || select[i0 + j] ||
+                    (nbj == 2 && select[i0 + j + 1])) {
+                    idx_t ifst = j;
+                    ierr = schur_move(true, Aw, Qw, ifst, ilst);
+                    if (ierr) break;
+                    ilst = ilst + nbj;
+                }
+                j = j + nbj;
+            }
+
+            // Copy the window back into place and update the rest
+            for (idx_t j = 0; j < nw; ++j)
+                for (idx_t i = 0; i < min(j + 2, nw); ++i)
+                    A(i0 + i, i0 + j) = Aw(i, j);
+            internal::schur_reorder_apply_window(want_q, A, Q, i0, i1, Qw, Wb);
+
+            if (ierr) {
+                // Two blocks were too close to swap
+                m = (i0 == ks) ? ks + ilst : ks;
+                return 1;
+            }
+
+            if (i0 == ks) break;
+            i1 = i0 + cnt;
+            first_window = false;
+        }
+        ks = ks + cnt;
+    }
+
+    m = ks;
+    return 0;
+}
+
+/** schur_reorder reorders the Schur factorization of a matrix
+ *  S = Q*A*Q**H, so that a selected cluster of eigenvalues appears in the
+ *  leading diagonal blocks of the Schur form.
+ *
+ *  Instead of applying every swap of schur_move() to the full rows and
+ *  columns of A and Q, the eigenvalues are moved inside windows of size
+ *  opts.nb_window. The orthogonal transformations of a window are
+ *  accumulated in a small matrix and applied to the rest of A and to Q with
+ *  gemm(). Up to opts.nb_select eigenvalues are moved together. A window
+ *  slides up from the bottom until the group of eigenvalues reaches its
+ *  final position, as in
+ *
+ *  D. Kressner, Block algorithms for reordering standard and generalized
+ *  Schur forms, ACM Trans. Math. Softw. 32(4), 2006.
+ *
+ * @return  0 if success
+ * @return  1 two adjacent blocks were too close to swap (the problem
+ *            is very ill-conditioned); A may have been partially
+ *            reordered, and m is the number of selected eigenvalues
+ *            that were moved to the leading rows.
+ *
+ * @param[in]     want_q bool
+ *                Whether or not to apply the transformations to Q
+ * @param[in,out] A n-by-n matrix.
+ *                Must be in Schur form
+ * @param[in,out] Q n-by-n matrix.
+ *                Orthogonal matrix, not referenced if want_q is false
+ * @param[in]     select Vector of length n.
+ *                The eigenvalue in row j is selected if select[j] is true.
+ *                In the real case, a 2x2 block in rows j and j+1 is
+ *                selected if select[j] or select[j+1] is true.
+ *                The relative order of the selected eigenvalues is kept.
+ * @param[out]    m integer.
+ *                Number of rows of the selected eigenvalues, i.e., the
+ *                dimension of the invariant subspace spanned by the first m
+ *                columns of Q.
+ * @param[in]     opts Options.
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_SMATRIX matrix_t, class select_t>
+int schur_reorder(bool want_q,
+                  matrix_t& A,
+                  matrix_t& Q,
+                  const select_t& select,
+                  size_type<matrix_t>& m,
+                  const SchurReorderOpts& opts = {})
+{
+    using T = type_t<matrix_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // Gets workspace from the arena
+    WorkInfo workinfo = schur_reorder_worksize<T>(want_q, A, Q, select, opts);
+    auto work_ = workspace_arena<T>().get(workinfo);
+    auto work = new_matrix(work_.vector(), workinfo.m, workinfo.n);
+
+    return schur_reorder_work(want_q, A, Q, select, m, work, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_SCHUR_REORDER_HH
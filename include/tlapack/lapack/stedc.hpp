@@ -0,0 +1,187 @@
+/// @file stedc.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zstedc.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_STEDC_HH
+#define TLAPACK_STEDC_HH
+
+#include "tlapack/base/constants.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/swap.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/laed0.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/steqr.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for stedc
+ */
+struct StedcOpts {
+    size_t smlsiz = 25;  ///< Maximum size of the subproblems at the bottom of
+                         ///< the recursion. These are solved by steqr()
+};
+
+/**
+ * STEDC computes all eigenvalues and, optionally, eigenvectors of a
+ * real symmetric tridiagonal matrix using the divide and conquer method.
+ *
+ * The eigenvectors of a full Hermitian matrix can also be found by STEDC if
+ * this matrix has previously been reduced matrix to real symmetric
+ * tridiagonal form, by HETRD for example.
+ *
+ * The eigenvectors of the tridiagonal matrix are computed in a real
+ * workspace and then applied to Z with a matrix-matrix multiplication. If
+ * only eigenvalues are requested, or if the matrix has size at most
+ * opts.smlsiz, the QR iteration from steqr() is used instead.
+ *
+ * @return 0, successful exit.
+ * @return i > 0, the algorithm failed to compute an eigenvalue while working
+ *            on the unreduced submatrix that starts at row i-1.
+ *
+ * @param[in] want_z bool
+ *            = 'false': Compute eigenvalues only.
+ *            = 'true': Compute eigenvalues and eigenvectors of the original
+ *              symmetric matrix. On entry, Z must contain the orthogonal
+ *              matrix used to reduce the original matrix to tridiagonal form
+ *              or initialized to the identity matrix.
+ *
+ * @param[in,out] d real vector of length n.
+ *      On entry, the diagonal elements of the real symmetric
+ *      tridiagonal matrix.
+ *      On exit, if return = 0, the eigenvalues in ascending order.
+ *
+ * @param[in,out] e real vector of length n-1.
+ *      On entry, the off-diagonal elements of the real symmetric
+ *      tridiagonal matrix.
+ *      On exit, "e" has been destroyed.
+ *
+ * @param[in,out] Z real or complex n-by-n matrix
+ *      if want_z = 'false', then Z is not referenced.
+ *      if want_z = 'true', on entry, either the n-by-n unitary matrix used in
+ *      the reduction to tridiagonal form or initialized to the identity matrix.
+ *      On exit, if return = 0, then Z contains the orthonormal eigenvectors of
+ *      the original Hermitian matrix or of the real symmetric tridiagonal
+ *      matrix.
+ *
+ * @param[in] opts Options.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          class d_t,
+          class e_t,
+          enable_if_t<is_same_v<type_t<d_t>, real_type<type_t<d_t>>>, int> = 0,
+          enable_if_t<is_same_v<type_t<e_t>, real_type<type_t<e_t>>>, int> = 0>
+int stedc(bool want_z, d_t& d, e_t& e, matrix_t& Z, const StedcOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+    using r_matrix_t = real_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functors
+    Create<matrix_t> new_matrix;
+    Create<r_matrix_t> new_real_matrix;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const idx_t n = size(d);
+    const idx_t smlsiz = max<idx_t>(opts.smlsiz, 1);
+
+    // check arguments
+    tlapack_check_false(n > 0 && (idx_t)size(e) < n - 1);
+    if (want_z) tlapack_check_false(nrows(Z) != n || ncols(Z) != n);
+
+    // Quick return if possible
+    if (n <= 1) return 0;
+
+    // Use the QR iteration if only eigenvalues are requested or the matrix is
+    // small
+    if (!want_z || n <= smlsiz) return steqr(want_z, d, e, Z);
+
+    // Eigenvectors of the tridiagonal matrix
+    auto Q_ = workspace_arena<real_t>().get(WorkInfo(n, n));
+    auto Q = new_real_matrix(Q_.vector(), n, n);
+    laset(GENERAL, zero, one, Q);
+
+    // Solve each unreduced submatrix
+    const real_t eps = uroundoff<real_t>();
+    for (idx_t start = 0; start < n;) {
+        // Look for small off-diagonal elements
+        idx_t end = start;
+        while (end + 1 < n) {
+            const real_t tiny =
+                eps * sqrt(abs(d[end])) * sqrt(abs(d[end + 1]));
+            if (abs(e[end]) <= tiny) {
+                e[end] = zero;
+                break;
+            }
+            ++end;
+        }
+
+        // Rows and columns start to end form an unreduced submatrix
+        const idx_t m = end - start + 1;
+        if (m > 1) {
+            auto d1 = slice(d, range{start, end + 1});
+            auto e1 = slice(e, range{start, end});
+            auto Q1 = slice(Q, range{start, end + 1}, range{start, end + 1});
+
+            // Scale the submatrix to have maximum absolute entry equal to 1
+            real_t orgnrm = zero;
+            for (idx_t i = 0; i < m; ++i)
+                orgnrm = max(orgnrm, abs(d1[i]));
+            for (idx_t i = 0; i + 1 < m; ++i)
+                orgnrm = max(orgnrm, abs(e1[i]));
+            for (idx_t i = 0; i < m; ++i)
+                d1[i] /= orgnrm;
+            for (idx_t i = 0; i + 1 < m; ++i)
+                e1[i] /= orgnrm;
+
+            const int info = (m <= smlsiz) ? steqr(true, d1, e1, Q1)
+                                           : laed0(d1, e1, Q1, smlsiz);
+            if (info != 0) return start + 1;
+
+            // Scale back
+            for (idx_t i = 0; i < m; ++i)
+                d1[i] *= orgnrm;
+        }
+
+        start = end + 1;
+    }
+
+    // Use selection sort to minimize swaps of eigenvectors
+    for (idx_t i = 0; i + 1 < n; ++i) {
+        idx_t k = i;
+        for (idx_t j = i + 1; j < n; ++j)
+            if (d[j] < d[k]) k = j;
+        if (k != i) {
+            std::swap(d[i], d[k]);
+            auto qi = col(Q, i);
+            auto qk = col(Q, k);
+            tlapack::swap(qi, qk);
+        }
+    }
+
+    // Z = Z * Q
+    auto W_ = workspace_arena<T>().get(WorkInfo(n, n));
+    auto W = new_matrix(W_.vector(), n, n);
+    gemm(NO_TRANS, NO_TRANS, one, Z, Q, W);
+    lacpy(GENERAL, W, Z);
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_STEDC_HH
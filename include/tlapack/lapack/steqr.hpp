@@ -177,7 +177,8 @@ int steqr(bool want_z, d_t& d, e_t& e, matrix_t& Z)
             real_t p = d[istop - 1];
             real_t g = (d[istop - 2] - p) / (two * e[istop - 2]);
             real_t r = lapy2(g, one);
-            g = d[istart] - p + e[istop - 2] / (real_t)(g + (sgn(g) * r));
+            if (g < zero) r = -r;
+            g = d[istart] - p + e[istop - 2] / (real_t)(g + r);
 
             real_t s = one;
             real_t c = one;
@@ -211,7 +212,8 @@ int steqr(bool want_z, d_t& d, e_t& e, matrix_t& Z)
             real_t p = d[istart];
             real_t g = (d[istart + 1] - p) / (two * e[istart]);
             real_t r = lapy2(g, one);
-            g = d[istop - 1] - p + e[istart] / (real_t)(g + (sgn(g) * r));
+            if (g < zero) r = -r;
+            g = d[istop - 1] - p + e[istart] / (real_t)(g + r);
 
             real_t s = one;
             real_t c = one;
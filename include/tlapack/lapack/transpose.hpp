@@ -1,4 +1,4 @@
-/// @file transpose.hpp Out of place transpose
+/// @file transpose.hpp Out of place and in place transpose
 /// @author Thijs Steel, KU Leuven, Belgium
 //
 // Copyright (c) 2025, University of Colorado Denver. All rights reserved.
@@ -11,6 +11,7 @@
 #define TLAPACK_TRANSPOSE_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/simd_kernels.hpp"
 
 namespace tlapack {
 struct TransposeOpts {
@@ -19,6 +20,179 @@ struct TransposeOpts {
     size_t nx = 16;
 };
 
+namespace internal {
+
+    /// Size of the leading block when a dimension n > nx is split in the
+    /// recursion: n/2 rounded up to a multiple of nx, so that the leaves are
+    /// made of full nx-by-nx tiles whenever possible.
+    template <class idx_t>
+    constexpr idx_t transpose_split(idx_t n, idx_t nx)
+    {
+        return (n / 2 + nx - 1) / nx * nx;
+    }
+
+    /// Conjugates the entries of A.
+    template <class matrix_t>
+    void transpose_conj(matrix_t& A)
+    {
+        using idx_t = size_type<matrix_t>;
+        if constexpr (is_complex<type_t<matrix_t>>) {
+            for (idx_t j = 0; j < ncols(A); ++j)
+                for (idx_t i = 0; i < nrows(A); ++i)
+                    A(i, j) = conj(A(i, j));
+        }
+    }
+
+    /**
+     * Leaf of the recursion in transpose() and conjtranspose(): B := A^T, or
+     * B := A^H if conjA is true.
+     *
+     * Contiguous matrices of float, double, std::complex<float> or
+     * std::complex<double> with the same layout are transposed in tiles
+     * held in vector registers, see simd_transpose().
+     */
+    template <class matrixA_t, class matrixB_t>
+    void transpose_leaf(const matrixA_t& A, matrixB_t& B, bool conjA)
+    {
+        using T = type_t<matrixB_t>;
+        using idx_t = size_type<matrixA_t>;
+
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+
+        if constexpr (traits::internal::is_simd_transpose_pair<matrixA_t,
+                                                               matrixB_t, T>) {
+            auto A_ = legacy_matrix(A);
+            auto B_ = legacy_matrix(B);
+            // A row-major matrix is the transpose of a column-major one
+            if (A_.layout == Layout::ColMajor)
+                simd_transpose<T>(m, n, A_.ptr, A_.ldim, B_.ptr, B_.ldim);
+            else
+                simd_transpose<T>(n, m, A_.ptr, A_.ldim, B_.ptr, B_.ldim);
+            if (conjA) transpose_conj(B);
+        }
+        else {
+            if (conjA) {
+                for (idx_t i = 0; i < m; ++i)
+                    for (idx_t j = 0; j < n; ++j)
+                        B(j, i) = conj(A(i, j));
+            }
+            else {
+                for (idx_t i = 0; i < m; ++i)
+                    for (idx_t j = 0; j < n; ++j)
+                        B(j, i) = A(i, j);
+            }
+        }
+    }
+
+    /**
+     * Swaps the m-by-n matrix A with $B^T$, or with $B^H$ if conjA is true,
+     * where B is n-by-m. A and B must not overlap.
+     */
+    template <class matrixA_t, class matrixB_t>
+    void transpose_swap(matrixA_t& A,
+                        matrixB_t& B,
+                        bool conjA,
+                        const TransposeOpts& opts)
+    {
+        using T = type_t<matrixB_t>;
+        using idx_t = size_type<matrixA_t>;
+        using range = pair<idx_t, idx_t>;
+
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+
+        if (min(m, n) <= (idx_t)opts.nx) {
+            if constexpr (traits::internal::is_simd_transpose_pair<
+                              matrixA_t, matrixB_t, T>) {
+                auto A_ = legacy_matrix(A);
+                auto B_ = legacy_matrix(B);
+                if (A_.layout == Layout::ColMajor)
+                    simd_transpose_swap<T>(m, n, A_.ptr, A_.ldim, B_.ptr,
+                                           B_.ldim);
+                else
+                    simd_transpose_swap<T>(n, m, A_.ptr, A_.ldim, B_.ptr,
+                                           B_.ldim);
+                if (conjA) {
+                    transpose_conj(A);
+                    transpose_conj(B);
+                }
+            }
+            else {
+                for (idx_t i = 0; i < m; ++i)
+                    for (idx_t j = 0; j < n; ++j) {
+                        const T aij = A(i, j);
+                        A(i, j) = conjA ? conj(B(j, i)) : B(j, i);
+                        B(j, i) = conjA ? conj(aij) : aij;
+                    }
+            }
+        }
+        else {
+            const idx_t m1 = transpose_split(m, (idx_t)opts.nx);
+            const idx_t n1 = transpose_split(n, (idx_t)opts.nx);
+
+            auto A00 = slice(A, range(0, m1), range(0, n1));
+            auto A01 = slice(A, range(0, m1), range(n1, n));
+            auto A10 = slice(A, range(m1, m), range(0, n1));
+            auto A11 = slice(A, range(m1, m), range(n1, n));
+
+            auto B00 = slice(B, range(0, n1), range(0, m1));
+            auto B01 = slice(B, range(0, n1), range(m1, m));
+            auto B10 = slice(B, range(n1, n), range(0, m1));
+            auto B11 = slice(B, range(n1, n), range(m1, m));
+
+            transpose_swap(A00, B00, conjA, opts);
+            transpose_swap(A01, B10, conjA, opts);
+            transpose_swap(A10, B01, conjA, opts);
+            transpose_swap(A11, B11, conjA, opts);
+        }
+    }
+
+    /// Transposes, or conjugate transposes if conjA is true, the square
+    /// matrix A in place.
+    template <class matrix_t>
+    void transpose_inplace(matrix_t& A, bool conjA, const TransposeOpts& opts)
+    {
+        using T = type_t<matrix_t>;
+        using idx_t = size_type<matrix_t>;
+        using range = pair<idx_t, idx_t>;
+
+        const idx_t n = nrows(A);
+
+        if (n <= (idx_t)opts.nx) {
+            if constexpr (traits::internal::is_simd_transpose_pair<
+                              matrix_t, matrix_t, T>) {
+                auto A_ = legacy_matrix(A);
+                simd_transpose_inplace<T>(n, A_.ptr, A_.ldim);
+                if (conjA) transpose_conj(A);
+            }
+            else {
+                for (idx_t j = 0; j < n; ++j) {
+                    for (idx_t i = j + 1; i < n; ++i) {
+                        const T aij = A(i, j);
+                        A(i, j) = conjA ? conj(A(j, i)) : A(j, i);
+                        A(j, i) = conjA ? conj(aij) : aij;
+                    }
+                    if (conjA) A(j, j) = conj(A(j, j));
+                }
+            }
+        }
+        else {
+            const idx_t n1 = transpose_split(n, (idx_t)opts.nx);
+
+            auto A00 = slice(A, range(0, n1), range(0, n1));
+            auto A01 = slice(A, range(0, n1), range(n1, n));
+            auto A10 = slice(A, range(n1, n), range(0, n1));
+            auto A11 = slice(A, range(n1, n), range(n1, n));
+
+            transpose_inplace(A00, conjA, opts);
+            transpose_inplace(A11, conjA, opts);
+            transpose_swap(A01, A10, conjA, opts);
+        }
+    }
+
+}  // namespace internal
+
 /**
  *
  * @brief conjugate transpose a matrix A into a matrix B.
@@ -48,14 +222,12 @@ void conjtranspose(matrixA_t& A, matrixB_t& B, const TransposeOpts& opts = {})
 
     if (min(m, n) <= (idx_t)opts.nx) {
         // The matrix is small, use direct method and end recursion
-        for (idx_t i = 0; i < m; ++i)
-            for (idx_t j = 0; j < n; ++j)
-                B(j, i) = conj(A(i, j));
+        internal::transpose_leaf(A, B, true);
     }
     else {
         // The matrix is large, split into subblocks and use recursion
-        const idx_t m1 = m / 2;
-        const idx_t n1 = n / 2;
+        const idx_t m1 = internal::transpose_split(m, (idx_t)opts.nx);
+        const idx_t n1 = internal::transpose_split(n, (idx_t)opts.nx);
 
         auto A00 = slice(A, range(0, m1), range(0, n1));
         auto A01 = slice(A, range(0, m1), range(n1, n));
@@ -103,14 +275,12 @@ void transpose(matrixA_t& A, matrixB_t& B, const TransposeOpts& opts = {})
 
     if (min(m, n) <= (idx_t)opts.nx) {
         // The matrix is small, use direct method and end recursion
-        for (idx_t i = 0; i < m; ++i)
-            for (idx_t j = 0; j < n; ++j)
-                B(j, i) = A(i, j);
+        internal::transpose_leaf(A, B, false);
     }
     else {
         // The matrix is large, split into subblocks and use recursion
-        const idx_t m1 = m / 2;
-        const idx_t n1 = n / 2;
+        const idx_t m1 = internal::transpose_split(m, (idx_t)opts.nx);
+        const idx_t n1 = internal::transpose_split(n, (idx_t)opts.nx);
 
         auto A00 = slice(A, range(0, m1), range(0, n1));
         auto A01 = slice(A, range(0, m1), range(n1, n));
@@ -129,6 +299,52 @@ void transpose(matrixA_t& A, matrixB_t& B, const TransposeOpts& opts = {})
     }
 }
 
+/**
+ *
+ * @brief conjugate transpose a square matrix A in place.
+ *
+ * The off-diagonal blocks are swapped recursively, as in conjtranspose(A, B),
+ * so that no workspace is needed.
+ *
+ * @param[in,out] A n-by-n matrix
+ *      On exit, A = A**H
+ *
+ * @param[in] opts Options.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_SMATRIX matrix_t>
+void conjtranspose_inplace(matrix_t& A, const TransposeOpts& opts = {})
+{
+    tlapack_check(nrows(A) == ncols(A));
+    tlapack_check(opts.nx >= 2);
+
+    internal::transpose_inplace(A, true, opts);
+}
+
+/**
+ *
+ * @brief transpose a square matrix A in place.
+ *
+ * The off-diagonal blocks are swapped recursively, as in transpose(A, B), so
+ * that no workspace is needed.
+ *
+ * @param[in,out] A n-by-n matrix
+ *      On exit, A = A**T
+ *
+ * @param[in] opts Options.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_SMATRIX matrix_t>
+void transpose_inplace(matrix_t& A, const TransposeOpts& opts = {})
+{
+    tlapack_check(nrows(A) == ncols(A));
+    tlapack_check(opts.nx >= 2);
+
+    internal::transpose_inplace(A, false, opts);
+}
+
 }  // namespace tlapack
 
 #endif  // TLAPACK_TRANSPOSE_HH
@@ -0,0 +1,608 @@
+/// @file trevc3.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dtrevc3.f
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/ztrevc3.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TREVC3_HH
+#define TLAPACK_TREVC3_HH
+
+#include "tlapack/base/constants.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for trevc3
+ */
+struct Trevc3Opts {
+    size_t nb = 32;  ///< Number of eigenvectors that are back-transformed
+                     ///< together with one matrix-matrix multiplication
+};
+
+namespace internal {
+
+    /**
+     * Solves the 2-by-2 system [a11 a12; a21 a22] x = b by Gaussian
+     * elimination with partial pivoting. On entry, [x1; x2] holds b and on
+     * exit, the solution x. Pivots smaller than smin are replaced by smin.
+     */
+    template <class S, TLAPACK_REAL real_t>
+    void trevc3_solve22(
+        S a11, S a12, S a21, S a22, S& x1, S& x2, const real_t& smin)
+    {
+        if (abs1(a11) >= abs1(a21)) {
+            if (abs1(a11) < smin) a11 = S(smin);
+            const S l = a21 / a11;
+            S u22 = a22 - l * a12;
+            if (abs1(u22) < smin) u22 = S(smin);
+            x2 = (x2 - l * x1) / u22;
+            x1 = (x1 - a12 * x2) / a11;
+        }
+        else {
+            const S l = a11 / a21;
+            S u22 = a12 - l * a22;
+            if (abs1(u22) < smin) u22 = S(smin);
+            const S y2 = (x1 - l * x2) / u22;
+            x1 = (x2 - a22 * y2) / a21;
+            x2 = y2;
+        }
+    }
+
+    /**
+     * Solves (T(0:k,0:k) - lambda I) x(0:k) = b by back substitution, where
+     * T is upper quasi-triangular and b is stored in x(0:k) on entry. The
+     * entries of x are accessed through get(i) and set(i, value), and
+     * rescale(s) multiplies the whole vector x by s to avoid overflow.
+     */
+    template <class S,
+              TLAPACK_MATRIX matrix_t,
+              TLAPACK_REAL real_t,
+              class get_t,
+              class set_t,
+              class rescale_t>
+    void trevc3_backsolve(const matrix_t& T,
+                          size_type<matrix_t> k,
+                          const S& lambda,
+                          const real_t& smin,
+                          const real_t& bignum,
+                          get_t&& get,
+                          set_t&& set,
+                          rescale_t&& rescale)
+    {
+        using idx_t = size_type<matrix_t>;
+
+        const real_t one(1);
+        constexpr bool is_real = !is_complex<type_t<matrix_t>>;
+
+        for (idx_t j = k; j-- > 0;) {
+            if (is_real && j > 0 && T(j, j - 1) != real_t(0)) {
+                // 2-by-2 diagonal block
+                S x1 = get(j - 1);
+                S x2 = get(j);
+                trevc3_solve22<S>(T(j - 1, j - 1) - lambda, T(j - 1, j),
+                                  T(j, j - 1), T(j, j) - lambda, x1, x2, smin);
+
+                const real_t xmax = max(abs1(x1), abs1(x2));
+                if (xmax > bignum) {
+                    rescale(one / xmax);
+                    x1 /= xmax;
+                    x2 /= xmax;
+                }
+                set(j - 1, x1);
+                set(j, x2);
+
+                for (idx_t i = 0; i + 1 < j; ++i)
+                    set(i, get(i) - T(i, j - 1) * x1 - T(i, j) * x2);
+                --j;
+            }
+            else {
+                // 1-by-1 diagonal block
+                S d = T(j, j) - lambda;
+                if (abs1(d) < smin) d = S(smin);
+                S xj = get(j) / d;
+
+                const real_t xmax = abs1(xj);
+                if (xmax > bignum) {
+                    rescale(one / xmax);
+                    xj /= xmax;
+                }
+                set(j, xj);
+
+                for (idx_t i = 0; i < j; ++i)
+                    set(i, get(i) - T(i, j) * xj);
+            }
+        }
+    }
+
+    /**
+     * Solves (T^H - mu I) x = 0 for x(k0:n) by forward substitution, where T
+     * is upper quasi-triangular and x(k:k0) is given. The entries x(k0:n) are
+     * overwritten. The other arguments are as in trevc3_backsolve().
+     */
+    template <class S,
+              TLAPACK_MATRIX matrix_t,
+              TLAPACK_REAL real_t,
+              class get_t,
+              class set_t,
+              class rescale_t>
+    void trevc3_forwardsolve(const matrix_t& T,
+                             size_type<matrix_t> k,
+                             size_type<matrix_t> k0,
+                             const S& mu,
+                             const real_t& smin,
+                             const real_t& bignum,
+                             get_t&& get,
+                             set_t&& set,
+                             rescale_t&& rescale)
+    {
+        using idx_t = size_type<matrix_t>;
+
+        const real_t one(1);
+        const idx_t n = ncols(T);
+        constexpr bool is_real = !is_complex<type_t<matrix_t>>;
+
+        for (idx_t j = k0; j < n;) {
+            if (is_real && j + 1 < n && T(j + 1, j) != real_t(0)) {
+                // 2-by-2 diagonal block
+                S x1(0), x2(0);
+                for (idx_t i = k; i < j; ++i) {
+                    const S xi = get(i);
+                    x1 -= conj(T(i, j)) * xi;
+                    x2 -= conj(T(i, j + 1)) * xi;
+                }
+                trevc3_solve22<S>(conj(T(j, j)) - mu, conj(T(j + 1, j)),
+                                  conj(T(j, j + 1)), conj(T(j + 1, j + 1)) - mu,
+                                  x1, x2, smin);
+
+                const real_t xmax = max(abs1(x1), abs1(x2));
+                if (xmax > bignum) {
+                    rescale(one / xmax);
+                    x1 /= xmax;
+                    x2 /= xmax;
+                }
+                set(j, x1);
+                set(j + 1, x2);
+                j += 2;
+            }
+            else {
+                // 1-by-1 diagonal block
+                S xj(0);
+                for (idx_t i = k; i < j; ++i)
+                    xj -= conj(T(i, j)) * get(i);
+
+                S d = conj(T(j, j)) - mu;
+                if (abs1(d) < smin) d = S(smin);
+                xj /= d;
+
+                const real_t xmax = abs1(xj);
+                if (xmax > bignum) {
+                    rescale(one / xmax);
+                    xj /= xmax;
+                }
+                set(j, xj);
+                j += 1;
+            }
+        }
+    }
+
+    /**
+     * Scales the eigenvectors in the columns of W so that the component of
+     * largest magnitude has |Re| + |Im| = 1. ki is the index of the eigenvalue
+     * associated to the first column of W.
+     */
+    template <TLAPACK_MATRIX matrixT_t, TLAPACK_MATRIX matrixW_t>
+    void trevc3_normalize(const matrixT_t& T,
+                          size_type<matrixT_t> ki,
+                          matrixW_t& W)
+    {
+        using idx_t = size_type<matrixW_t>;
+        using TA = type_t<matrixW_t>;
+        using real_t = real_type<TA>;
+
+        const real_t zero(0);
+        const real_t one(1);
+        const idx_t n = nrows(W);
+        const idx_t m = ncols(W);
+        const idx_t nT = ncols(T);
+
+        for (idx_t j = 0; j < m; ++j) {
+            const bool pair = !is_complex<TA> && (ki + j + 1 < nT) &&
+                              (T(ki + j + 1, ki + j) != zero);
+            real_t emax = zero;
+            if (pair) {
+                for (idx_t i = 0; i < n; ++i)
+                    emax = max(emax, abs(W(i, j)) + abs(W(i, j + 1)));
+            }
+            else {
+                for (idx_t i = 0; i < n; ++i)
+                    emax = max(emax, abs1(W(i, j)));
+            }
+
+            if (emax > zero) {
+                const real_t remax = one / emax;
+                for (idx_t i = 0; i < n; ++i)
+                    W(i, j) *= remax;
+                if (pair)
+                    for (idx_t i = 0; i < n; ++i)
+                        W(i, j + 1) *= remax;
+            }
+            if (pair) ++j;
+        }
+    }
+
+}  // namespace internal
+
+/** Worspace query of trevc3()
+ *
+ * @param[in] want_vl bool
+ * @param[in] want_vr bool
+ * @param[in] T_ n-by-n matrix in Schur form.
+ * @param[in] VL n-by-n matrix.
+ * @param[in] VR n-by-n matrix.
+ *
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T, TLAPACK_SMATRIX matrixT_t, TLAPACK_SMATRIX matrix_t>
+constexpr WorkInfo trevc3_worksize(bool want_vl,
+                                   bool want_vr,
+                                   const matrixT_t& T_,
+                                   const matrix_t& VL,
+                                   const matrix_t& VR,
+                                   const Trevc3Opts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+
+    const idx_t n = ncols(T_);
+    const idx_t nb = max<idx_t>(opts.nb, 2);
+
+    WorkInfo workinfo;
+    if constexpr (is_same_v<T, type_t<matrix_t>>) {
+        if (n > 0 && (want_vl || want_vr)) workinfo = WorkInfo(n, 2 * nb);
+    }
+
+    return workinfo;
+}
+
+/** @copybrief trevc3()
+ * Workspace is provided as an argument.
+ * @copydetails trevc3()
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrixT_t,
+          TLAPACK_SMATRIX matrix_t,
+          TLAPACK_WORKSPACE work_t>
+int trevc3_work(bool want_vl,
+                bool want_vr,
+                const matrixT_t& T,
+                matrix_t& VL,
+                matrix_t& VR,
+                work_t& work,
+                const Trevc3Opts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using TA = type_t<matrix_t>;
+    using real_t = real_type<TA>;
+    using complex_t = complex_type<real_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const idx_t n = ncols(T);
+    const idx_t nb = max<idx_t>(opts.nb, 2);
+    const real_t eps = ulp<real_t>();
+    const real_t smlnum = safe_min<real_t>() * (real_t(n) / eps);
+    const real_t bignum = one / smlnum;
+
+    // check arguments
+    tlapack_check(nrows(T) == n);
+    if (want_vl) tlapack_check(nrows(VL) == n && ncols(VL) == n);
+    if (want_vr) tlapack_check(nrows(VR) == n && ncols(VR) == n);
+
+    // quick return
+    if (n == 0 || (!want_vl && !want_vr)) return 0;
+
+    // X stores the eigenvectors of T and W their back-transformed values
+    auto [X, work2] = reshape(work, n, nb);
+    auto [W, work3] = reshape(work2, n, nb);
+
+    // Returns true if ki is the first index of a 2-by-2 diagonal block
+    auto is_pair = [&](idx_t ki) {
+        if constexpr (is_complex<TA>)
+            return false;
+        else
+            return (ki + 1 < n) && (T(ki + 1, ki) != zero);
+    };
+
+    if (want_vr) {
+        // Compute the right eigenvectors from the last to the first. Columns
+        // iv:nb of X hold the eigenvectors of the indices ki_lo:ki_hi
+        idx_t iv = nb;
+        idx_t ki_hi = n;
+
+        // Back-transform the eigenvectors in X and store them in VR
+        auto flush = [&](idx_t ki_lo) {
+            const idx_t m = ki_hi - ki_lo;
+            auto Q = slice(VR, range{0, n}, range{0, ki_hi});
+            auto Xb = slice(X, range{0, ki_hi}, range{iv, nb});
+            auto Wb = slice(W, range{0, n}, range{0, m});
+            gemm(NO_TRANS, NO_TRANS, one, Q, Xb, Wb);
+            internal::trevc3_normalize(T, ki_lo, Wb);
+
+            auto VRb = slice(VR, range{0, n}, range{ki_lo, ki_hi});
+            lacpy(GENERAL, Wb, VRb);
+            iv = nb;
+            ki_hi = ki_lo;
+        };
+
+        for (idx_t ki = n; ki-- > 0;) {
+            const bool pair = (ki > 0) && is_pair(ki - 1);
+            const idx_t ki0 = pair ? ki - 1 : ki;
+
+            if (iv < ki - ki0 + 1) flush(ki + 1);
+
+            if (!pair) {
+                // Real eigenvalue or complex matrix
+                const TA lambda = T(ki, ki);
+                const real_t smin = max(eps * abs1(lambda), smlnum);
+
+                auto x = col(X, iv - 1);
+                for (idx_t i = 0; i < ki; ++i)
+                    x[i] = -T(i, ki);
+                x[ki] = one;
+                for (idx_t i = ki + 1; i < n; ++i)
+                    x[i] = zero;
+
+                internal::trevc3_backsolve<TA>(
+                    T, ki, lambda, smin, bignum,
+                    [&](idx_t i) { return x[i]; },
+                    [&](idx_t i, const TA& v) { x[i] = v; },
+                    [&](real_t s) {
+                        for (idx_t i = 0; i < n; ++i)
+                            x[i] *= s;
+                    });
+                iv -= 1;
+            }
+            else if constexpr (!is_complex<TA>) {
+                // Complex conjugate pair lambda = wr + i*wi with wi > 0. The
+                // real and imaginary parts of the eigenvector associated to
+                // lambda are stored in two consecutive columns.
+                const real_t b = T(ki0, ki);
+                const real_t c = T(ki, ki0);
+                const real_t wr = T(ki0, ki0);
+                const real_t wi = sqrt(abs(b)) * sqrt(abs(c));
+                const complex_t lambda(wr, wi);
+                const real_t smin = max(eps * (abs(wr) + wi), smlnum);
+
+                // Eigenvector of the 2-by-2 diagonal block
+                complex_t v0, v1;
+                if (abs(b) >= abs(c)) {
+                    v0 = complex_t(one, zero);
+                    v1 = complex_t(zero, wi / b);
+                }
+                else {
+                    v0 = complex_t(zero, wi / c);
+                    v1 = complex_t(one, zero);
+                }
+
+                auto xr = col(X, iv - 2);
+                auto xi = col(X, iv - 1);
+                for (idx_t i = 0; i < ki0; ++i) {
+                    const complex_t s = -T(i, ki0) * v0 - T(i, ki) * v1;
+                    xr[i] = real(s);
+                    xi[i] = imag(s);
+                }
+                xr[ki0] = real(v0);
+                xi[ki0] = imag(v0);
+                xr[ki] = real(v1);
+                xi[ki] = imag(v1);
+                for (idx_t i = ki + 1; i < n; ++i) {
+                    xr[i] = zero;
+                    xi[i] = zero;
+                }
+
+                internal::trevc3_backsolve<complex_t>(
+                    T, ki0, lambda, smin, bignum,
+                    [&](idx_t i) { return complex_t(xr[i], xi[i]); },
+                    [&](idx_t i, const complex_t& v) {
+                        xr[i] = real(v);
+                        xi[i] = imag(v);
+                    },
+                    [&](real_t s) {
+                        for (idx_t i = 0; i < n; ++i) {
+                            xr[i] *= s;
+                            xi[i] *= s;
+                        }
+                    });
+                iv -= 2;
+                ki = ki0;
+            }
+        }
+        flush(0);
+    }
+
+    if (want_vl) {
+        // Compute the left eigenvectors from the first to the last. Columns
+        // 0:iv of X hold the eigenvectors of the indices ki_lo:ki_lo+iv
+        idx_t iv = 0;
+        idx_t ki_lo = 0;
+
+        // Back-transform the eigenvectors in X and store them in VL
+        auto flush = [&]() {
+            const idx_t ki_hi = ki_lo + iv;
+            auto Q = slice(VL, range{0, n}, range{ki_lo, n});
+            auto Xb = slice(X, range{ki_lo, n}, range{0, iv});
+            auto Wb = slice(W, range{0, n}, range{0, iv});
+            gemm(NO_TRANS, NO_TRANS, one, Q, Xb, Wb);
+            internal::trevc3_normalize(T, ki_lo, Wb);
+
+            auto VLb = slice(VL, range{0, n}, range{ki_lo, ki_hi});
+            lacpy(GENERAL, Wb, VLb);
+            iv = 0;
+            ki_lo = ki_hi;
+        };
+
+        for (idx_t ki = 0; ki < n; ++ki) {
+            const bool pair = is_pair(ki);
+
+            if (iv + (pair ? 2 : 1) > nb) flush();
+
+            if (!pair) {
+                // Real eigenvalue or complex matrix
+                const TA mu = conj(T(ki, ki));
+                const real_t smin = max(eps * abs1(mu), smlnum);
+
+                auto x = col(X, iv);
+                for (idx_t i = 0; i < ki; ++i)
+                    x[i] = zero;
+                x[ki] = one;
+
+                internal::trevc3_forwardsolve<TA>(
+                    T, ki, ki + 1, mu, smin, bignum,
+                    [&](idx_t i) { return x[i]; },
+                    [&](idx_t i, const TA& v) { x[i] = v; },
+                    [&](real_t s) {
+                        for (idx_t i = 0; i < n; ++i)
+                            x[i] *= s;
+                    });
+                iv += 1;
+            }
+            else if constexpr (!is_complex<TA>) {
+                // Complex conjugate pair lambda = wr + i*wi with wi > 0. The
+                // left eigenvector u of lambda satisfies T^H u = conj(lambda) u
+                const real_t b = T(ki, ki + 1);
+                const real_t c = T(ki + 1, ki);
+                const real_t wr = T(ki, ki);
+                const real_t wi = sqrt(abs(b)) * sqrt(abs(c));
+                const complex_t mu(wr, -wi);
+                const real_t smin = max(eps * (abs(wr) + wi), smlnum);
+
+                // Left eigenvector of the 2-by-2 diagonal block
+                complex_t v0, v1;
+                if (abs(c) >= abs(b)) {
+                    v0 = complex_t(one, zero);
+                    v1 = complex_t(zero, -wi / c);
+                }
+                else {
+                    v0 = complex_t(zero, -wi / b);
+                    v1 = complex_t(one, zero);
+                }
+
+                auto xr = col(X, iv);
+                auto xi = col(X, iv + 1);
+                for (idx_t i = 0; i < ki; ++i) {
+                    xr[i] = zero;
+                    xi[i] = zero;
+                }
+                xr[ki] = real(v0);
+                xi[ki] = imag(v0);
+                xr[ki + 1] = real(v1);
+                xi[ki + 1] = imag(v1);
+
+                internal::trevc3_forwardsolve<complex_t>(
+                    T, ki, ki + 2, mu, smin, bignum,
+                    [&](idx_t i) { return complex_t(xr[i], xi[i]); },
+                    [&](idx_t i, const complex_t& v) {
+                        xr[i] = real(v);
+                        xi[i] = imag(v);
+                    },
+                    [&](real_t s) {
+                        for (idx_t i = 0; i < n; ++i) {
+                            xr[i] *= s;
+                            xi[i] *= s;
+                        }
+                    });
+                iv += 2;
+                ki += 1;
+            }
+        }
+        flush();
+    }
+
+    return 0;
+}
+
+/** Computes some or all of the right and/or left eigenvectors of a matrix T
+ * in Schur form.
+ *
+ * Matrices of this type are produced by the Schur factorization of a general
+ * matrix:  A = Q*T*Q^H, as computed by multishift_qr().
+ *
+ * The right eigenvector x and the left eigenvector y of T corresponding to an
+ * eigenvalue lambda are defined by:
+ * \[
+ *      T*x = lambda*x,   y^H*T = lambda*y^H.
+ * \]
+ *
+ * The eigenvectors of T are computed by back substitution, one at a time, and
+ * multiplied by the matrix Q on entry of VL and VR in blocks of opts.nb
+ * eigenvectors using gemm(). If Q is the unitary matrix from the Schur
+ * factorization, VL and VR contain on exit the left and right eigenvectors of
+ * A. If T is real, each complex conjugate pair of eigenvalues, with the
+ * positive imaginary part first, uses two consecutive columns of VL and VR:
+ * the real and imaginary parts of the eigenvector associated to the
+ * eigenvalue with positive imaginary part.
+ *
+ * Each eigenvector is normalized so that the element of largest magnitude has
+ * magnitude 1; here the magnitude of a complex number (x,y) is taken to be
+ * |x| + |y|.
+ *
+ * @return 0 if success.
+ *
+ * @param[in] want_vl bool.
+ *      If true, compute the left eigenvectors.
+ * @param[in] want_vr bool.
+ *      If true, compute the right eigenvectors.
+ * @param[in] T n-by-n matrix.
+ *      The upper quasi-triangular matrix T in Schur canonical form. If T is
+ *      complex, it must be upper triangular.
+ * @param[in,out] VL n-by-n matrix.
+ *      On entry, an n-by-n matrix Q, usually the Schur vectors of A.
+ *      On exit, if want_vl is true, Q times the left eigenvectors of T.
+ * @param[in,out] VR n-by-n matrix.
+ *      On entry, an n-by-n matrix Q, usually the Schur vectors of A.
+ *      On exit, if want_vr is true, Q times the right eigenvectors of T.
+ *
+ * @param[in] opts Options.
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_SMATRIX matrixT_t, TLAPACK_SMATRIX matrix_t>
+int trevc3(bool want_vl,
+           bool want_vr,
+           const matrixT_t& T,
+           matrix_t& VL,
+           matrix_t& VR,
+           const Trevc3Opts& opts = {})
+{
+    using TA = type_t<matrix_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // Gets workspace from the arena
+    WorkInfo workinfo = trevc3_worksize<TA>(want_vl, want_vr, T, VL, VR, opts);
+    auto work_ = workspace_arena<TA>().get(workinfo);
+    auto work = new_matrix(work_.vector(), workinfo.m, workinfo.n);
+
+    return trevc3_work(want_vl, want_vr, T, VL, VR, work, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_TREVC3_HH
@@ -27,13 +27,15 @@ struct TrmmBlockedOpts {
 /**
  * Triangular matrix-matrix multiply using a blocked algorithm.
  *
- * In iteration i, the algorithm computes $B_{0i} += \alpha A_{0i,i} B_i$ and
- * then $B_i := \alpha A_{i,i} B_i$, where i is the block index. See details in
- * the implementation. $B_i$ is cast to the precision type of `work`, enabling
- * mixed precision.
+ * The algorithm walks the blocks of B in the order that keeps the blocks it
+ * still needs unmodified. For each block $B_i$, it adds $\alpha op(A) B_i$ to
+ * the blocks of B not yet finalized, and then computes
+ * $B_i := \alpha op(A_{ii}) B_i$, where $A_{ii}$ is the diagonal block of A.
+ * E.g., for side = Left, uplo = Upper and trans = NoTrans, iteration i computes
+ * $B_0 += \alpha A_{0i} B_i$ and then $B_i := \alpha A_{ii} B_i$.
  *
- * @todo Implement the algorithm for the remaining cases. See what is missing
- * below.
+ * $B_i$ is cast to the precision type of `work` before the off-diagonal update,
+ * enabling mixed precision. The update is accumulated in the precision of B.
  *
  * @param[in] side
  *     Whether $op(A)$ is on the left or right of B:
@@ -63,7 +65,9 @@ struct TrmmBlockedOpts {
  *     - If side = Left: a m-by-m matrix.
  *     - If side = Right: a n-by-n matrix.
  * @param[in,out] B A m-by-n matrix.
- * @param work nb-by-n workspace that also informs the precision type to case B.
+ * @param work Workspace that also informs the precision type to cast B.
+ *     - If side = Left: a nb-by-n matrix.
+ *     - If side = Right: a m-by-nb matrix.
  * @param[in] opts Options.
  *
  * @ingroup blas3
@@ -86,103 +90,110 @@ void trmm_blocked_mixed(
     work_t& work,
     const TrmmBlockedOpts& opts = {})
 {
-    {
-        // data traits
-        using idx_t = size_type<matrixA_t>;
-        using range = std::pair<idx_t, idx_t>;
-
-        // constants
-        const idx_t m = nrows(B);
-        const idx_t n = ncols(B);
-        const idx_t nb = min(opts.nb, m);
-
-        // check arguments
-        tlapack_check_false(side != Side::Left && side != Side::Right);
-        tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
-        tlapack_check_false(trans != Op::NoTrans && trans != Op::Trans &&
-                            trans != Op::ConjTrans);
-        tlapack_check_false(diag != Diag::NonUnit && diag != Diag::Unit);
-        tlapack_check_false(nrows(A) != ncols(A));
-        tlapack_check_false(nrows(A) != ((side == Side::Left) ? m : n));
+    // data traits
+    using idx_t = size_type<matrixA_t>;
+    using range = std::pair<idx_t, idx_t>;
+    using real_t = real_type<type_t<matrixB_t>>;
 
+    // constants
+    const idx_t m = nrows(B);
+    const idx_t n = ncols(B);
+    const idx_t nb = min((idx_t)opts.nb, (side == Side::Left) ? m : n);
+
+    // check arguments
+    tlapack_check_false(side != Side::Left && side != Side::Right);
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check_false(trans != Op::NoTrans && trans != Op::Trans &&
+                        trans != Op::ConjTrans);
+    tlapack_check_false(diag != Diag::NonUnit && diag != Diag::Unit);
+    tlapack_check_false(nrows(A) != ncols(A));
+    tlapack_check_false(nrows(A) != ((side == Side::Left) ? m : n));
+
+    // Quick return
+    if (m <= 0 || n <= 0) return;
+
+    // op(A) is upper triangular
+    const bool upper = ((uplo == Uplo::Upper) == (trans == Op::NoTrans));
+
+    // Block (r,c) of op(A)
+    auto opA = [&](range r, range c) {
+        return (trans == Op::NoTrans) ? slice(A, r, c) : slice(A, c, r);
+    };
+
+    if (side == Side::Left) {
         // Matrix W
         auto [W, work1] = reshape(work, nb, n);
 
-        using real_t = real_type<type_t<matrixB_t>>;
-        if (side == Side::Left) {
-            if (trans == Op::NoTrans) {
-                if (uplo == Uplo::Upper) {
-                    for (idx_t i = 0; i < m; i += nb) {
-                        const idx_t ib = min(nb, m - i);
-
-                        const auto A0i =
-                            slice(A, range(0, i), range(i, i + ib));
-                        const auto Aii =
-                            slice(A, range(i, i + ib), range(i, i + ib));
-
-                        auto B0 = rows(B, range(0, i));
-                        auto Bi = rows(B, range(i, i + ib));
-                        auto BiLowPrecision = rows(W, range(0, ib));
-
-                        // B0 += alpha * A0i * Bi in mixed precision
-                        lacpy(GENERAL, Bi, BiLowPrecision);
-                        gemm(NO_TRANS, NO_TRANS, alpha, A0i, BiLowPrecision,
-                             real_t(1), B0);
-
-                        // Bi = alpha * Aii * Bi in mixed precision
-                        trmm(side, uplo, trans, diag, alpha, Aii, Bi);
-                    }
-                }
-                else {  // uplo == Uplo::Lower
-                    tlapack_error(1, "Blocked version of trsm not implemented");
-                }
-            }
-            else if (trans == Op::Trans) {
-                if (uplo == Uplo::Upper) {
-                    tlapack_error(1, "Blocked version of trsm not implemented");
-                }
-                else {  // uplo == Uplo::Lower
-                    tlapack_error(1, "Blocked version of trsm not implemented");
-                }
-            }
-            else {  // trans == Op::ConjTrans
-                if (uplo == Uplo::Upper) {
-                    tlapack_error(1, "Blocked version of trsm not implemented");
-                }
-                else {  // uplo == Uplo::Lower
-                    tlapack_error(1, "Blocked version of trsm not implemented");
-                }
+        // Computes rows i:i+ib of B and their contribution to rows r of B
+        auto step = [&](idx_t i, idx_t ib, range r) {
+            const auto Aii = slice(A, range(i, i + ib), range(i, i + ib));
+            auto Bi = rows(B, range(i, i + ib));
+
+            if (r.first < r.second) {
+                const auto Ari = opA(r, range(i, i + ib));
+                auto Br = rows(B, r);
+                auto BiLowPrecision = rows(W, range(0, ib));
+
+                // Br += alpha * op(A)_ri * Bi in mixed precision
+                lacpy(GENERAL, Bi, BiLowPrecision);
+                gemm(trans, NO_TRANS, alpha, Ari, BiLowPrecision, real_t(1),
+                     Br);
             }
+
+            // Bi = alpha * op(Aii) * Bi
+            trmm(side, uplo, trans, diag, alpha, Aii, Bi);
+        };
+
+        if (upper) {
+            for (idx_t i = 0; i < m; i += nb)
+                step(i, min(nb, m - i), range(0, i));
         }
-        else {  // side == Side::Right
-            if (trans == Op::NoTrans) {
-                if (uplo == Uplo::Upper) {
-                    tlapack_error(1, "Blocked version of trsm not implemented");
-                }
-                else {  // uplo == Uplo::Lower
-                    tlapack_error(1, "Blocked version of trsm not implemented");
-                }
+        else {
+            for (idx_t iend = m; iend > 0;) {
+                const idx_t ib = min(nb, iend);
+                step(iend - ib, ib, range(iend, m));
+                iend -= ib;
             }
-            else if (trans == Op::Trans) {
-                if (uplo == Uplo::Upper) {
-                    tlapack_error(1, "Blocked version of trsm not implemented");
-                }
-                else {  // uplo == Uplo::Lower
-                    tlapack_error(1, "Blocked version of trsm not implemented");
-                }
+        }
+    }
+    else {  // side == Side::Right
+        // Matrix W
+        auto [W, work1] = reshape(work, m, nb);
+
+        // Computes cols j:j+jb of B and their contribution to cols c of B
+        auto step = [&](idx_t j, idx_t jb, range c) {
+            const auto Ajj = slice(A, range(j, j + jb), range(j, j + jb));
+            auto Bj = cols(B, range(j, j + jb));
+
+            if (c.first < c.second) {
+                const auto Ajc = opA(range(j, j + jb), c);
+                auto Bc = cols(B, c);
+                auto BjLowPrecision = cols(W, range(0, jb));
+
+                // Bc += alpha * Bj * op(A)_jc in mixed precision
+                lacpy(GENERAL, Bj, BjLowPrecision);
+                gemm(NO_TRANS, trans, alpha, BjLowPrecision, Ajc, real_t(1),
+                     Bc);
             }
-            else {  // trans == Op::ConjTrans
-                if (uplo == Uplo::Upper) {
-                    tlapack_error(1, "Blocked version of trsm not implemented");
-                }
-                else {  // uplo == Uplo::Lower
-                    tlapack_error(1, "Blocked version of trsm not implemented");
-                }
+
+            // Bj = alpha * Bj * op(Ajj)
+            trmm(side, uplo, trans, diag, alpha, Ajj, Bj);
+        };
+
+        if (upper) {
+            for (idx_t jend = n; jend > 0;) {
+                const idx_t jb = min(nb, jend);
+                step(jend - jb, jb, range(jend, n));
+                jend -= jb;
             }
         }
+        else {
+            for (idx_t j = 0; j < n; j += nb)
+                step(j, min(nb, n - j), range(0, j));
+        }
     }
 }
 
 }  // namespace tlapack
 
-#endif
+#endif  // TLAPACK_TRMM_BLOCKED_MIXED_HH
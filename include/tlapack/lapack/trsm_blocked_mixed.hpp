@@ -0,0 +1,216 @@
+/// @file trsm_blocked_mixed.hpp
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TRSM_BLOCKED_MIXED_HH
+#define TLAPACK_TRSM_BLOCKED_MIXED_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for trsm_blocked_mixed
+ */
+struct TrsmBlockedOpts {
+    size_t nb = 32;  ///< Block size
+};
+
+/**
+ * Solve the triangular matrix-vector equation using a blocked algorithm.
+ * \[
+ *     op(A) X = \alpha B,
+ * \]
+ * or
+ * \[
+ *     X op(A) = \alpha B,
+ * \]
+ * where $op(A)$ is one of
+ *     $op(A) = A$,
+ *     $op(A) = A^T$, or
+ *     $op(A) = A^H$,
+ * X and B are m-by-n matrices, and A is an m-by-m or n-by-n, unit or non-unit,
+ * upper or lower triangular matrix.
+ *
+ * The algorithm solves for one block $X_i$ at a time with trsm() on the
+ * diagonal block $A_{ii}$, and then removes the contribution of $X_i$ from the
+ * blocks of B not yet solved. E.g., for side = Left, uplo = Upper and
+ * trans = NoTrans, iteration i computes $X_i := A_{ii}^{-1} B_i$ and then
+ * $B_0 -= A_{0i} X_i$.
+ *
+ * $X_i$ is cast to the precision type of `work` before the off-diagonal update,
+ * enabling mixed precision. The update is accumulated in the precision of B.
+ *
+ * @param[in] side
+ *     Whether $op(A)$ is on the left or right of X:
+ *     - Side::Left:  $op(A) X = B$.
+ *     - Side::Right: $X op(A) = B$.
+ *
+ * @param[in] uplo
+ *     - Uplo::Upper: A is an upper triangular matrix.
+ *     - Uplo::Lower: A is a lower triangular matrix.
+ *
+ * @param[in] trans
+ *     The form of $op(A)$:
+ *     - Op::NoTrans:   $op(A) = A$.
+ *     - Op::Trans:     $op(A) = A^T$.
+ *     - Op::ConjTrans: $op(A) = A^H$.
+ *
+ * @param[in] diag
+ *     Whether A has a unit or non-unit diagonal:
+ *     - Diag::Unit:    A is assumed to be unit triangular.
+ *     - Diag::NonUnit: A is not assumed to be unit triangular.
+ *
+ * @param[in] alpha Scalar.
+ * @param[in] A
+ *     - If side = Left: a m-by-m matrix.
+ *     - If side = Right: a n-by-n matrix.
+ * @param[in,out] B
+ *     On entry, the m-by-n matrix B.
+ *     On exit, the solution X.
+ * @param work Workspace that also informs the precision type to cast X.
+ *     - If side = Left: a nb-by-n matrix.
+ *     - If side = Right: a m-by-nb matrix.
+ * @param[in] opts Options.
+ *
+ * @ingroup blas3
+ */
+template <TLAPACK_SIDE side_t,
+          TLAPACK_UPLO uplo_t,
+          TLAPACK_OP op_t,
+          TLAPACK_DIAG diag_t,
+          TLAPACK_SMATRIX matrixA_t,
+          TLAPACK_SMATRIX matrixB_t,
+          TLAPACK_WORKSPACE work_t>
+void trsm_blocked_mixed(
+    side_t side,
+    uplo_t uplo,
+    op_t trans,
+    diag_t diag,
+    const scalar_type<type_t<matrixA_t>, type_t<matrixB_t>>& alpha,
+    const matrixA_t& A,
+    matrixB_t& B,
+    work_t& work,
+    const TrsmBlockedOpts& opts = {})
+{
+    // data traits
+    using idx_t = size_type<matrixA_t>;
+    using range = std::pair<idx_t, idx_t>;
+    using scalar_t = scalar_type<type_t<matrixA_t>, type_t<matrixB_t>>;
+
+    // constants
+    const scalar_t one(1);
+    const idx_t m = nrows(B);
+    const idx_t n = ncols(B);
+    const idx_t nb = min((idx_t)opts.nb, (side == Side::Left) ? m : n);
+
+    // check arguments
+    tlapack_check_false(side != Side::Left && side != Side::Right);
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check_false(trans != Op::NoTrans && trans != Op::Trans &&
+                        trans != Op::ConjTrans);
+    tlapack_check_false(diag != Diag::NonUnit && diag != Diag::Unit);
+    tlapack_check_false(nrows(A) != ncols(A));
+    tlapack_check_false(nrows(A) != ((side == Side::Left) ? m : n));
+
+    // Quick return
+    if (m <= 0 || n <= 0) return;
+
+    // op(A) is upper triangular
+    const bool upper = ((uplo == Uplo::Upper) == (trans == Op::NoTrans));
+
+    // Block (r,c) of op(A)
+    auto opA = [&](range r, range c) {
+        return (trans == Op::NoTrans) ? slice(A, r, c) : slice(A, c, r);
+    };
+
+    if (side == Side::Left) {
+        // Matrix W
+        auto [W, work1] = reshape(work, nb, n);
+
+        // Solves for rows i:i+ib of X and updates rows r of B. alpha is
+        // applied to the blocks of B in the first step.
+        auto step = [&](idx_t i, idx_t ib, range r, bool first) {
+            const scalar_t alpha_i = first ? alpha : one;
+            const auto Aii = slice(A, range(i, i + ib), range(i, i + ib));
+            auto Bi = rows(B, range(i, i + ib));
+
+            // Xi = alpha_i * op(Aii)^{-1} * Bi
+            trsm(side, uplo, trans, diag, alpha_i, Aii, Bi);
+
+            if (r.first < r.second) {
+                const auto Ari = opA(r, range(i, i + ib));
+                auto Br = rows(B, r);
+                auto XiLowPrecision = rows(W, range(0, ib));
+
+                // Br = alpha_i * Br - op(A)_ri * Xi in mixed precision
+                lacpy(GENERAL, Bi, XiLowPrecision);
+                gemm(trans, NO_TRANS, -one, Ari, XiLowPrecision, alpha_i, Br);
+            }
+        };
+
+        if (upper) {
+            for (idx_t iend = m; iend > 0;) {
+                const idx_t ib = min(nb, iend);
+                step(iend - ib, ib, range(0, iend - ib), iend == m);
+                iend -= ib;
+            }
+        }
+        else {
+            for (idx_t i = 0; i < m; i += nb) {
+                const idx_t ib = min(nb, m - i);
+                step(i, ib, range(i + ib, m), i == 0);
+            }
+        }
+    }
+    else {  // side == Side::Right
+        // Matrix W
+        auto [W, work1] = reshape(work, m, nb);
+
+        // Solves for cols j:j+jb of X and updates cols c of B. alpha is
+        // applied to the blocks of B in the first step.
+        auto step = [&](idx_t j, idx_t jb, range c, bool first) {
+            const scalar_t alpha_j = first ? alpha : one;
+            const auto Ajj = slice(A, range(j, j + jb), range(j, j + jb));
+            auto Bj = cols(B, range(j, j + jb));
+
+            // Xj = alpha_j * Bj * op(Ajj)^{-1}
+            trsm(side, uplo, trans, diag, alpha_j, Ajj, Bj);
+
+            if (c.first < c.second) {
+                const auto Ajc = opA(range(j, j + jb), c);
+                auto Bc = cols(B, c);
+                auto XjLowPrecision = cols(W, range(0, jb));
+
+                // Bc = alpha_j * Bc - Xj * op(A)_jc in mixed precision
+                lacpy(GENERAL, Bj, XjLowPrecision);
+                gemm(NO_TRANS, trans, -one, XjLowPrecision, Ajc, alpha_j, Bc);
+            }
+        };
+
+        if (upper) {
+            for (idx_t j = 0; j < n; j += nb) {
+                const idx_t jb = min(nb, n - j);
+                step(j, jb, range(j + jb, n), j == 0);
+            }
+        }
+        else {
+            for (idx_t jend = n; jend > 0;) {
+                const idx_t jb = min(nb, jend);
+                step(jend - jb, jb, range(0, jend - jb), jend == n);
+                jend -= jb;
+            }
+        }
+    }
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_TRSM_BLOCKED_MIXED_HH
@@ -0,0 +1,215 @@
+/// @file tsmqr.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/blob/master/SRC/ztprfb.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TSMQR_HH
+#define TLAPACK_TSMQR_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/trmm.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+
+namespace tlapack {
+
+/** Worspace query of tsmqr()
+ *
+ * @param[in] side
+ *     - Side::Left:  apply $Q$ or $Q^H$ from the Left.
+ *     - Side::Right: apply $Q$ or $Q^H$ from the Right.
+ *
+ * @param[in] trans
+ *     - Op::NoTrans:   apply $Q$.
+ *     - Op::ConjTrans: apply $Q^H$.
+ *
+ * @param[in] V m-by-k matrix.
+ *
+ * @param[in] TT k-by-k matrix.
+ *
+ * @param[in] C1
+ *     - side = Side::Left:  k-by-n matrix.
+ *     - side = Side::Right: n-by-k matrix.
+ *
+ * @param[in] C2
+ *     - side = Side::Left:  m-by-n matrix.
+ *     - side = Side::Right: n-by-m matrix.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T,
+          TLAPACK_SMATRIX matrixV_t,
+          TLAPACK_SMATRIX matrixT_t,
+          TLAPACK_SMATRIX matrixC1_t,
+          TLAPACK_SMATRIX matrixC2_t,
+          TLAPACK_SIDE side_t,
+          TLAPACK_OP trans_t>
+constexpr WorkInfo tsmqr_worksize(side_t side,
+                                  trans_t trans,
+                                  const matrixV_t& V,
+                                  const matrixT_t& TT,
+                                  const matrixC1_t& C1,
+                                  const matrixC2_t& C2)
+{
+    using work_t = matrix_type<matrixV_t, matrixC1_t>;
+
+    if constexpr (is_same_v<T, type_t<work_t>>)
+        return WorkInfo(nrows(C1), ncols(C1));
+    else
+        return WorkInfo(0);
+}
+
+/** @copybrief tsmqr()
+ * Workspace is provided as an argument.
+ * @copydetails tsmqr()
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrixV_t,
+          TLAPACK_SMATRIX matrixT_t,
+          TLAPACK_SMATRIX matrixC1_t,
+          TLAPACK_SMATRIX matrixC2_t,
+          TLAPACK_WORKSPACE work_t,
+          TLAPACK_SIDE side_t,
+          TLAPACK_OP trans_t>
+int tsmqr_work(side_t side,
+               trans_t trans,
+               const matrixV_t& V,
+               const matrixT_t& TT,
+               matrixC1_t& C1,
+               matrixC2_t& C2,
+               work_t& work)
+{
+    using idx_t = size_type<matrixC1_t>;
+    using T = type_t<matrixC1_t>;
+    using real_t = real_type<T>;
+
+    // constants
+    const real_t one(1);
+    const idx_t m = nrows(V);
+    const idx_t k = ncols(V);
+    const idx_t n = (side == Side::Left) ? ncols(C1) : nrows(C1);
+
+    // check arguments
+    tlapack_check_false(side != Side::Left && side != Side::Right);
+    tlapack_check_false(trans != Op::NoTrans && trans != Op::ConjTrans);
+    tlapack_check(nrows(TT) == k && ncols(TT) == k);
+    if (side == Side::Left) {
+        tlapack_check(nrows(C1) == k);
+        tlapack_check(nrows(C2) == m && ncols(C2) == n);
+    }
+    else {
+        tlapack_check(ncols(C1) == k);
+        tlapack_check(nrows(C2) == n && ncols(C2) == m);
+    }
+
+    // quick return
+    if (n <= 0 || k <= 0) return 0;
+
+    // Matrix W
+    auto [W, work1] = reshape(work, nrows(C1), ncols(C1));
+
+    if (side == Side::Left) {
+        // W := C1 + V^H C2
+        lacpy(GENERAL, C1, W);
+        gemm(CONJ_TRANS, NO_TRANS, one, V, C2, one, W);
+        // W := op(TT) W
+        trmm(LEFT_SIDE, UPPER_TRIANGLE, trans, NON_UNIT_DIAG, one, TT, W);
+        // C2 := C2 - V W
+        gemm(NO_TRANS, NO_TRANS, -one, V, W, one, C2);
+    }
+    else {
+        // W := C1 + C2 V
+        lacpy(GENERAL, C1, W);
+        gemm(NO_TRANS, NO_TRANS, one, C2, V, one, W);
+        // W := W op(TT)
+        trmm(RIGHT_SIDE, UPPER_TRIANGLE, trans, NON_UNIT_DIAG, one, TT, W);
+        // C2 := C2 - W V^H
+        gemm(NO_TRANS, CONJ_TRANS, -one, W, V, one, C2);
+    }
+
+    // C1 := C1 - W
+    for (idx_t j = 0; j < ncols(C1); ++j)
+        for (idx_t i = 0; i < nrows(C1); ++i)
+            C1(i, j) -= W(i, j);
+
+    return 0;
+}
+
+/** Applies the orthogonal matrix Q computed by tsqrt() to a matrix C
+ * split in two blocks.
+ *
+ * Q = I - V TT V^H, with V = [I; V2], is applied to
+ * \[
+ *      C = \begin{bmatrix} C_1 \\ C_2 \end{bmatrix}
+ *      \quad\text{or}\quad
+ *      C = \begin{bmatrix} C_1 & C_2 \end{bmatrix}
+ * \]
+ * from the left or from the right, respectively. The identity block of V
+ * multiplies C1 and V2 multiplies C2, so C1 and C2 may be stored apart, e.g.,
+ * in different tiles of a matrix.
+ *
+ * @param[in] side
+ *     - Side::Left:  apply $Q$ or $Q^H$ from the Left.
+ *     - Side::Right: apply $Q$ or $Q^H$ from the Right.
+ *
+ * @param[in] trans
+ *     - Op::NoTrans:   apply $Q$.
+ *     - Op::ConjTrans: apply $Q^H$.
+ *
+ * @param[in] V m-by-k matrix.
+ *      The matrix V2 of Householder vectors, as returned by tsqrt().
+ *
+ * @param[in] TT k-by-k matrix.
+ *      The upper triangular factor of the block reflector, as returned by
+ *      tsqrt().
+ *
+ * @param[in,out] C1
+ *     - side = Side::Left:  k-by-n matrix.
+ *     - side = Side::Right: n-by-k matrix.
+ *
+ * @param[in,out] C2
+ *     - side = Side::Left:  m-by-n matrix.
+ *     - side = Side::Right: n-by-m matrix.
+ *
+ * @return 0 if success
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_SMATRIX matrixV_t,
+          TLAPACK_SMATRIX matrixT_t,
+          TLAPACK_SMATRIX matrixC1_t,
+          TLAPACK_SMATRIX matrixC2_t,
+          TLAPACK_SIDE side_t,
+          TLAPACK_OP trans_t>
+int tsmqr(side_t side,
+          trans_t trans,
+          const matrixV_t& V,
+          const matrixT_t& TT,
+          matrixC1_t& C1,
+          matrixC2_t& C2)
+{
+    using work_t = matrix_type<matrixV_t, matrixC1_t>;
+    using T = type_t<work_t>;
+    Create<work_t> new_matrix;
+
+    // Get workspace from the arena
+    WorkInfo workinfo = tsmqr_worksize<T>(side, trans, V, TT, C1, C2);
+    auto work_ = workspace_arena<T>().get(workinfo);
+    auto work = new_matrix(work_.vector(), workinfo.m, workinfo.n);
+
+    return tsmqr_work(side, trans, V, TT, C1, C2, work);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_TSMQR_HH
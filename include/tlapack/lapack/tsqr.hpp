@@ -0,0 +1,464 @@
+/// @file tsqr.hpp Tall-skinny QR factorization.
+/// @see J. Demmel, L. Grigori, M. Hoemmen, and J. Langou, Communication-optimal
+/// parallel and sequential QR and LU factorizations, SIAM J. Sci. Comput.
+/// 34(1), 2012.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TSQR_HH
+#define TLAPACK_TSQR_HH
+
+#include "tlapack/base/threads.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/lapack/geqrf.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/larfg.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/ungqr.hpp"
+#include "tlapack/lapack/unmqr.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for tsqr(), unmqr_tsqr() and ungqr_tsqr()
+ */
+struct TsqrOpts {
+    /// Number of rows of the row blocks. The last block also takes the
+    /// remaining m % mb rows. If mb = 0, mb = max(16 n, 4096) is used.
+    size_t mb = 0;
+
+    /// Maximum number of OpenMP threads working on the row blocks.
+    /// If nthreads <= 0, use omp_get_max_threads().
+    int nthreads = 0;
+
+    size_t nb = 32;  ///< Block size used in the factorization of a row block
+};
+
+namespace internal {
+
+    /// Number of rows of the row blocks of tsqr().
+    template <class idx_t>
+    idx_t tsqr_mb(idx_t n, const TsqrOpts& opts)
+    {
+        return (opts.mb > 0) ? max<idx_t>(opts.mb, n)
+                             : max<idx_t>(16 * n, 4096);
+    }
+
+    /// Number of row blocks of tsqr().
+    template <class idx_t>
+    idx_t tsqr_nblocks(idx_t m, idx_t n, const TsqrOpts& opts)
+    {
+        return (m > n) ? max<idx_t>(m / tsqr_mb(n, opts), 1) : 1;
+    }
+
+    /// Number of OpenMP threads used by tsqr() for p independent tasks.
+    inline int tsqr_num_threads(const TsqrOpts& opts)
+    {
+#ifdef _OPENMP
+        if (omp_in_parallel()) return 1;
+        return (opts.nthreads > 0) ? opts.nthreads : omp_get_max_threads();
+#else
+        (void)opts;
+        return 1;
+#endif
+    }
+
+    /**
+     * Calls f(i, j) for the pairs of row blocks (i, j) that are merged in
+     * the reduction tree of tsqr(), in the order of the factorization if
+     * forward is true and in the reverse order otherwise. Pairs at the same
+     * level of the tree are distributed among OpenMP threads.
+     */
+    template <class idx_t, class F>
+    void tsqr_tree(idx_t p, bool forward, int nt, F&& f)
+    {
+        idx_t nlevels = 0;
+        while ((idx_t(1) << nlevels) < p)
+            ++nlevels;
+
+        for (idx_t l = 0; l < nlevels; ++l) {
+            const idx_t s = idx_t(1) << (forward ? l : nlevels - 1 - l);
+            const idx_t npairs = (p - s + 2 * s - 1) / (2 * s);
+            TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1 && npairs > 1))
+            for (idx_t k = 0; k < npairs; ++k)
+                f(2 * s * k, 2 * s * k + s);
+        }
+    }
+
+    /**
+     * Computes the QR factorization of the 2n-by-n matrix [R1; R2], where R1
+     * and R2 are upper triangular. On exit, R1 is overwritten by the R factor
+     * and R2 by the upper triangular part V2 of the Householder vectors
+     * V = [I; V2].
+     */
+    template <class matrix_t, class vector_t>
+    void tsqr_merge(matrix_t& R1, matrix_t& R2, vector_t& tau)
+    {
+        using idx_t = size_type<matrix_t>;
+        using T = type_t<matrix_t>;
+        using range = pair<idx_t, idx_t>;
+
+        const idx_t n = ncols(R1);
+
+        for (idx_t k = 0; k < n; ++k) {
+            auto x = slice(R2, range{0, k + 1}, k);
+            larfg(COLUMNWISE_STORAGE, R1(k, k), x, tau[k]);
+
+            // Apply H(k)^H to the remaining columns
+            const T ctau = conj(tau[k]);
+            for (idx_t l = k + 1; l < n; ++l) {
+                T w = R1(k, l);
+                for (idx_t i = 0; i <= k; ++i)
+                    w += conj(R2(i, k)) * R2(i, l);
+                w *= ctau;
+                R1(k, l) -= w;
+                for (idx_t i = 0; i <= k; ++i)
+                    R2(i, l) -= R2(i, k) * w;
+            }
+        }
+    }
+
+    /**
+     * Applies the reflectors of tsqr_merge() to the lines of C. Line k of
+     * the first block is line(i0 + k) and line k of the second block is
+     * line(j0 + k), where line(r) returns row r of C if side is Left and
+     * column r if side is Right.
+     */
+    template <class matrix_t,
+              class vector_t,
+              class matrixC_t,
+              class side_t,
+              class trans_t>
+    void tsqr_merge_apply(side_t side,
+                          trans_t trans,
+                          const matrix_t& V2,
+                          const vector_t& tau,
+                          matrixC_t& C,
+                          size_type<matrixC_t> i0,
+                          size_type<matrixC_t> j0)
+    {
+        using idx_t = size_type<matrixC_t>;
+        using T = type_t<matrixC_t>;
+
+        const idx_t n = ncols(V2);
+        const bool left = (side == Side::Left);
+        const idx_t nc = left ? ncols(C) : nrows(C);
+
+        // Q = H(0) H(1) ... H(n-1). Q^H is applied from the left and Q from
+        // the right in ascending order.
+        const bool ascending = left == (trans != Op::NoTrans);
+        const bool use_conj = (trans != Op::NoTrans);
+
+        for (idx_t kk = 0; kk < n; ++kk) {
+            const idx_t k = ascending ? kk : n - 1 - kk;
+            const T t = use_conj ? T(conj(tau[k])) : T(tau[k]);
+            for (idx_t c = 0; c < nc; ++c) {
+                T& c1 = left ? C(i0 + k, c) : C(c, i0 + k);
+                T w = c1;
+                if (left) {
+                    for (idx_t i = 0; i <= k; ++i)
+                        w += conj(V2(i, k)) * C(j0 + i, c);
+                }
+                else {
+                    for (idx_t i = 0; i <= k; ++i)
+                        w += C(c, j0 + i) * V2(i, k);
+                }
+                w *= t;
+                c1 -= w;
+                if (left) {
+                    for (idx_t i = 0; i <= k; ++i)
+                        C(j0 + i, c) -= V2(i, k) * w;
+                }
+                else {
+                    for (idx_t i = 0; i <= k; ++i)
+                        C(c, j0 + i) -= w * conj(V2(i, k));
+                }
+            }
+        }
+    }
+
+}  // namespace internal
+
+/** Number of scalar factors of the reflectors computed by tsqr().
+ *
+ * @param[in] m Number of rows of A.
+ * @param[in] n Number of columns of A.
+ * @param[in] opts Options.
+ *
+ * @return (2p-1)*n, where p is the number of row blocks.
+ */
+template <class idx_t>
+idx_t tsqr_tausize(idx_t m, idx_t n, const TsqrOpts& opts = {})
+{
+    const idx_t p = internal::tsqr_nblocks(m, n, opts);
+    return (2 * p - 1) * min(m, n);
+}
+
+/** Computes a QR factorization of a tall-skinny m-by-n matrix A,
+ * m >= n, using the TSQR algorithm.
+ *
+ * The rows of A are split in p blocks of opts.mb rows, which are factored
+ * independently by geqrf(). The p R factors are then reduced pairwise in a
+ * binary tree. The leaf factorizations and the merges at each level of the
+ * tree are distributed among OpenMP threads.
+ *
+ * The unitary matrix Q is represented implicitly by the Householder vectors
+ * stored in A and the scalar factors in tau, and can be applied with
+ * unmqr_tsqr() or formed with ungqr_tsqr(). This representation is not the
+ * one of geqrf(). If p = 1, tsqr() reduces to geqrf().
+ *
+ * @return  0 if success
+ *
+ * @param[in,out] A m-by-n matrix, m >= n.
+ *      On exit, the upper triangle of the first n rows contains the n-by-n
+ *      upper triangular matrix R. The rest of A contains the Householder
+ *      vectors of the row blocks and of the reduction tree.
+ *
+ * @param[out] tau Vector of length tsqr_tausize(m, n, opts).
+ *      The scalar factors of the Householder reflectors. The factors of the
+ *      row block i are stored in tau[i*n:(i+1)*n] and the factors of the
+ *      merge that eliminates the R factor of block j > 0 in
+ *      tau[(p+j-1)*n:(p+j)*n].
+ *
+ * @param[in] opts Options.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX A_t, TLAPACK_SVECTOR tau_t>
+int tsqr(A_t& A, tau_t& tau, const TsqrOpts& opts = {})
+{
+    using idx_t = size_type<A_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t p = internal::tsqr_nblocks(m, n, opts);
+    const idx_t mb = internal::tsqr_mb(n, opts);
+
+    // check arguments
+    tlapack_check((idx_t)size(tau) >= tsqr_tausize(m, n, opts));
+
+    // quick return
+    if (n == 0) return 0;
+    if (p == 1) {
+        auto tau0 = slice(tau, range{0, min(m, n)});
+        return geqrf(A, tau0, GeqrfOpts{opts.nb});
+    }
+
+    const int nt = internal::tsqr_num_threads(opts);
+
+    // Factor the row blocks
+    TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
+    for (idx_t i = 0; i < p; ++i) {
+        const idx_t i1 = (i + 1 < p) ? (i + 1) * mb : m;
+        auto Ai = slice(A, range{i * mb, i1}, range{0, n});
+        auto taui = slice(tau, range{i * n, (i + 1) * n});
+        geqrf(Ai, taui, GeqrfOpts{opts.nb});
+    }
+
+    // Reduce the R factors
+    internal::tsqr_tree(p, true, nt, [&](idx_t i, idx_t j) {
+        auto R1 = slice(A, range{i * mb, i * mb + n}, range{0, n});
+        auto R2 = slice(A, range{j * mb, j * mb + n}, range{0, n});
+        auto tauj = slice(tau, range{(p + j - 1) * n, (p + j) * n});
+        internal::tsqr_merge(R1, R2, tauj);
+    });
+
+    return 0;
+}
+
+/** Applies the unitary matrix Q from tsqr() to a matrix C.
+ *
+ * Computes Q C, Q^H C, C Q or C Q^H, where Q is the m-by-m unitary matrix
+ * of the factorization A = Q R computed by tsqr().
+ *
+ * @param[in] side Specifies which side Q is applied to C.
+ *      - Side::Left:  C is m-by-nc and is overwritten by op(Q) C;
+ *      - Side::Right: C is nc-by-m and is overwritten by C op(Q).
+ *
+ * @param[in] trans The operation op(Q) to be used:
+ *      - Op::NoTrans:   op(Q) = Q;
+ *      - Op::ConjTrans: op(Q) = Q^H.
+ *      Op::Trans is a valid value if the data type of A is real. In this
+ *      case, the operation is the same as with Op::ConjTrans.
+ *
+ * @param[in] A m-by-n matrix.
+ *      The Householder vectors, as returned by tsqr().
+ *
+ * @param[in] tau Vector of length tsqr_tausize(m, n, opts).
+ *      The scalar factors, as returned by tsqr().
+ *
+ * @param[in,out] C Matrix to be multiplied by op(Q).
+ *
+ * @param[in] opts Options. Must be the same used in tsqr().
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrixA_t,
+          TLAPACK_SMATRIX matrixC_t,
+          TLAPACK_SVECTOR tau_t,
+          TLAPACK_SIDE side_t,
+          TLAPACK_OP trans_t>
+int unmqr_tsqr(side_t side,
+               trans_t trans,
+               const matrixA_t& A,
+               const tau_t& tau,
+               matrixC_t& C,
+               const TsqrOpts& opts = {})
+{
+    using idx_t = size_type<matrixC_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t p = internal::tsqr_nblocks(m, n, opts);
+    const idx_t mb = internal::tsqr_mb(n, opts);
+    const bool left = (side == Side::Left);
+    const idx_t nc = left ? ncols(C) : nrows(C);
+
+    // check arguments
+    tlapack_check(side == Side::Left || side == Side::Right);
+    tlapack_check(trans == Op::NoTrans || trans == Op::ConjTrans ||
+                  (trans == Op::Trans && is_real<type_t<matrixA_t>>));
+    tlapack_check((left ? nrows(C) : ncols(C)) == m);
+    tlapack_check((idx_t)size(tau) >= tsqr_tausize(m, n, opts));
+
+    // quick return
+    if (n == 0 || nc == 0) return 0;
+    if (p == 1) {
+        auto tau0 = slice(tau, range{0, min(m, n)});
+        return unmqr(side, trans, A, tau0, C, UnmqrOpts{opts.nb});
+    }
+
+    const int nt = internal::tsqr_num_threads(opts);
+
+    // Q = diag(Q_0, ..., Q_{p-1}) * (merges in the order of the tree)
+    auto apply_blocks = [&]() {
+        TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
+        for (idx_t i = 0; i < p; ++i) {
+            const idx_t i1 = (i + 1 < p) ? (i + 1) * mb : m;
+            const auto Ai = slice(A, range{i * mb, i1}, range{0, n});
+            const auto taui = slice(tau, range{i * n, (i + 1) * n});
+            if (left) {
+                auto Ci = slice(C, range{i * mb, i1}, range{0, nc});
+                unmqr(side, trans, Ai, taui, Ci, UnmqrOpts{opts.nb});
+            }
+            else {
+                auto Ci = slice(C, range{0, nc}, range{i * mb, i1});
+                unmqr(side, trans, Ai, taui, Ci, UnmqrOpts{opts.nb});
+            }
+        }
+    };
+    auto apply_tree = [&](bool forward) {
+        internal::tsqr_tree(p, forward, nt, [&](idx_t i, idx_t j) {
+            const auto V2 = slice(A, range{j * mb, j * mb + n}, range{0, n});
+            const auto tauj = slice(tau, range{(p + j - 1) * n, (p + j) * n});
+            internal::tsqr_merge_apply(side, trans, V2, tauj, C, i * mb,
+                                       j * mb);
+        });
+    };
+
+    if (left == (trans != Op::NoTrans)) {
+        // Q^H C or C Q
+        apply_blocks();
+        apply_tree(true);
+    }
+    else {
+        // Q C or C Q^H
+        apply_tree(false);
+        apply_blocks();
+    }
+
+    return 0;
+}
+
+/** Generates the m-by-n matrix Q with orthonormal columns from tsqr().
+ *
+ * On exit, A contains the first n columns of the unitary matrix Q of the
+ * factorization A = Q R computed by tsqr().
+ *
+ * @param[in,out] A m-by-n matrix.
+ *      On entry, the Householder vectors, as returned by tsqr().
+ *      On exit, the m-by-n matrix Q.
+ *
+ * @param[in] tau Vector of length tsqr_tausize(m, n, opts).
+ *      The scalar factors, as returned by tsqr().
+ *
+ * @param[in] opts Options. Must be the same used in tsqr().
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t, TLAPACK_SVECTOR tau_t>
+int ungqr_tsqr(matrix_t& A, const tau_t& tau, const TsqrOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using T = type_t<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functors
+    Create<matrix_t> new_matrix;
+
+    // constants
+    const T zero(0);
+    const T one(1);
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t p = internal::tsqr_nblocks(m, n, opts);
+    const idx_t mb = internal::tsqr_mb(n, opts);
+
+    // check arguments
+    tlapack_check((idx_t)size(tau) >= tsqr_tausize(m, n, opts));
+
+    // quick return
+    if (n == 0) return 0;
+    if (p == 1) {
+        auto tau0 = slice(tau, range{0, min(m, n)});
+        return ungqr(A, tau0, UngqrOpts{opts.nb});
+    }
+
+    const int nt = internal::tsqr_num_threads(opts);
+
+    // Y = (merges of the tree) * [I; 0], where the rows of Y are the first
+    // n rows of each row block
+    auto Y_ = workspace_arena<T>().get(WorkInfo(p * n, n));
+    auto Y = new_matrix(Y_.vector(), p * n, n);
+    laset(GENERAL, zero, zero, Y);
+    {
+        auto Y0 = slice(Y, range{0, n}, range{0, n});
+        laset(GENERAL, zero, one, Y0);
+    }
+    internal::tsqr_tree(p, false, nt, [&](idx_t i, idx_t j) {
+        const auto V2 = slice(A, range{j * mb, j * mb + n}, range{0, n});
+        const auto tauj = slice(tau, range{(p + j - 1) * n, (p + j) * n});
+        internal::tsqr_merge_apply(LEFT_SIDE, NO_TRANS, V2, tauj, Y, i * n,
+                                   j * n);
+    });
+
+    // Q = diag(Q_0, ..., Q_{p-1}) * [Y_0; 0; Y_1; 0; ...]
+    TLAPACK_OMP(parallel for num_threads(nt) if (nt > 1))
+    for (idx_t i = 0; i < p; ++i) {
+        const idx_t i1 = (i + 1 < p) ? (i + 1) * mb : m;
+        auto Ai = slice(A, range{i * mb, i1}, range{0, n});
+        const auto taui = slice(tau, range{i * n, (i + 1) * n});
+        const auto Yi = slice(Y, range{i * n, (i + 1) * n}, range{0, n});
+        ungqr(Ai, taui, UngqrOpts{opts.nb});
+
+        auto W_ = workspace_arena<T>().get(WorkInfo(i1 - i * mb, n));
+        auto W = new_matrix(W_.vector(), i1 - i * mb, n);
+        gemm(NO_TRANS, NO_TRANS, one, Ai, Yi, W);
+        lacpy(GENERAL, W, Ai);
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_TSQR_HH
@@ -0,0 +1,117 @@
+/// @file tsqrt.hpp
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/blob/master/SRC/ztpqrt2.f
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TSQRT_HH
+#define TLAPACK_TSQRT_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemv.hpp"
+#include "tlapack/blas/trmv.hpp"
+#include "tlapack/lapack/larfg.hpp"
+
+namespace tlapack {
+
+/** Computes the QR factorization of a triangular matrix stacked on top of a
+ * general matrix,
+ * \[
+ *      \begin{bmatrix} A_1 \\ A_2 \end{bmatrix} = Q
+ *      \begin{bmatrix} R \\ 0 \end{bmatrix},
+ * \]
+ * where A1 is n-by-n upper triangular and A2 is m-by-n. This is the kernel
+ * that annihilates a tile below the diagonal in tiled QR factorizations.
+ *
+ * The matrix Q is represented as a block reflector
+ * \[
+ *      Q = I - V TT V^H, \quad
+ *      V = \begin{bmatrix} I \\ V_2 \end{bmatrix},
+ * \]
+ * where V2 is an m-by-n matrix and TT is n-by-n upper triangular.
+ *
+ * @param[in,out] A1 n-by-n matrix.
+ *      On entry, the upper triangular matrix A1.
+ *      On exit, the upper triangular matrix R.
+ *      The strictly lower triangular part is not referenced.
+ *
+ * @param[in,out] A2 m-by-n matrix.
+ *      On entry, the matrix A2.
+ *      On exit, the matrix V2 of Householder vectors.
+ *
+ * @param[out] TT n-by-n matrix.
+ *      The upper triangular factor of the block reflector.
+ *      The strictly lower triangular part is not referenced.
+ *
+ * @return 0 if success
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrixA1_t,
+          TLAPACK_SMATRIX matrixA2_t,
+          TLAPACK_SMATRIX matrixT_t>
+int tsqrt(matrixA1_t& A1, matrixA2_t& A2, matrixT_t& TT)
+{
+    using idx_t = size_type<matrixA2_t>;
+    using T = type_t<matrixA2_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const T zero(0);
+    const idx_t m = nrows(A2);
+    const idx_t n = ncols(A2);
+
+    // check arguments
+    tlapack_check(nrows(A1) == n && ncols(A1) == n);
+    tlapack_check(nrows(TT) == n && ncols(TT) == n);
+
+    // quick return
+    if (n <= 0) return 0;
+
+    for (idx_t j = 0; j < n; ++j) {
+        // Generate the reflector H(j) that annihilates A2(:,j). The diagonal
+        // element TT(j,j) stores its scalar factor.
+        auto x = col(A2, j);
+        larfg(COLUMNWISE_STORAGE, A1(j, j), x, TT(j, j));
+
+        // Apply H(j)^H to the remaining columns
+        const T ctau = conj(TT(j, j));
+        for (idx_t l = j + 1; l < n; ++l) {
+            T w = A1(j, l);
+            for (idx_t i = 0; i < m; ++i)
+                w += conj(A2(i, j)) * A2(i, l);
+            w *= ctau;
+            A1(j, l) -= w;
+            for (idx_t i = 0; i < m; ++i)
+                A2(i, l) -= A2(i, j) * w;
+        }
+    }
+
+    // Form the triangular factor of the block reflector
+    for (idx_t j = 1; j < n; ++j) {
+        auto t = slice(TT, range{0, j}, j);
+        if (TT(j, j) == zero) {
+            for (idx_t i = 0; i < j; ++i)
+                t[i] = zero;
+        }
+        else {
+            // t := - tau[j] V2(:,0:j)^H V2(:,j)
+            gemv(CONJ_TRANS, -TT(j, j), cols(A2, range{0, j}), col(A2, j),
+                 zero, t);
+
+            // t := TT(0:j,0:j) t
+            trmv(UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG,
+                 slice(TT, range{0, j}, range{0, j}), t);
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_TSQRT_HH
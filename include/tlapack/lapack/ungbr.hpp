@@ -209,10 +209,10 @@ int ungbr_q(const size_type<matrix_t> k,
     // Functor
     Create<work_t> new_matrix;
 
-    // Allocates workspace
+    // Gets workspace from the arena
     WorkInfo workinfo = ungbr_q_worksize<T>(k, A, tau, opts);
-    std::vector<T> work_;
-    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+    auto work_ = workspace_arena<T>().get(workinfo);
+    auto work = new_matrix(work_.vector(), workinfo.m, workinfo.n);
 
     return ungbr_q_work(k, A, tau, work, opts);
 }
@@ -319,10 +319,10 @@ int ungbr_p(const size_type<matrix_t> k,
     // Functor
     Create<work_t> new_matrix;
 
-    // Allocates workspace
+    // Gets workspace from the arena
     WorkInfo workinfo = ungbr_p_worksize<T>(k, A, tau, opts);
-    std::vector<T> work_;
-    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+    auto work_ = workspace_arena<T>().get(workinfo);
+    auto work = new_matrix(work_.vector(), workinfo.m, workinfo.n);
 
     return ungbr_p_work(k, A, tau, work, opts);
 }
@@ -90,6 +90,15 @@ namespace traits {
                                           : Layout::ColMajor);
     };
 
+    /// Compile-time extents of Eigen::Dense types. Eigen::Dynamic is -1.
+    template <class matrix_t>
+    struct static_extents_trait<
+        matrix_t,
+        typename std::enable_if<is_eigen_type<matrix_t>, int>::type> {
+        static constexpr int nrows = matrix_t::RowsAtCompileTime;
+        static constexpr int ncols = matrix_t::ColsAtCompileTime;
+    };
+
     template <class matrix_t>
     struct real_type_traits<
         matrix_t,
@@ -66,6 +66,20 @@ namespace traits {
         static constexpr Layout value = Layout::Strided;
     };
 
+    /// Compile-time extents of mdspan matrices
+    template <class ET, class Exts, class LP, class AP>
+    struct static_extents_trait<std::experimental::mdspan<ET, Exts, LP, AP>,
+                                std::enable_if_t<Exts::rank() == 2, int>> {
+        static constexpr int nrows =
+            (Exts::static_extent(0) == std::experimental::dynamic_extent)
+                ? -1
+                : (int)Exts::static_extent(0);
+        static constexpr int ncols =
+            (Exts::static_extent(1) == std::experimental::dynamic_extent)
+                ? -1
+                : (int)Exts::static_extent(1);
+    };
+
     template <class ET, class Exts, class LP, class AP>
     struct real_type_traits<std::experimental::mdspan<ET, Exts, LP, AP>, int> {
         using type = std::experimental::mdspan<real_type<ET>, Exts, LP, AP>;
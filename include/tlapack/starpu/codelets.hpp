@@ -249,6 +249,120 @@ namespace starpu {
 
             return cl;
         }
+
+        template <class T>
+        constexpr struct starpu_codelet gen_cl_getrf_panel() noexcept
+        {
+            struct starpu_codelet cl = codelet_init();
+
+            cl.cpu_funcs[0] = func::getrf_panel<T>;
+            cl.nbuffers = STARPU_VARIABLE_NBUFFERS;
+            cl.name = "tlapack::starpu::getrf_panel";
+
+            // The following lines are needed to make the codelet const
+            // See _starpu_codelet_check_deprecated_fields() in StarPU:
+            cl.where |= STARPU_CPU;
+            cl.checked = 1;
+
+            return cl;
+        }
+
+        template <class T>
+        constexpr struct starpu_codelet gen_cl_laswp() noexcept
+        {
+            struct starpu_codelet cl = codelet_init();
+
+            cl.cpu_funcs[0] = func::laswp<T>;
+            cl.nbuffers = STARPU_VARIABLE_NBUFFERS;
+            cl.name = "tlapack::starpu::laswp";
+
+            // The following lines are needed to make the codelet const
+            // See _starpu_codelet_check_deprecated_fields() in StarPU:
+            cl.where |= STARPU_CPU;
+            cl.checked = 1;
+
+            return cl;
+        }
+
+        template <class T>
+        constexpr struct starpu_codelet gen_cl_geqrt() noexcept
+        {
+            struct starpu_codelet cl = codelet_init();
+
+            cl.cpu_funcs[0] = func::geqrt<T>;
+            cl.nbuffers = 2;
+            cl.modes[0] = STARPU_RW;
+            cl.modes[1] = STARPU_W;
+            cl.name = "tlapack::starpu::geqrt";
+
+            // The following lines are needed to make the codelet const
+            // See _starpu_codelet_check_deprecated_fields() in StarPU:
+            cl.where |= STARPU_CPU;
+            cl.checked = 1;
+
+            return cl;
+        }
+
+        template <class T>
+        constexpr struct starpu_codelet gen_cl_gemqrt() noexcept
+        {
+            struct starpu_codelet cl = codelet_init();
+
+            cl.cpu_funcs[0] = func::gemqrt<T>;
+            cl.nbuffers = 3;
+            cl.modes[0] = STARPU_R;
+            cl.modes[1] = STARPU_R;
+            cl.modes[2] = STARPU_RW;
+            cl.name = "tlapack::starpu::gemqrt";
+
+            // The following lines are needed to make the codelet const
+            // See _starpu_codelet_check_deprecated_fields() in StarPU:
+            cl.where |= STARPU_CPU;
+            cl.checked = 1;
+
+            return cl;
+        }
+
+        template <class T>
+        constexpr struct starpu_codelet gen_cl_tsqrt() noexcept
+        {
+            struct starpu_codelet cl = codelet_init();
+
+            cl.cpu_funcs[0] = func::tsqrt<T>;
+            cl.nbuffers = 3;
+            cl.modes[0] = STARPU_RW;
+            cl.modes[1] = STARPU_RW;
+            cl.modes[2] = STARPU_W;
+            cl.name = "tlapack::starpu::tsqrt";
+
+            // The following lines are needed to make the codelet const
+            // See _starpu_codelet_check_deprecated_fields() in StarPU:
+            cl.where |= STARPU_CPU;
+            cl.checked = 1;
+
+            return cl;
+        }
+
+        template <class T>
+        constexpr struct starpu_codelet gen_cl_tsmqr() noexcept
+        {
+            struct starpu_codelet cl = codelet_init();
+
+            cl.cpu_funcs[0] = func::tsmqr<T>;
+            cl.nbuffers = 4;
+            cl.modes[0] = STARPU_RW;
+            cl.modes[1] = STARPU_RW;
+            cl.modes[2] = STARPU_R;
+            cl.modes[3] = STARPU_R;
+            cl.name = "tlapack::starpu::tsmqr";
+
+            // The following lines are needed to make the codelet const
+            // See _starpu_codelet_check_deprecated_fields() in StarPU:
+            cl.where |= STARPU_CPU;
+            cl.checked = 1;
+
+            return cl;
+        }
     }  // namespace internal
 
     // ---------------------------------------------------------------------
@@ -300,6 +414,30 @@ namespace starpu {
         constexpr const struct starpu_codelet potrf_noinfo =
             internal::gen_cl_potrf<uplo_t, T, false>();
 
+        template <class T>
+        constexpr const struct starpu_codelet getrf_panel =
+            internal::gen_cl_getrf_panel<T>();
+
+        template <class T>
+        constexpr const struct starpu_codelet laswp =
+            internal::gen_cl_laswp<T>();
+
+        template <class T>
+        constexpr const struct starpu_codelet geqrt =
+            internal::gen_cl_geqrt<T>();
+
+        template <class T>
+        constexpr const struct starpu_codelet gemqrt =
+            internal::gen_cl_gemqrt<T>();
+
+        template <class T>
+        constexpr const struct starpu_codelet tsqrt =
+            internal::gen_cl_tsqrt<T>();
+
+        template <class T>
+        constexpr const struct starpu_codelet tsmqr =
+            internal::gen_cl_tsmqr<T>();
+
     }  // namespace cl
 
 }  // namespace starpu
@@ -14,6 +14,15 @@
 #include <starpu_cublas_v2.h>
 #include <starpu_cusolver.h>
 
+// Plugin for the views of the tiles (must come before <T>LAPACK headers)
+#include "tlapack/plugins/legacyArray.hpp"
+
+#include "tlapack/lapack/geqrf_recursive.hpp"
+#include "tlapack/lapack/getrf.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/larfb.hpp"
+#include "tlapack/lapack/tsmqr.hpp"
+#include "tlapack/lapack/tsqrt.hpp"
 #include "tlapack/legacy_api/blas.hpp"
 #include "tlapack/legacy_api/lapack/potrf.hpp"
 #include "tlapack/starpu/utils.hpp"
@@ -529,6 +538,214 @@ namespace starpu {
                 static_assert(mode == 0, "Invalid mode");
         }
 
+        template <class T>
+        void getrf_panel(void** buffers, void* args)
+        {
+            using args_t = std::tuple<idx_t, GetrfVariant>;
+            using legacy::internal::create_matrix;
+            using legacy::internal::create_vector;
+            using range = pair<idx_t, idx_t>;
+
+            // get arguments
+            const args_t& cl_args = *(args_t*)args;
+            const idx_t& p = std::get<0>(cl_args);
+            GetrfOpts opts;
+            opts.variant = std::get<1>(cl_args);
+
+            // get dimensions
+            const idx_t& n = STARPU_MATRIX_GET_NY(buffers[0]);
+            idx_t m = 0;
+            for (idx_t t = 0; t < p; ++t)
+                m += STARPU_MATRIX_GET_NX(buffers[t]);
+
+            // get pivots and info
+            const idx_t& k = STARPU_VECTOR_GET_NX(buffers[p]);
+            auto piv =
+                create_vector((idx_t*)STARPU_VECTOR_GET_PTR(buffers[p]), k);
+            int* info = (int*)STARPU_VARIABLE_GET_PTR(buffers[p + 1]);
+
+            // copy the tiles of the panel to contiguous memory
+            std::vector<T> W_(m * n);
+            auto W = create_matrix(W_.data(), m, n);
+            for (idx_t t = 0, i = 0; t < p; ++t) {
+                const idx_t& mt = STARPU_MATRIX_GET_NX(buffers[t]);
+                const auto At =
+                    create_matrix((T*)STARPU_MATRIX_GET_PTR(buffers[t]), mt, n,
+                                  STARPU_MATRIX_GET_LD(buffers[t]));
+                auto Wt = rows(W, range(i, i + mt));
+                lacpy(GENERAL, At, Wt);
+                i += mt;
+            }
+
+            // call getrf
+            *info = getrf(W, piv, opts);
+
+            // copy the factors back to the tiles
+            for (idx_t t = 0, i = 0; t < p; ++t) {
+                const idx_t& mt = STARPU_MATRIX_GET_NX(buffers[t]);
+                auto At =
+                    create_matrix((T*)STARPU_MATRIX_GET_PTR(buffers[t]), mt, n,
+                                  STARPU_MATRIX_GET_LD(buffers[t]));
+                lacpy(GENERAL, rows(W, range(i, i + mt)), At);
+                i += mt;
+            }
+        }
+
+        template <class T>
+        constexpr void laswp(void** buffers, void* args) noexcept
+        {
+            using args_t = std::tuple<idx_t>;
+
+            // get arguments
+            const args_t& cl_args = *(args_t*)args;
+            const idx_t& p = std::get<0>(cl_args);
+
+            // get dimensions
+            const idx_t& n = STARPU_MATRIX_GET_NY(buffers[0]);
+            const idx_t& lda = STARPU_MATRIX_GET_LD(buffers[0]);
+
+            // get pivots
+            const idx_t& k = STARPU_VECTOR_GET_NX(buffers[p]);
+            const idx_t* piv = (const idx_t*)STARPU_VECTOR_GET_PTR(buffers[p]);
+
+            // get the first tile, which contains rows 0 to k-1
+            T* A = (T*)STARPU_MATRIX_GET_PTR(buffers[0]);
+
+            // swap rows
+            for (idx_t j = 0; j < k; ++j) {
+                if (piv[j] == j) continue;
+
+                // find the tile that contains row piv[j]
+                idx_t t = 0;
+                idx_t i = piv[j];
+                while (i >= STARPU_MATRIX_GET_NX(buffers[t])) {
+                    i -= STARPU_MATRIX_GET_NX(buffers[t]);
+                    ++t;
+                }
+                T* B = (T*)STARPU_MATRIX_GET_PTR(buffers[t]);
+                const idx_t& ldb = STARPU_MATRIX_GET_LD(buffers[t]);
+
+                for (idx_t c = 0; c < n; ++c) {
+                    const T aux = A[j + c * lda];
+                    A[j + c * lda] = B[i + c * ldb];
+                    B[i + c * ldb] = aux;
+                }
+            }
+        }
+
+        template <class T>
+        void geqrt(void** buffers, void* args)
+        {
+            using legacy::internal::create_matrix;
+            using legacy::internal::create_vector;
+            using range = pair<idx_t, idx_t>;
+
+            // get dimensions
+            const idx_t& m = STARPU_MATRIX_GET_NX(buffers[0]);
+            const idx_t& n = STARPU_MATRIX_GET_NY(buffers[0]);
+            const idx_t k = min(m, n);
+
+            // get matrices
+            auto A = create_matrix((T*)STARPU_MATRIX_GET_PTR(buffers[0]), m,
+                                   n, STARPU_MATRIX_GET_LD(buffers[0]));
+            auto TT = create_matrix((T*)STARPU_MATRIX_GET_PTR(buffers[1]), k,
+                                    k, STARPU_MATRIX_GET_LD(buffers[1]));
+
+            // factor the first k columns and build the block reflector
+            std::vector<T> tau_(k);
+            auto tau = create_vector(tau_.data(), k);
+            auto V = cols(A, range(0, k));
+            tlapack::internal::geqrt_recursive(V, tau, TT);
+
+            // update the remaining columns
+            if (n > k) {
+                auto C = cols(A, range(k, n));
+                larfb(LEFT_SIDE, CONJ_TRANS, FORWARD, COLUMNWISE_STORAGE, V,
+                      TT, C);
+            }
+        }
+
+        template <class T>
+        void gemqrt(void** buffers, void* args)
+        {
+            using args_t = std::tuple<Op>;
+            using legacy::internal::create_matrix;
+
+            // get arguments
+            const args_t& cl_args = *(args_t*)args;
+            const Op& trans = std::get<0>(cl_args);
+
+            // get dimensions
+            const idx_t& m = STARPU_MATRIX_GET_NX(buffers[0]);
+            const idx_t k = min(m, (idx_t)STARPU_MATRIX_GET_NY(buffers[0]));
+            const idx_t& n = STARPU_MATRIX_GET_NY(buffers[2]);
+
+            // get matrices
+            const auto V =
+                create_matrix((const T*)STARPU_MATRIX_GET_PTR(buffers[0]), m,
+                              k, STARPU_MATRIX_GET_LD(buffers[0]));
+            const auto TT =
+                create_matrix((const T*)STARPU_MATRIX_GET_PTR(buffers[1]), k,
+                              k, STARPU_MATRIX_GET_LD(buffers[1]));
+            auto C = create_matrix((T*)STARPU_MATRIX_GET_PTR(buffers[2]), m,
+                                   n, STARPU_MATRIX_GET_LD(buffers[2]));
+
+            // call larfb
+            larfb(LEFT_SIDE, trans, FORWARD, COLUMNWISE_STORAGE, V, TT, C);
+        }
+
+        template <class T>
+        void tsqrt(void** buffers, void* args)
+        {
+            using legacy::internal::create_matrix;
+
+            // get dimensions
+            const idx_t& m = STARPU_MATRIX_GET_NX(buffers[1]);
+            const idx_t& n = STARPU_MATRIX_GET_NY(buffers[1]);
+
+            // get matrices
+            auto A1 = create_matrix((T*)STARPU_MATRIX_GET_PTR(buffers[0]), n,
+                                    n, STARPU_MATRIX_GET_LD(buffers[0]));
+            auto A2 = create_matrix((T*)STARPU_MATRIX_GET_PTR(buffers[1]), m,
+                                    n, STARPU_MATRIX_GET_LD(buffers[1]));
+            auto TT = create_matrix((T*)STARPU_MATRIX_GET_PTR(buffers[2]), n,
+                                    n, STARPU_MATRIX_GET_LD(buffers[2]));
+
+            // call tsqrt
+            tlapack::tsqrt(A1, A2, TT);
+        }
+
+        template <class T>
+        void tsmqr(void** buffers, void* args)
+        {
+            using args_t = std::tuple<Op>;
+            using legacy::internal::create_matrix;
+
+            // get arguments
+            const args_t& cl_args = *(args_t*)args;
+            const Op& trans = std::get<0>(cl_args);
+
+            // get dimensions
+            const idx_t& m = STARPU_MATRIX_GET_NX(buffers[1]);
+            const idx_t& n = STARPU_MATRIX_GET_NY(buffers[1]);
+            const idx_t& k = STARPU_MATRIX_GET_NY(buffers[2]);
+
+            // get matrices
+            auto C1 = create_matrix((T*)STARPU_MATRIX_GET_PTR(buffers[0]), k,
+                                    n, STARPU_MATRIX_GET_LD(buffers[0]));
+            auto C2 = create_matrix((T*)STARPU_MATRIX_GET_PTR(buffers[1]), m,
+                                    n, STARPU_MATRIX_GET_LD(buffers[1]));
+            const auto V =
+                create_matrix((const T*)STARPU_MATRIX_GET_PTR(buffers[2]), m,
+                              k, STARPU_MATRIX_GET_LD(buffers[2]));
+            const auto TT =
+                create_matrix((const T*)STARPU_MATRIX_GET_PTR(buffers[3]), k,
+                              k, STARPU_MATRIX_GET_LD(buffers[3]));
+
+            // call tsmqr
+            tlapack::tsmqr(LEFT_SIDE, trans, V, TT, C1, C2);
+        }
+
     }  // namespace func
 }  // namespace starpu
 }  // namespace tlapack
@@ -0,0 +1,177 @@
+/// @file starpu/geqrf.hpp
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_STARPU_GEQRF_HH
+#define TLAPACK_STARPU_GEQRF_HH
+
+#include "tlapack/base/types.hpp"
+#include "tlapack/starpu/Matrix.hpp"
+#include "tlapack/starpu/tasks.hpp"
+
+namespace tlapack {
+
+/** Overload of geqrf for starpu::Matrix
+ *
+ * Tiled QR factorization with a flat reduction tree. For each column of
+ * tiles k:
+ *  1. geqrt: QR factorization of the diagonal tile A(k,k).
+ *  2. gemqrt: update of the tiles A(k,k+1:ny-1) with the reflectors of 1.
+ *  3. tsqrt: for each i > k, QR factorization of the triangle R in A(k,k)
+ *     stacked on top of the tile A(i,k), which is annihilated.
+ *  4. tsmqr: for each i > k, update of the pairs of tiles A(k,j) and A(i,j),
+ *     j > k, with the reflectors of 3.
+ *
+ * All kernels work on single tiles, so StarPU may start the factorization of
+ * the next column of tiles while the updates of the current one are
+ * running. Most of the work is done by tsmqr() in level-3 BLAS.
+ *
+ * @param[in,out] A m-by-n matrix. The tiles must be square, i.e.,
+ *      A.nblockrows() == A.nblockcols().
+ *      On exit, the elements on and above the diagonal contain the
+ *      min(m,n)-by-n upper trapezoidal matrix R. The Householder vectors of
+ *      the tile kernels are stored below the diagonal of the diagonal tiles
+ *      and in the tiles below the diagonal.
+ *
+ * @param[out] TT Matrix with the same grid of tiles as A, i.e.,
+ *      TT.get_nx() == A.get_nx() and TT.get_ny() == A.get_ny(), and tiles
+ *      with at least A.nblockcols() rows, e.g., a (nx*nb)-by-n matrix with
+ *      nb-by-nb tiles. On exit, the tile (i,k) of TT holds in its leading
+ *      part the triangular factor of the block reflector computed by geqrt
+ *      (i == k) or tsqrt (i > k) on step k.
+ *
+ * @return 0 if success
+ *
+ * @see unmqr(side_t, trans_t, starpu::Matrix<T>&, starpu::Matrix<T>&,
+ *      starpu::Matrix<T>&) to apply Q.
+ *
+ * @ingroup computational
+ */
+template <class T>
+int geqrf(starpu::Matrix<T>& A, starpu::Matrix<T>& TT)
+{
+    using starpu::idx_t;
+
+    // Constants
+    const idx_t m = A.nrows();
+    const idx_t n = A.ncols();
+    const idx_t nx = A.get_nx();
+    const idx_t ny = A.get_ny();
+    const idx_t nt = min(nx, ny);
+
+    // check arguments
+    tlapack_check(A.nblockrows() == A.nblockcols());
+    tlapack_check(TT.get_nx() == nx && TT.get_ny() == ny);
+
+    // Quick return
+    if (m < 1 || n < 1) return 0;
+
+    for (idx_t k = 0; k < nt; ++k) {
+        // Factor the diagonal tile and update its row of tiles
+        starpu::insert_task_geqrt<T>(A.tile(k, k), TT.tile(k, k));
+        for (idx_t j = k + 1; j < ny; ++j)
+            starpu::insert_task_gemqrt<T>(CONJ_TRANS, A.tile(k, k),
+                                          TT.tile(k, k), A.tile(k, j));
+
+        // Annihilate the tiles below the diagonal
+        for (idx_t i = k + 1; i < nx; ++i) {
+            starpu::insert_task_tsqrt<T>(A.tile(k, k), A.tile(i, k),
+                                         TT.tile(i, k));
+            for (idx_t j = k + 1; j < ny; ++j)
+                starpu::insert_task_tsmqr<T>(CONJ_TRANS, A.tile(i, k),
+                                             TT.tile(i, k), A.tile(k, j),
+                                             A.tile(i, j));
+        }
+    }
+
+    return 0;
+}
+
+/** Overload of unmqr for starpu::Matrix
+ *
+ * Applies the orthogonal matrix Q from the tiled QR factorization
+ * geqrf(starpu::Matrix<T>&, starpu::Matrix<T>&) to a matrix C from the left.
+ * With trans = Op::ConjTrans, this is the step that reduces a least squares
+ * problem min ||A x - C|| to a triangular solve with R.
+ *
+ * @param[in] side Must be Side::Left.
+ *
+ * @param[in] trans
+ *     - Op::NoTrans:   C := Q C.
+ *     - Op::ConjTrans: C := Q^H C.
+ *
+ * @param[in] A m-by-k matrix.
+ *      The Householder vectors as returned by
+ *      geqrf(starpu::Matrix<T>&, starpu::Matrix<T>&).
+ *
+ * @param[in] TT The triangular factors as returned by
+ *      geqrf(starpu::Matrix<T>&, starpu::Matrix<T>&).
+ *
+ * @param[in,out] C m-by-n matrix. The rows of C must be split in tiles the
+ *      same way as the rows of A.
+ *
+ * @return 0 if success
+ *
+ * @ingroup computational
+ */
+template <class T, TLAPACK_SIDE side_t, TLAPACK_OP trans_t>
+int unmqr(side_t side,
+          trans_t trans,
+          starpu::Matrix<T>& A,
+          starpu::Matrix<T>& TT,
+          starpu::Matrix<T>& C)
+{
+    using starpu::idx_t;
+
+    // Constants
+    const idx_t nx = A.get_nx();
+    const idx_t nt = min(nx, A.get_ny());
+    const idx_t ny = C.get_ny();
+
+    // check arguments
+    tlapack_check(side == Side::Left);
+    tlapack_check(trans == Op::NoTrans || trans == Op::ConjTrans);
+    tlapack_check(A.nrows() == C.nrows());
+    tlapack_check(C.get_nx() == nx && C.nblockrows() == A.nblockrows());
+    tlapack_check(TT.get_nx() == nx && TT.get_ny() == A.get_ny());
+
+    // Quick return
+    if (A.nrows() < 1 || A.ncols() < 1 || C.ncols() < 1) return 0;
+
+    if (trans == Op::ConjTrans) {
+        // Q^H = H(nt-1)^H ... H(0)^H, in the order of geqrf
+        for (idx_t k = 0; k < nt; ++k) {
+            for (idx_t j = 0; j < ny; ++j)
+                starpu::insert_task_gemqrt<T>(CONJ_TRANS, A.tile(k, k),
+                                              TT.tile(k, k), C.tile(k, j));
+            for (idx_t i = k + 1; i < nx; ++i)
+                for (idx_t j = 0; j < ny; ++j)
+                    starpu::insert_task_tsmqr<T>(CONJ_TRANS, A.tile(i, k),
+                                                 TT.tile(i, k), C.tile(k, j),
+                                                 C.tile(i, j));
+        }
+    }
+    else {
+        // Q = H(0) ... H(nt-1), in the reverse order of geqrf
+        for (idx_t k = nt; k-- > 0;) {
+            for (idx_t i = nx; i-- > k + 1;)
+                for (idx_t j = 0; j < ny; ++j)
+                    starpu::insert_task_tsmqr<T>(NO_TRANS, A.tile(i, k),
+                                                 TT.tile(i, k), C.tile(k, j),
+                                                 C.tile(i, j));
+            for (idx_t j = 0; j < ny; ++j)
+                starpu::insert_task_gemqrt<T>(NO_TRANS, A.tile(k, k),
+                                              TT.tile(k, k), C.tile(k, j));
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_STARPU_GEQRF_HH
@@ -0,0 +1,138 @@
+/// @file starpu/getrf.hpp
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_STARPU_GETRF_HH
+#define TLAPACK_STARPU_GETRF_HH
+
+#include <vector>
+
+#include "tlapack/base/types.hpp"
+#include "tlapack/starpu/Matrix.hpp"
+#include "tlapack/starpu/tasks.hpp"
+
+namespace tlapack {
+
+/** Overload of getrf for starpu::Matrix
+ *
+ * Tiled LU factorization with partial pivoting. For each column of tiles k:
+ *  1. One task factors the panel formed by the tiles (k:nx-1, k) with getrf().
+ *  2. One task per column of tiles j != k applies the row interchanges of the
+ *     panel to the tiles (k:nx-1, j).
+ *  3. Tasks with trsm and gemm update the tiles (k, k+1:ny-1) and
+ *     (k+1:nx-1, k+1:ny-1).
+ *
+ * StarPU schedules the tasks according to their data dependencies, so the
+ * panel of step k+1 may start as soon as its column is updated.
+ *
+ * @param[in,out] A m-by-n matrix. The tiles must be square, i.e.,
+ *      A.nblockrows() == A.nblockcols(), and the diagonal tiles must start at
+ *      the diagonal of A.
+ *      On exit, the factors L and U from the factorization A=PLU;
+ *      the unit diagonal elements of L are not stored.
+ *
+ * @param[out] piv Vector of length min(m,n).
+ *      Pivots as in getrf().
+ *
+ * @param[in] opts Options.
+ *      - @c opts.variant: Variant of getrf() used to factor each panel.
+ *
+ * @return  0 if success
+ * @return  i+1 if failed to compute the LU on iteration i
+ *
+ * @note The routine waits for the panel factorizations to complete so that
+ * piv and the return value are available on exit. Updates of the trailing
+ * tiles may still be running.
+ */
+template <class T, class piv_t>
+int getrf(starpu::Matrix<T>& A, piv_t& piv, const GetrfOpts& opts = {})
+{
+    using starpu::idx_t;
+
+    // Constants
+    const idx_t m = A.nrows();
+    const idx_t n = A.ncols();
+    const idx_t k = min(m, n);
+    const idx_t nx = A.get_nx();
+    const idx_t ny = A.get_ny();
+    const idx_t nt = min(nx, ny);
+
+    // check arguments
+    tlapack_check((idx_t)size(piv) >= k);
+    tlapack_check(A.nblockrows() == A.nblockcols());
+
+    // Quick return
+    if (m < 1 || n < 1) return 0;
+
+    // Pivots and info of each panel
+    std::vector<idx_t> ipiv(k);
+    std::vector<int> info(nt, 0);
+    std::vector<starpu_data_handle_t> hpiv(nt);
+    std::vector<starpu_data_handle_t> hinfo(nt);
+    std::vector<idx_t> offset(nt + 1, 0);
+
+    for (idx_t kt = 0; kt < nt; ++kt) {
+        const idx_t i0 = offset[kt];
+
+        // The diagonal tile can only be rectangular in the last step
+        const auto Akk = A.get_tiles(kt, kt, 1, 1);
+        const idx_t mk = Akk.nrows();
+        const idx_t nk = Akk.ncols();
+        tlapack_check(mk == nk || kt + 1 == nt);
+        const idx_t kb = min(mk, nk);
+        offset[kt + 1] = i0 + kb;
+
+        starpu_vector_data_register(&hpiv[kt], STARPU_MAIN_RAM,
+                                    (uintptr_t)&ipiv[i0], kb, sizeof(idx_t));
+        starpu_variable_data_register(&hinfo[kt], STARPU_MAIN_RAM,
+                                      (uintptr_t)&info[kt], sizeof(int));
+
+        // Factor the panel
+        auto Ap = A.get_tiles(kt, kt, nx - kt, 1);
+        starpu::insert_task_getrf_panel<T>(Ap, hpiv[kt], hinfo[kt],
+                                           opts.variant);
+
+        // Apply the row interchanges to the other columns of tiles
+        for (idx_t jt = 0; jt < ny; ++jt) {
+            if (jt == kt) continue;
+            auto Aj = A.get_tiles(kt, jt, nx - kt, 1);
+            starpu::insert_task_laswp<T>(Aj, hpiv[kt]);
+        }
+
+        // Update the trailing matrix
+        if (kt + 1 < ny) {
+            auto Lkk = A.map_to_tiles(i0, i0 + kb, i0, i0 + kb);
+            for (idx_t jt = kt + 1; jt < ny; ++jt)
+                starpu::insert_task_trsm<T, T>(LEFT_SIDE, LOWER_TRIANGLE,
+                                               NO_TRANS, UNIT_DIAG, T(1),
+                                               Lkk.tile(0, 0), A.tile(kt, jt));
+            for (idx_t it = kt + 1; it < nx; ++it)
+                for (idx_t jt = kt + 1; jt < ny; ++jt)
+                    starpu::insert_task_gemm<T, T, T>(
+                        NO_TRANS, NO_TRANS, T(-1), A.tile(it, kt),
+                        A.tile(kt, jt), T(1), A.tile(it, jt));
+        }
+    }
+
+    // Wait for the panels and collect pivots and info
+    int ret = 0;
+    for (idx_t kt = 0; kt < nt; ++kt) {
+        starpu_data_unregister(hpiv[kt]);
+        starpu_data_unregister(hinfo[kt]);
+
+        const idx_t i0 = offset[kt];
+        for (idx_t i = i0; i < offset[kt + 1]; ++i)
+            piv[i] = i0 + ipiv[i];
+        if (ret == 0 && info[kt] != 0) ret = i0 + info[kt];
+    }
+
+    return ret;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_STARPU_GETRF_HH
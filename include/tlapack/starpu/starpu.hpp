@@ -17,6 +17,8 @@
 // =============================================================================
 // LAPACK template implementations
 
+#include "tlapack/starpu/geqrf.hpp"
+#include "tlapack/starpu/getrf.hpp"
 #include "tlapack/starpu/potf2.hpp"
 
 #endif  // TLAPACK_STARPU_HEADERS_HH
\ No newline at end of file
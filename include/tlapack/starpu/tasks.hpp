@@ -11,6 +11,10 @@
 #ifndef TLAPACK_STARPU_TASKS_HH
 #define TLAPACK_STARPU_TASKS_HH
 
+#include <memory>
+#include <vector>
+
+#include "tlapack/starpu/Matrix.hpp"
 #include "tlapack/starpu/codelets.hpp"
 
 namespace tlapack {
@@ -22,6 +26,23 @@ namespace flops {
     constexpr double trsm(double m, double n) { return m * m * n; }
     constexpr double herk(double n, double k) { return (n + 1) * n * k; }
     constexpr double chol(double n) { return (n / 3) * n * n; }
+    constexpr double getrf(double m, double n)
+    {
+        return (m >= n) ? (m - n / 3) * n * n : (n - m / 3) * m * m;
+    }
+    constexpr double geqrf(double m, double n)
+    {
+        return (m >= n) ? 2 * (m - n / 3) * n * n : 2 * (n - m / 3) * m * m;
+    }
+    constexpr double unmqr(double m, double n, double k)
+    {
+        return 2 * n * k * (2 * m - k);
+    }
+    constexpr double tsqrt(double m, double n) { return 3 * m * n * n; }
+    constexpr double tsmqr(double m, double n, double k)
+    {
+        return 4 * m * n * k + n * k * k;
+    }
 }  // namespace flops
 }  // namespace tlapack
 
@@ -260,6 +281,264 @@ namespace starpu {
             starpu_data_unregister_submit(task->handles[(has_info ? 2 : 1)]);
     }
 
+    namespace internal {
+
+        /**
+         * @brief Set the number of buffers of a task whose codelet has a
+         * variable number of buffers
+         *
+         * If nbuffers is larger than STARPU_NMAXBUFS, the arrays of handles
+         * and modes are allocated here and freed by StarPU when the task is
+         * destroyed.
+         */
+        inline void task_set_nbuffers(struct starpu_task* task,
+                                      int nbuffers) noexcept
+        {
+            task->nbuffers = nbuffers;
+            if (nbuffers > STARPU_NMAXBUFS) {
+                task->dyn_handles = (starpu_data_handle_t*)malloc(
+                    nbuffers * sizeof(starpu_data_handle_t));
+                task->dyn_modes = (starpu_data_access_mode*)malloc(
+                    nbuffers * sizeof(starpu_data_access_mode));
+            }
+        }
+
+    }  // namespace internal
+
+    /**
+     * @brief Insert a task that computes the LU factorization with partial
+     * pivoting of a column of tiles
+     *
+     * @param[in,out] A Column of tiles, i.e., A.get_ny() == 1.
+     * @param[out] piv Vector handle with min(m,n) pivots, relative to the
+     *      first row of A.
+     * @param[out] info Variable handle with the info returned by getrf().
+     * @param[in] variant Variant of getrf() used in the panel.
+     */
+    template <class T>
+    void insert_task_getrf_panel(Matrix<T>& A,
+                                 starpu_data_handle_t piv,
+                                 starpu_data_handle_t info,
+                                 GetrfVariant variant = GetrfVariant::Recursive)
+    {
+        using args_t = std::tuple<idx_t, GetrfVariant>;
+
+        // check sizes
+        tlapack_check(A.get_ny() == 1);
+
+        // constants
+        const idx_t p = A.get_nx();
+
+        // Tiles of the panel. They must be alive until the task is submitted
+        std::vector<std::unique_ptr<Tile>> tiles(p);
+        for (idx_t i = 0; i < p; ++i)
+            tiles[i].reset(new Tile(A.tile(i, 0)));
+
+        // Allocate space for the task
+        struct starpu_task* task = starpu_task_create();
+
+        // Allocate space for the arguments
+        args_t* args_ptr = new args_t;
+
+        // Initialize arguments
+        std::get<0>(*args_ptr) = p;
+        std::get<1>(*args_ptr) = variant;
+
+        // Initialize task
+        task->cl = (struct starpu_codelet*)&(cl::getrf_panel<T>);
+        internal::task_set_nbuffers(task, p + 2);
+        for (idx_t i = 0; i < p; ++i) {
+            STARPU_TASK_SET_HANDLE(task, tiles[i]->handle, i);
+            STARPU_TASK_SET_MODE(task, STARPU_RW, i);
+        }
+        STARPU_TASK_SET_HANDLE(task, piv, p);
+        STARPU_TASK_SET_MODE(task, STARPU_W, p);
+        STARPU_TASK_SET_HANDLE(task, info, p + 1);
+        STARPU_TASK_SET_MODE(task, STARPU_W, p + 1);
+        task->cl_arg = (void*)args_ptr;
+        task->cl_arg_size = sizeof(args_t);
+        task->callback_func = [](void* args) noexcept { delete (args_t*)args; };
+        task->callback_arg = (void*)args_ptr;
+        task->flops = flops::getrf(A.nrows(), A.ncols());
+
+        // Submit task
+        const int ret = starpu_task_submit(task);
+        STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_submit");
+    }
+
+    /**
+     * @brief Insert a task that applies the row interchanges computed by
+     * insert_task_getrf_panel() to a column of tiles
+     *
+     * @param[in,out] A Column of tiles, i.e., A.get_ny() == 1.
+     * @param[in] piv Vector handle with the pivots, relative to the first row
+     *      of A.
+     */
+    template <class T>
+    void insert_task_laswp(Matrix<T>& A, starpu_data_handle_t piv)
+    {
+        using args_t = std::tuple<idx_t>;
+
+        // check sizes
+        tlapack_check(A.get_ny() == 1);
+
+        // constants
+        const idx_t p = A.get_nx();
+
+        // Tiles of the column. They must be alive until the task is submitted
+        std::vector<std::unique_ptr<Tile>> tiles(p);
+        for (idx_t i = 0; i < p; ++i)
+            tiles[i].reset(new Tile(A.tile(i, 0)));
+
+        // Allocate space for the task
+        struct starpu_task* task = starpu_task_create();
+
+        // Allocate space for the arguments
+        args_t* args_ptr = new args_t;
+
+        // Initialize arguments
+        std::get<0>(*args_ptr) = p;
+
+        // Initialize task
+        task->cl = (struct starpu_codelet*)&(cl::laswp<T>);
+        internal::task_set_nbuffers(task, p + 1);
+        for (idx_t i = 0; i < p; ++i) {
+            STARPU_TASK_SET_HANDLE(task, tiles[i]->handle, i);
+            STARPU_TASK_SET_MODE(task, STARPU_RW, i);
+        }
+        STARPU_TASK_SET_HANDLE(task, piv, p);
+        STARPU_TASK_SET_MODE(task, STARPU_R, p);
+        task->cl_arg = (void*)args_ptr;
+        task->cl_arg_size = sizeof(args_t);
+        task->callback_func = [](void* args) noexcept { delete (args_t*)args; };
+        task->callback_arg = (void*)args_ptr;
+
+        // Submit task
+        const int ret = starpu_task_submit(task);
+        STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_submit");
+    }
+
+    template <class T>
+    void insert_task_geqrt(const Tile& A, const Tile& TT)
+    {
+        // check sizes
+        tlapack_check(TT.m >= min(A.m, A.n) && TT.n >= min(A.m, A.n));
+
+        // Allocate space for the task
+        struct starpu_task* task = starpu_task_create();
+
+        // Initialize task
+        task->cl = (struct starpu_codelet*)&(cl::geqrt<T>);
+        task->handles[0] = A.handle;
+        task->handles[1] = TT.handle;
+        task->flops = flops::geqrf(A.m, A.n);
+
+        // Submit task
+        const int ret = starpu_task_submit(task);
+        STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_submit");
+    }
+
+    template <class T>
+    void insert_task_gemqrt(Op trans,
+                            const Tile& V,
+                            const Tile& TT,
+                            const Tile& C)
+    {
+        using args_t = std::tuple<Op>;
+
+        // check sizes
+        tlapack_check(V.m == C.m);
+        tlapack_check(TT.m >= min(V.m, V.n) && TT.n >= min(V.m, V.n));
+        tlapack_check(V.root_handle != C.root_handle);
+
+        // Allocate space for the task
+        struct starpu_task* task = starpu_task_create();
+
+        // Allocate space for the arguments
+        args_t* args_ptr = new args_t;
+
+        // Initialize arguments
+        std::get<0>(*args_ptr) = trans;
+
+        // Initialize task
+        task->cl = (struct starpu_codelet*)&(cl::gemqrt<T>);
+        task->handles[0] = V.handle;
+        task->handles[1] = TT.handle;
+        task->handles[2] = C.handle;
+        task->cl_arg = (void*)args_ptr;
+        task->cl_arg_size = sizeof(args_t);
+        task->callback_func = [](void* args) noexcept { delete (args_t*)args; };
+        task->callback_arg = (void*)args_ptr;
+        task->flops = flops::unmqr(C.m, C.n, min(V.m, V.n));
+
+        // Submit task
+        const int ret = starpu_task_submit(task);
+        STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_submit");
+    }
+
+    template <class T>
+    void insert_task_tsqrt(const Tile& A1, const Tile& A2, const Tile& TT)
+    {
+        // check sizes
+        tlapack_check(A1.m >= A2.n && A1.n == A2.n);
+        tlapack_check(TT.m >= A2.n && TT.n >= A2.n);
+        tlapack_check(A1.root_handle != A2.root_handle);
+
+        // Allocate space for the task
+        struct starpu_task* task = starpu_task_create();
+
+        // Initialize task
+        task->cl = (struct starpu_codelet*)&(cl::tsqrt<T>);
+        task->handles[0] = A1.handle;
+        task->handles[1] = A2.handle;
+        task->handles[2] = TT.handle;
+        task->flops = flops::tsqrt(A2.m, A2.n);
+
+        // Submit task
+        const int ret = starpu_task_submit(task);
+        STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_submit");
+    }
+
+    template <class T>
+    void insert_task_tsmqr(Op trans,
+                           const Tile& V,
+                           const Tile& TT,
+                           const Tile& C1,
+                           const Tile& C2)
+    {
+        using args_t = std::tuple<Op>;
+
+        // check sizes
+        tlapack_check(C1.m >= V.n && C1.n == C2.n && C2.m == V.m);
+        tlapack_check(TT.m >= V.n && TT.n >= V.n);
+        tlapack_check(C1.root_handle != C2.root_handle);
+
+        // Allocate space for the task
+        struct starpu_task* task = starpu_task_create();
+
+        // Allocate space for the arguments
+        args_t* args_ptr = new args_t;
+
+        // Initialize arguments
+        std::get<0>(*args_ptr) = trans;
+
+        // Initialize task
+        task->cl = (struct starpu_codelet*)&(cl::tsmqr<T>);
+        task->handles[0] = C1.handle;
+        task->handles[1] = C2.handle;
+        task->handles[2] = V.handle;
+        task->handles[3] = TT.handle;
+        task->cl_arg = (void*)args_ptr;
+        task->cl_arg_size = sizeof(args_t);
+        task->callback_func = [](void* args) noexcept { delete (args_t*)args; };
+        task->callback_arg = (void*)args_ptr;
+        task->flops = flops::tsmqr(C2.m, C2.n, V.n);
+
+        // Submit task
+        const int ret = starpu_task_submit(task);
+        STARPU_CHECK_RETURN_VALUE(ret, "starpu_task_submit");
+    }
+
 }  // namespace starpu
 }  // namespace tlapack
 
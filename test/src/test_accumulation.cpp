@@ -0,0 +1,173 @@
+/// @file test_accumulation.cpp
+/// @brief Test the accumulation variants of dot, gemv and gemm.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Other routines
+#include <tlapack/blas/dot.hpp>
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/blas/gemv.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("accumulation variants of dot, gemv and gemm",
+                   "[blas][accumulation][dot][gemv][gemm]",
+                   float,
+                   std::complex<float>)
+{
+    using T = TestType;
+    using matrix_t = LegacyMatrix<T, std::size_t, Layout::ColMajor>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using Tref = scalar_type<T, double>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const AccumulationVariant variant =
+        GENERATE(AccumulationVariant::Sequential,
+                 AccumulationVariant::Compensated,
+                 AccumulationVariant::Pairwise);
+    const bool wide = GENERATE(false, true);
+    const Op transA = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+    const idx_t k = GENERATE(1, 100, 5000);
+    const idx_t m = 3;
+    const idx_t n = 2;
+
+    DYNAMIC_SECTION("variant = " << (char)variant << " wide = " << wide
+                                 << " transA = " << transA << " k = " << k)
+    {
+        const real_t u = uroundoff<real_t>();
+        const real_t alpha(2);
+        const real_t beta(0.5);
+
+        // Bound on the error relative to the sum of the absolute values of the
+        // terms. The terms are rounded in the data precision, except with the
+        // wider accumulator.
+        real_t tol;
+        if (wide)
+            tol = 2 * u;
+        else if (variant == AccumulationVariant::Compensated)
+            tol = 4 * u;
+        else if (variant == AccumulationVariant::Pairwise)
+            tol = real_t(8 + 2 + std::ceil(std::log2(real_t(k)))) * u;
+        else
+            tol = real_t(k + 2) * u;
+
+        // Complex products have an extra rounding error
+        if (is_complex<T>) tol *= 2;
+
+        AccumulationOpts<void> opts;
+        opts.variant = variant;
+        AccumulationOpts<double> optsWide;
+        optsWide.variant = variant;
+
+        // Entries in [0,1) so that the terms do not cancel
+        std::vector<T> A_;
+        auto A = (transA == Op::NoTrans) ? new_matrix(A_, m, k)
+                                         : new_matrix(A_, k, m);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, k, n);
+        std::vector<T> C_;
+        auto C = new_matrix(C_, m, n);
+        std::vector<T> C0_;
+        auto C0 = new_matrix(C0_, m, n);
+        mm.random(A);
+        mm.random(B);
+        mm.random(C0);
+
+        // Entry (i,j) of op(A) and of the products, in double precision
+        auto opA = [&](idx_t i, idx_t l) {
+            return (transA == Op::NoTrans) ? Tref(A(i, l))
+                   : (transA == Op::Trans) ? Tref(A(l, i))
+                                           : conj(Tref(A(l, i)));
+        };
+        auto sumRef = [&](idx_t i, idx_t j) {
+            Tref s(0);
+            for (idx_t l = 0; l < k; ++l)
+                s += opA(i, l) * Tref(B(l, j));
+            return s;
+        };
+        auto absSumRef = [&](idx_t i, idx_t j) {
+            double s(0);
+            for (idx_t l = 0; l < k; ++l)
+                s += abs(opA(i, l)) * abs(Tref(B(l, j)));
+            return s;
+        };
+
+        SECTION("dot")
+        {
+            // dot(x, y) = x^H y
+            auto x = col(B, 1);
+            auto y = col(B, 0);
+            Tref ref(0);
+            double absRef(0);
+            for (idx_t l = 0; l < k; ++l) {
+                ref += conj(Tref(x[l])) * Tref(y[l]);
+                absRef += abs(Tref(x[l])) * abs(Tref(y[l]));
+            }
+
+            const Tref d = wide ? Tref(dot(x, y, optsWide))
+                                : Tref(dot(x, y, opts));
+            CHECK(abs(d - ref) <= tol * absRef);
+
+            // The wider accumulator is not rounded to the data precision
+            if (wide) {
+                CHECK(is_same_v<decltype(dot(x, y, optsWide)), Tref>);
+                CHECK(abs(d - ref) <= real_t(k) * ulp<double>() * absRef);
+            }
+        }
+
+        SECTION("gemv")
+        {
+            auto x = col(B, 0);
+            auto y = col(C, 0);
+            for (idx_t i = 0; i < m; ++i)
+                y[i] = C0(i, 0);
+
+            if (wide)
+                gemv(transA, alpha, A, x, beta, y, optsWide);
+            else
+                gemv(transA, alpha, A, x, beta, y, opts);
+
+            for (idx_t i = 0; i < m; ++i) {
+                const Tref ref = double(alpha) * sumRef(i, 0) +
+                                 double(beta) * Tref(C0(i, 0));
+                const double absRef = double(alpha) * absSumRef(i, 0) +
+                                      double(beta) * abs(Tref(C0(i, 0)));
+                CHECK(abs(Tref(y[i]) - ref) <= tol * absRef);
+            }
+        }
+
+        SECTION("gemm")
+        {
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < m; ++i)
+                    C(i, j) = C0(i, j);
+
+            if (wide)
+                gemm(transA, NO_TRANS, alpha, A, B, beta, C, optsWide);
+            else
+                gemm(transA, NO_TRANS, alpha, A, B, beta, C, opts);
+
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < m; ++i) {
+                    const Tref ref = double(alpha) * sumRef(i, j) +
+                                     double(beta) * Tref(C0(i, j));
+                    const double absRef = double(alpha) * absSumRef(i, j) +
+                                          double(beta) * abs(Tref(C0(i, j)));
+                    CHECK(abs(Tref(C(i, j)) - ref) <= tol * absRef);
+                }
+        }
+    }
+}
@@ -0,0 +1,181 @@
+/// @file test_batched.cpp
+/// @brief Test the batched factorizations of small matrices against the
+/// non-batched routines.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+
+// Other routines
+#include <tlapack/blas/herk.hpp>
+#include <tlapack/lapack/geqrf_batched.hpp>
+#include <tlapack/lapack/gesvd_batched.hpp>
+#include <tlapack/lapack/getrf_batched.hpp>
+#include <tlapack/lapack/potrf_batched.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("batched factorizations match the non-batched routines",
+                   "[batched]",
+                   TLAPACK_LEGACY_REAL_TYPES_TO_TEST,
+                   TLAPACK_LEGACY_COMPLEX_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    constexpr Layout L = layout<matrix_t>;
+    using batch_t = LegacyStridedBatch<T, idx_t, L>;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t m = GENERATE(1, 4, 13);
+    const idx_t n = GENERATE(1, 4, 13);
+    const idx_t count = GENERATE(1, 37);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " count = " << count)
+    {
+        const idx_t k = min(m, n);
+        const real_t tol = real_t(10 * max(m, n)) * ulp<real_t>();
+
+        // Random batch A and a copy in R
+        std::vector<T> A_(m * n * count);
+        batch_t A(m, n, A_.data(), count);
+        for (idx_t b = 0; b < count; ++b) {
+            auto Ab = A[b];
+            mm.random(Ab);
+        }
+        std::vector<T> R_(A_);
+        batch_t R(m, n, R_.data(), count);
+
+        // Max entrywise difference between A[b] and R[b]
+        auto diff = [&](idx_t b) {
+            auto Ab = A[b];
+            auto Rb = R[b];
+            real_t d(0), s(0);
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < m; ++i) {
+                    d = max(d, abs(Ab(i, j) - Rb(i, j)));
+                    s = max(s, abs(Rb(i, j)));
+                }
+            return (s > real_t(0)) ? d / s : d;
+        };
+
+        SECTION("getrf")
+        {
+            // Matrix 0 is singular
+            if (n > 1)
+                for (idx_t i = 0; i < m; ++i) {
+                    A[0](i, 0) = real_t(0);
+                    R[0](i, 0) = real_t(0);
+                }
+
+            std::vector<idx_t> piv(k * count);
+            std::vector<int> info(count);
+            const int nfailed = getrf_batched(A, piv.data(), info.data());
+
+            int nfailed_ref = 0;
+            std::vector<idx_t> pivb(k);
+            for (idx_t b = 0; b < count; ++b) {
+                auto Rb = R[b];
+                const int infob = getrf_level0(Rb, pivb);
+                if (infob != 0) ++nfailed_ref;
+                CHECK(info[b] == infob);
+                for (idx_t j = 0; j < k; ++j)
+                    CHECK(piv[b * k + j] == pivb[j]);
+                CHECK(diff(b) <= tol);
+            }
+            CHECK(nfailed == nfailed_ref);
+        }
+
+        SECTION("potrf")
+        {
+            if (m != n) SKIP_TEST;
+
+            // Make A and R Hermitian positive definite
+            std::vector<T> B_(n * n);
+            auto B = LegacyMatrix<T, idx_t, L>(n, n, B_.data());
+            for (idx_t b = 0; b < count; ++b) {
+                mm.random(B);
+                auto Ab = A[b];
+                herk(Uplo::General, Op::ConjTrans, real_t(1), B, real_t(0),
+                     Ab);
+                for (idx_t i = 0; i < n; ++i)
+                    Ab(i, i) += real_t(n);
+                auto Rb = R[b];
+                lacpy(GENERAL, Ab, Rb);
+            }
+
+            // Matrix 0 is not positive definite
+            A[0](n - 1, n - 1) = real_t(-1);
+            R[0](n - 1, n - 1) = real_t(-1);
+
+            const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+            std::vector<int> info(count);
+            const int nfailed = potrf_batched(uplo, A, info.data());
+
+            // Matrix 0 is not modified
+            CHECK(nfailed == 1);
+            CHECK(info[0] == int(n));
+            CHECK(diff(0) == real_t(0));
+
+            for (idx_t b = 1; b < count; ++b) {
+                auto Rb = R[b];
+                CHECK(info[b] == potrf(uplo, Rb));
+                CHECK(diff(b) <= tol);
+            }
+        }
+
+        SECTION("geqrf")
+        {
+            std::vector<T> tau(k * count);
+            geqrf_batched(A, tau.data());
+
+            std::vector<T> taub(k);
+            for (idx_t b = 0; b < count; ++b) {
+                auto Rb = R[b];
+                geqr2(Rb, taub);
+                // tau is only as accurate as R(j,j) relative to A
+                for (idx_t j = 0; j < k; ++j)
+                    CHECK(abs(tau[b * k + j] - taub[j]) * abs(Rb(j, j)) <=
+                          tol);
+                CHECK(diff(b) <= tol);
+            }
+        }
+
+        SECTION("gesvd")
+        {
+            // Pointer-array batches
+            std::vector<T*> ptrs(count);
+            for (idx_t b = 0; b < count; ++b)
+                ptrs[b] = A[b].ptr;
+            LegacyPointerBatch<T, idx_t, L> Ap(m, n, ptrs.data(), count);
+
+            std::vector<real_t> s(k * count);
+            std::vector<int> info(count);
+            const int nfailed = gesvd_batched(false, false, Ap, s.data(), Ap,
+                                              Ap, info.data());
+            CHECK(nfailed == 0);
+
+            std::vector<real_t> sb(k);
+            std::vector<T> U_, Vt_;
+            auto U = LegacyMatrix<T, idx_t, L>(0, 0, U_.data());
+            auto Vt = LegacyMatrix<T, idx_t, L>(0, 0, Vt_.data());
+            for (idx_t b = 0; b < count; ++b) {
+                auto Rb = R[b];
+                CHECK(info[b] == gesvd(false, false, Rb, sb, U, Vt));
+                for (idx_t j = 0; j < k; ++j)
+                    CHECK(abs(s[b * k + j] - sb[j]) <= tol * sb[0]);
+            }
+        }
+    }
+}
@@ -0,0 +1,242 @@
+/// @file test_bdsdc.cpp
+/// @brief Test divide and conquer variation of SVD
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/laset.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/bdsdc.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("bidiagonal divide and conquer svd is backward stable",
+                   "[svd][bdsdc]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // Pseudo random number generator
+    PCG32 prng;
+
+    const real_t zero(0);
+    const real_t one(1);
+
+    const idx_t n = GENERATE(1, 5, 20, 41);
+    const Uplo uplo = GENERATE(Uplo::Upper, Uplo::Lower);
+    const std::string matrixType = GENERATE("Random", "RankDeficient");
+
+    const real_t eps = ulp<real_t>();
+    real_t tol = real_t(20. * n) * eps;
+    // Use a slightly larger tolerance for half precision
+    if (eps > real_t(1.0e-6)) tol = tol * real_t(5.);
+
+    std::vector<T> Q_;
+    auto Q = new_matrix(Q_, n, n);
+    std::vector<T> Pt_;
+    auto Pt = new_matrix(Pt_, n, n);
+
+    std::vector<real_t> d(n);
+    std::vector<real_t> e(n - 1);
+    std::vector<real_t> d_copy(n);
+    std::vector<real_t> e_copy(n - 1);
+
+    // Generate random bidiagonal matrix
+    for (idx_t j = 0; j < n; ++j)
+        d[j] = rand_helper<real_t>(prng);
+    for (idx_t j = 0; j + 1 < n; ++j)
+        e[j] = rand_helper<real_t>(prng);
+    if (matrixType == "RankDeficient") {
+        // Zero and tiny rows give a cluster of singular values around zero
+        for (idx_t j = 0; j < n; j += 3) {
+            const real_t s = (j % 2 == 0) ? zero : eps * eps;
+            d[j] *= s;
+            if (j + 1 < n) e[j] *= s;
+        }
+    }
+
+    copy(d, d_copy);
+    copy(e, e_copy);
+
+    laset(Uplo::General, zero, one, Q);
+    laset(Uplo::General, zero, one, Pt);
+
+    DYNAMIC_SECTION("n = " << n << " uplo = " << uplo
+                           << " type = " << matrixType)
+    {
+        BdsdcOpts opts;
+        opts.smlsiz = 4;
+        int err = bdsdc(uplo, true, true, d, e, Q, Pt, opts);
+        REQUIRE(err == 0);
+
+        // Check that singular values are positive and sorted in decreasing
+        // order
+        for (idx_t i = 0; i < n; ++i) {
+            CHECK(d[i] >= zero);
+        }
+        for (idx_t i = 0; i + 1 < n; ++i) {
+            CHECK(d[i] >= d[i + 1]);
+        }
+
+        // Test for Q's orthogonality
+        std::vector<T> Wq_;
+        auto Wq = new_matrix(Wq_, n, n);
+        auto orth_Q = check_orthogonality(Q, Wq);
+        CHECK(orth_Q <= tol);
+
+        // Test for Pt's orthogonality
+        std::vector<T> Wpt_;
+        auto Wpt = new_matrix(Wpt_, n, n);
+        auto orth_Pt = check_orthogonality(Pt, Wpt);
+        CHECK(orth_Pt <= tol);
+
+        // Test Q * B * Z^H = A
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, n);
+        laset(Uplo::General, zero, zero, B);
+        for (idx_t j = 0; j < n; ++j) {
+            B(j, j) = d[j];
+        }
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        laset(Uplo::General, zero, zero, A);
+        for (idx_t j = 0; j < n; ++j) {
+            A(j, j) = d_copy[j];
+            if (j + 1 < n) {
+                if (uplo == Uplo::Upper)
+                    A(j, j + 1) = e_copy[j];
+                else
+                    A(j + 1, j) = e_copy[j];
+            }
+        }
+        real_t normA = tlapack::lange(tlapack::Norm::Max, A);
+        std::vector<T> K_;
+        auto K = new_matrix(K_, n, n);
+        laset(Uplo::General, zero, zero, K);
+        gemm(Op::NoTrans, Op::NoTrans, real_t(1.), B, Pt, real_t(0), K);
+        gemm(Op::NoTrans, Op::NoTrans, real_t(1.), Q, K, real_t(-1.), A);
+        real_t repres = lange(Norm::Max, A);
+        CHECK(repres <= tol * normA);
+    }
+}
+
+TEMPLATE_TEST_CASE(
+    "bidiagonal divide and conquer svd is orthogonal for graded matrices",
+    "[svd][bdsdc]",
+    TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // Pseudo random number generator
+    PCG32 prng;
+
+    const real_t zero(0);
+    const real_t one(1);
+
+    const idx_t n = 60;
+    const Uplo uplo = GENERATE(Uplo::Upper, Uplo::Lower);
+    const double f = GENERATE(3e-8, 1e-6, 1e-4, 1e-12, 0.);
+
+    const real_t eps = ulp<real_t>();
+    real_t tol = real_t(n) * eps;
+    // Use a slightly larger tolerance for half precision
+    if (eps > real_t(1.0e-6)) tol = tol * real_t(5.);
+
+    std::vector<T> Q_;
+    auto Q = new_matrix(Q_, n, n);
+    std::vector<T> Pt_;
+    auto Pt = new_matrix(Pt_, n, n);
+
+    std::vector<real_t> d(n);
+    std::vector<real_t> e(n - 1);
+
+    // Generate a random bidiagonal matrix with every 7th row scaled by f,
+    // which gives a group of small but nonzero singular values
+    for (idx_t j = 0; j < n; ++j)
+        d[j] = rand_helper<real_t>(prng);
+    for (idx_t j = 0; j + 1 < n; ++j)
+        e[j] = rand_helper<real_t>(prng);
+    for (idx_t j = 0; j < n; j += 7) {
+        d[j] *= real_t(f);
+        if (j + 1 < n) e[j] *= real_t(f);
+    }
+
+    std::vector<real_t> d_copy(d);
+    std::vector<real_t> e_copy(e);
+
+    laset(Uplo::General, zero, one, Q);
+    laset(Uplo::General, zero, one, Pt);
+
+    DYNAMIC_SECTION("uplo = " << uplo << " f = " << f)
+    {
+        BdsdcOpts opts;
+        opts.smlsiz = 4;
+        int err = bdsdc(uplo, true, true, d, e, Q, Pt, opts);
+        REQUIRE(err == 0);
+
+        for (idx_t i = 0; i + 1 < n; ++i) {
+            CHECK(d[i] >= d[i + 1]);
+        }
+        CHECK(d[n - 1] >= zero);
+
+        // Test for Q's orthogonality
+        std::vector<T> Wq_;
+        auto Wq = new_matrix(Wq_, n, n);
+        auto orth_Q = check_orthogonality(Q, Wq);
+        CHECK(orth_Q <= tol);
+
+        // Test for Pt's orthogonality
+        std::vector<T> Wpt_;
+        auto Wpt = new_matrix(Wpt_, n, n);
+        auto orth_Pt = check_orthogonality(Pt, Wpt);
+        CHECK(orth_Pt <= tol);
+
+        // Test Q * S * Pt = B
+        std::vector<T> K_;
+        auto K = new_matrix(K_, n, n);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                K(i, j) = d[i] * Pt(i, j);
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        laset(Uplo::General, zero, zero, A);
+        for (idx_t j = 0; j < n; ++j) {
+            A(j, j) = d_copy[j];
+            if (j + 1 < n) {
+                if (uplo == Uplo::Upper)
+                    A(j, j + 1) = e_copy[j];
+                else
+                    A(j + 1, j) = e_copy[j];
+            }
+        }
+        real_t normA = lange(Norm::Max, A);
+        gemm(Op::NoTrans, Op::NoTrans, real_t(1.), Q, K, real_t(-1.), A);
+        real_t repres = lange(Norm::Max, A);
+        CHECK(repres <= real_t(4) * tol * normA);
+    }
+}
@@ -0,0 +1,153 @@
+/// @file test_blas3_threads.cpp
+/// @brief Test the multithreaded level-3 BLAS templates against their serial
+/// execution.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/blas/hemm.hpp>
+#include <tlapack/blas/her2k.hpp>
+#include <tlapack/blas/herk.hpp>
+#include <tlapack/blas/trmm.hpp>
+#include <tlapack/blas/trsm.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("threaded level-3 BLAS match the serial execution",
+                   "[blas3][threads]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t m = GENERATE(31, 80);
+    const idx_t n = GENERATE(1, 29);
+    const int nthreads = GENERATE(2, 5);
+    const Side side = GENERATE(Side::Left, Side::Right);
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const Op trans = GENERATE(Op::NoTrans, Op::ConjTrans);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " nthreads = " << nthreads
+                           << " side = " << side << " uplo = " << uplo
+                           << " trans = " << trans)
+    {
+        const idx_t k = 17;
+        const idx_t p = (side == Side::Left) ? m : n;
+        const idx_t q = (trans == Op::NoTrans) ? m : k;
+        const idx_t r = (trans == Op::NoTrans) ? k : m;
+        const real_t tol = real_t(10 * max(m, n)) * ulp<real_t>();
+
+        const T alpha = real_t(1.5);
+        const T beta = real_t(-0.5);
+
+        // Create matrices
+        std::vector<T> A_;
+        auto A = new_matrix(A_, p, p);
+        std::vector<T> G_;
+        auto G = new_matrix(G_, q, r);
+        std::vector<T> H_;
+        auto H = new_matrix(H_, q, r);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, m, n);
+        std::vector<T> C_;
+        auto C = new_matrix(C_, m, n);
+        std::vector<T> S_;
+        auto S = new_matrix(S_, m, m);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, m, n);
+        std::vector<T> Y_;
+        auto Y = new_matrix(Y_, m, m);
+
+        mm.random(A);
+        mm.random(G);
+        mm.random(H);
+        mm.random(B);
+        mm.random(C);
+        mm.random(S);
+
+        // Make the triangular matrix well conditioned
+        for (idx_t i = 0; i < p; ++i)
+            A(i, i) += real_t(p);
+
+        // Saves the current options
+        const Blas3ThreadOpts defaultOpts = blas3_thread_opts();
+
+        // Runs op serially and then with threads, and compares the outputs
+        auto check = [&](auto& out, auto&& out0, auto&& op) {
+            blas3_thread_opts().min_volume = std::size_t(-1);
+            lacpy(GENERAL, out0, out);
+            op(out);
+            std::vector<T> R_;
+            auto R = new_matrix(R_, nrows(out), ncols(out));
+            lacpy(GENERAL, out, R);
+
+            blas3_thread_opts().nthreads = nthreads;
+            blas3_thread_opts().min_volume = 0;
+            lacpy(GENERAL, out0, out);
+            op(out);
+            blas3_thread_opts() = defaultOpts;
+
+            const real_t normR = lange(MAX_NORM, R);
+            for (idx_t j = 0; j < ncols(out); ++j)
+                for (idx_t i = 0; i < nrows(out); ++i)
+                    R(i, j) -= out(i, j);
+            CHECK(lange(MAX_NORM, R) <= tol * normR);
+        };
+
+        SECTION("gemm")
+        {
+            check(X, C, [&](auto& Z) {
+                gemm(trans, NO_TRANS, alpha, S, B, beta, Z);
+            });
+        }
+        SECTION("trsm")
+        {
+            check(X, B, [&](auto& Z) {
+                trsm(side, uplo, trans, NON_UNIT_DIAG, alpha, A, Z);
+            });
+        }
+        SECTION("trmm")
+        {
+            check(X, B, [&](auto& Z) {
+                trmm(side, uplo, trans, NON_UNIT_DIAG, alpha, A, Z);
+            });
+        }
+        SECTION("hemm")
+        {
+            check(X, C,
+                  [&](auto& Z) { hemm(side, uplo, alpha, A, B, beta, Z); });
+        }
+        SECTION("herk")
+        {
+            check(Y, S, [&](auto& Z) {
+                herk(uplo, trans, real_t(1.5), G, real_t(-0.5), Z);
+            });
+        }
+        SECTION("her2k")
+        {
+            check(Y, S, [&](auto& Z) {
+                her2k(uplo, trans, alpha, G, H, real_t(-0.5), Z);
+            });
+        }
+    }
+}
@@ -11,6 +11,12 @@
 // Test utilities and definitions (must come before <T>LAPACK headers)
 #include "testutils.hpp"
 
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/geqr2.hpp>
+#include <tlapack/lapack/getrf_level0.hpp>
+#include <tlapack/lapack/potf2.hpp>
+
 template <class block_t>
 void test_block()
 {
@@ -227,3 +233,86 @@ TEST_CASE("Layout works", "[plugins]")
         CHECK(tlapack::layout<B> == tlapack::Layout::Strided);
     }
 }
+
+template <class T, int m, int n>
+void test_fixed_size_kernels()
+{
+    using namespace tlapack;
+    using real_t = real_type<T>;
+    using fixed_t = Eigen::Matrix<T, m, n>;
+    using dynamic_t = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>;
+    constexpr int k = (m < n) ? m : n;
+    const real_t tol = real_t(10 * max(m, n)) * ulp<real_t>();
+
+    CHECK(static_nrows<fixed_t> == m);
+    CHECK(static_ncols<fixed_t> == n);
+    CHECK(has_small_static_extents<fixed_t>);
+    CHECK(!has_static_extents<dynamic_t>);
+
+    MatrixMarket mm;
+    fixed_t A;
+    mm.random(A);
+    const dynamic_t Ad = A;
+
+    // getrf_level0 gives exactly the same factors
+    {
+        fixed_t F = A;
+        dynamic_t Fd = Ad;
+        std::vector<Eigen::Index> piv(k), pivd(k);
+        CHECK(getrf_level0(F, piv) == getrf_level0(Fd, pivd));
+        CHECK(piv == pivd);
+        CHECK((F - Fd).norm() == real_t(0));
+    }
+
+    // geqr2
+    {
+        fixed_t F = A;
+        dynamic_t Fd = Ad;
+        std::vector<T> tau(k), taud(k);
+        CHECK(geqr2(F, tau) == geqr2(Fd, taud));
+        CHECK((F - Fd).norm() <= tol * Ad.norm());
+    }
+
+    // potf2
+    if constexpr (m == n) {
+        const fixed_t S = A.adjoint() * A + real_t(n) * fixed_t::Identity();
+        for (const Uplo uplo : {Uplo::Lower, Uplo::Upper}) {
+            fixed_t F = S;
+            dynamic_t Fd = S;
+            CHECK(potf2(uplo, F) == potf2(uplo, Fd));
+            CHECK((F - Fd).norm() <= tol * S.norm());
+        }
+    }
+
+    // gemm
+    {
+        Eigen::Matrix<T, n, m> B;
+        Eigen::Matrix<T, m, m> C;
+        mm.random(B);
+        mm.random(C);
+        const dynamic_t Bd = B;
+        dynamic_t Cd = C;
+        const T alpha(real_t(2));
+        const T beta(real_t(-1));
+
+        gemm(NO_TRANS, NO_TRANS, alpha, A, B, beta, C);
+        gemm(NO_TRANS, NO_TRANS, alpha, Ad, Bd, beta, Cd);
+        CHECK((C - Cd).norm() <= tol * Cd.norm());
+
+        Eigen::Matrix<T, n, n> D;
+        dynamic_t Dd(n, n);
+        gemm(CONJ_TRANS, TRANSPOSE, alpha, A, B, D);
+        gemm(CONJ_TRANS, TRANSPOSE, alpha, Ad, Bd, Dd);
+        CHECK((D - Dd).norm() <= tol * Dd.norm());
+    }
+}
+
+TEST_CASE("Fixed-size Eigen matrices use the static code paths", "[plugins]")
+{
+    test_fixed_size_kernels<double, 3, 3>();
+    test_fixed_size_kernels<double, 4, 4>();
+    test_fixed_size_kernels<double, 6, 6>();
+    test_fixed_size_kernels<double, 5, 3>();
+    test_fixed_size_kernels<double, 3, 5>();
+    test_fixed_size_kernels<float, 4, 4>();
+}
@@ -0,0 +1,160 @@
+/// @file test_geev.cpp
+/// @brief Test the nonsymmetric eigenvalue driver GEEV
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/lapack/geev.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("geev computes the eigenvectors of a general matrix",
+                   "[eigenvalues][geev]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+    typedef complex_type<real_t> complex_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // Generators
+    const idx_t n = GENERATE(1, 2, 7, 30);
+    const std::string matrixType = GENERATE("Random", "Reducible", "Graded");
+    const idx_t nb = GENERATE(2, 5);
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    DYNAMIC_SECTION("n = " << n << " type = " << matrixType << " nb = " << nb)
+    {
+        // Constants
+        const real_t zero(0);
+        const real_t eps = ulp<real_t>();
+        real_t tol = real_t(50 * n) * eps;
+        // Use a slightly larger tolerance for half precision
+        if (eps > real_t(1.0e-6)) tol = tol * real_t(5.);
+
+        GeevOpts opts;
+        opts.nb = nb;
+
+        // Matrices and vectors
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, n);
+        std::vector<T> VL_;
+        auto VL = new_matrix(VL_, n, n);
+        std::vector<T> VR_;
+        auto VR = new_matrix(VR_, n, n);
+        std::vector<complex_t> w(n), w2(n);
+
+        mm.random(A);
+        if (matrixType == "Reducible") {
+            // Isolate eigenvalues at both ends so that gebal permutes A
+            for (idx_t i = 1; i < n; ++i)
+                A(i, 0) = zero;
+            for (idx_t j = 0; j + 1 < n; ++j)
+                A(n - 1, j) = zero;
+        }
+        else if (matrixType == "Graded") {
+            // Badly scaled matrix so that gebal scales A
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < n; ++i)
+                    A(i, j) *= pow(real_t(2), int(i % 6) - int(j % 6));
+        }
+        const real_t normA = lange(FROB_NORM, A);
+
+        // Eigenvalues and both sets of eigenvectors
+        lacpy(GENERAL, A, B);
+        int info = geev(true, true, B, w, VL, VR, opts);
+        REQUIRE(info == 0);
+
+        // Eigenvalues only
+        lacpy(GENERAL, A, B);
+        info = geev(false, false, B, w2, VL, VR, opts);
+        REQUIRE(info == 0);
+        for (idx_t i = 0; i < n; ++i)
+            CHECK(abs(w[i] - w2[i]) <= tol * normA);
+
+        // Returns the j-th right or left eigenvector as a complex vector
+        auto eigenvector = [&](const matrix_t& V, idx_t j) {
+            std::vector<complex_t> v(n);
+            if constexpr (is_complex<T>) {
+                for (idx_t i = 0; i < n; ++i)
+                    v[i] = V(i, j);
+            }
+            else {
+                const bool first = (j + 1 < n) && imag(w[j]) > zero;
+                const bool second = (j > 0) && imag(w[j]) < zero;
+                for (idx_t i = 0; i < n; ++i) {
+                    if (first)
+                        v[i] = complex_t(V(i, j), V(i, j + 1));
+                    else if (second)
+                        v[i] = complex_t(V(i, j - 1), -V(i, j));
+                    else
+                        v[i] = V(i, j);
+                }
+            }
+            return v;
+        };
+
+        for (idx_t j = 0; j < n; ++j) {
+            // A * v = lambda * v, with ||v|| = 1
+            std::vector<complex_t> v = eigenvector(VR, j);
+            real_t res = zero, nv = zero;
+            for (idx_t i = 0; i < n; ++i) {
+                complex_t s = -w[j] * v[i];
+                for (idx_t k = 0; k < n; ++k)
+                    s += complex_t(A(i, k)) * v[k];
+                res += real(s * conj(s));
+                nv += real(v[i] * conj(v[i]));
+            }
+            CHECK(sqrt(res) <= tol * normA);
+            CHECK(abs(sqrt(nv) - real_t(1)) <= tol);
+
+            // u^H * A = lambda * u^H, with ||u|| = 1
+            std::vector<complex_t> u = eigenvector(VL, j);
+            res = zero;
+            nv = zero;
+            for (idx_t k = 0; k < n; ++k) {
+                complex_t s = -w[j] * conj(u[k]);
+                for (idx_t i = 0; i < n; ++i)
+                    s += conj(u[i]) * complex_t(A(i, k));
+                res += real(s * conj(s));
+                nv += real(u[k] * conj(u[k]));
+            }
+            CHECK(sqrt(res) <= tol * normA);
+            CHECK(abs(sqrt(nv) - real_t(1)) <= tol);
+        }
+
+        // Only right eigenvectors
+        std::vector<T> VR2_;
+        auto VR2 = new_matrix(VR2_, n, n);
+        lacpy(GENERAL, A, B);
+        info = geev(false, true, B, w2, VL, VR2, opts);
+        REQUIRE(info == 0);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                CHECK(abs(VR2(i, j) - VR(i, j)) <= tol);
+    }
+}
@@ -0,0 +1,125 @@
+/// @file test_gemm_blocked_mixed.cpp
+/// @brief Test GEMM blocked mixed
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Main <T>LAPACK header
+#include <tlapack/lapack/gemm_blocked_mixed.hpp>
+
+// Auxiliary <T>LAPACK headers
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+#if __has_include(<stdfloat>) && __cplusplus > 202002L
+    #define TEST_TYPES_bGEMM \
+        (std::tuple<double, float>), (std::tuple<float, std::bfloat16_t>)
+#else
+    #define TEST_TYPES_bGEMM (std::tuple<double, float>)
+#endif
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("GEMM blocked mixed works",
+                   "[blas][gemm_blocked_mixed][gemm][blocked][mixed]",
+                   TEST_TYPES_bGEMM)
+{
+    using T = typename std::tuple_element<0, TestType>::type;
+    using Tlow = typename std::tuple_element<1, TestType>::type;
+
+    using matrix_t =
+        tlapack::LegacyMatrix<T, std::size_t, tlapack::Layout::ColMajor>;
+    using matrixLow_t =
+        tlapack::LegacyMatrix<Tlow, std::size_t, tlapack::Layout::ColMajor>;
+
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+    typedef real_type<Tlow> realLow_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+    Create<matrixLow_t> new_matrixLow;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const Op transA = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+    const Op transB = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+    const idx_t m = GENERATE(1, 35);
+    const idx_t n = GENERATE(1, 29);
+    const idx_t k = GENERATE(0, 1, 70);
+    const idx_t nb = 16;
+
+    DYNAMIC_SECTION("transA = " << transA << " transB = " << transB
+                                << " m = " << m << " n = " << n
+                                << " k = " << k)
+    {
+        const real_t alpha(2);
+        const real_t beta(-1);
+
+        std::vector<Tlow> Alow_;
+        auto Alow = (transA == Op::NoTrans) ? new_matrixLow(Alow_, m, k)
+                                            : new_matrixLow(Alow_, k, m);
+        std::vector<T> A_;
+        auto A = (transA == Op::NoTrans) ? new_matrix(A_, m, k)
+                                         : new_matrix(A_, k, m);
+        std::vector<T> B_;
+        auto B = (transB == Op::NoTrans) ? new_matrix(B_, k, n)
+                                         : new_matrix(B_, n, k);
+        std::vector<T> C_;
+        auto C = new_matrix(C_, m, n);
+        std::vector<T> D_;
+        auto D = new_matrix(D_, m, n);
+        std::vector<T> E_;
+        auto E = new_matrix(E_, m, n);
+
+        // Workspaces in the working and in the low precision
+        std::vector<T> W_;
+        auto W = (transB == Op::NoTrans) ? new_matrix(W_, nb, n)
+                                         : new_matrix(W_, n, nb);
+        std::vector<Tlow> Wlow_;
+        auto Wlow = (transB == Op::NoTrans) ? new_matrixLow(Wlow_, nb, n)
+                                            : new_matrixLow(Wlow_, n, nb);
+
+        // A is exactly representable in the low precision
+        mm.randn(Alow);
+        lacpy(GENERAL, Alow, A);
+        mm.randn(B);
+        mm.randn(C);
+        lacpy(GENERAL, C, D);
+        lacpy(GENERAL, C, E);
+
+        // Reference
+        gemm(transA, transB, alpha, A, B, beta, C);
+        const real_t normC = lange(ONE_NORM, C);
+
+        // Blocked algorithm with workspace in the working precision
+        gemm_blocked_mixed(transA, transB, alpha, Alow, B, beta, D, W,
+                           GemmBlockedOpts{nb});
+
+        // Blocked algorithm with workspace in the low precision
+        gemm_blocked_mixed(transA, transB, alpha, Alow, B, beta, E, Wlow,
+                           GemmBlockedOpts{nb});
+
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i) {
+                D(i, j) -= C(i, j);
+                E(i, j) -= C(i, j);
+            }
+        const real_t errD = lange(ONE_NORM, D) / normC;
+        const real_t errE = lange(ONE_NORM, E) / normC;
+
+        INFO("Relative error with workspace in T = " << errD);
+        INFO("Relative error with workspace in Tlow = " << errE);
+
+        CHECK(errD <= real_t(4 * (k + 1)) * uroundoff<real_t>());
+        CHECK(errE <= real_t(4 * (k + 1)) * real_t(uroundoff<realLow_t>()));
+    }
+}
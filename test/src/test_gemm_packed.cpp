@@ -0,0 +1,115 @@
+/// @file test_gemm_packed.cpp
+/// @brief Test the packed general matrix-matrix multiply.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Other routines
+#include <tlapack/blas/gemm_packed.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("packed gemm matches the reference triple loop",
+                   "[gemm_packed]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    if constexpr (!traits::allow_gemm_packed<matrix_t, matrix_t, matrix_t, T,
+                                             T>) {
+        SKIP_TEST;
+    }
+    else {
+        // Functor
+        Create<matrix_t> new_matrix;
+
+        // MatrixMarket reader
+        MatrixMarket mm;
+
+        const idx_t m = GENERATE(1, 7, 70);
+        const idx_t n = GENERATE(1, 5, 41);
+        const idx_t k = GENERATE(0, 3, 300);
+        const Op transA = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+        const Op transB = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+        const SimdIsa isa =
+            GENERATE(SimdIsa::Generic, SimdIsa::SSE2, SimdIsa::NEON,
+                     SimdIsa::AVX2, SimdIsa::AVX512);
+
+        DYNAMIC_SECTION("m = " << m << " n = " << n << " k = " << k
+                               << " transA = " << transA
+                               << " transB = " << transB << " isa = " << isa)
+        {
+            if (!is_simd_isa_supported(isa)) SKIP_TEST;
+            const SimdIsa default_isa = simd_isa();
+            simd_isa() = isa;
+
+            const real_t eps = ulp<real_t>();
+            const real_t tol = real_t(4 * k + 2) * eps;
+
+            const T alpha = real_t(1.5);
+            const T beta = real_t(-0.75);
+
+            // Create matrices
+            std::vector<T> A_;
+            auto A = (transA == Op::NoTrans) ? new_matrix(A_, m, k)
+                                             : new_matrix(A_, k, m);
+            std::vector<T> B_;
+            auto B = (transB == Op::NoTrans) ? new_matrix(B_, k, n)
+                                             : new_matrix(B_, n, k);
+            std::vector<T> C_;
+            auto C = new_matrix(C_, m, n);
+            std::vector<T> R_;
+            auto R = new_matrix(R_, m, n);
+
+            mm.random(A);
+            mm.random(B);
+            mm.random(C);
+            lacpy(GENERAL, C, R);
+
+            // R := alpha op(A) op(B) + beta R computed with a triple loop
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < m; ++i) {
+                    T sum(0);
+                    for (idx_t l = 0; l < k; ++l) {
+                        const T a = (transA == Op::NoTrans) ? A(i, l)
+                                    : (transA == Op::Trans) ? A(l, i)
+                                                            : conj(A(l, i));
+                        const T b = (transB == Op::NoTrans) ? B(l, j)
+                                    : (transB == Op::Trans) ? B(j, l)
+                                                            : conj(B(j, l));
+                        sum += a * b;
+                    }
+                    R(i, j) = alpha * sum + beta * R(i, j);
+                }
+
+            gemm_packed(transA, transB, alpha, A, B, beta, C);
+
+            // Check the error entrywise
+            real_t error(0);
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < m; ++i)
+                    error = max(error, abs(C(i, j) - R(i, j)));
+            CHECK(error <= tol * real_t(k + 1));
+
+            // Check that StrongZero overwrites C
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < m; ++i)
+                    C(i, j) = real_t(NAN);
+            gemm_packed(transA, transB, alpha, A, B, StrongZero(), C);
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < m; ++i)
+                    CHECK(!isnan(C(i, j)));
+
+            simd_isa() = default_isa;
+        }
+    }
+}
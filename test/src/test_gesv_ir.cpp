@@ -0,0 +1,202 @@
+/// @file test_gesv_ir.cpp
+/// @brief Test the mixed-precision LU solver with iterative refinement
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/laset.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/geqrf.hpp>
+#include <tlapack/lapack/gesv_ir.hpp>
+#include <tlapack/lapack/ungqr.hpp>
+
+#if __has_include(<stdfloat>) && __cplusplus > 202002L
+    #define TEST_TYPES_GESV_IR                                      \
+        (std::tuple<double, float>),                                \
+            (std::tuple<std::complex<double>, std::complex<float>>), \
+            (std::tuple<float, std::bfloat16_t>)
+#else
+    #define TEST_TYPES_GESV_IR                                      \
+        (std::tuple<double, float>),                                \
+            (std::tuple<std::complex<double>, std::complex<float>>)
+#endif
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("mixed-precision LU solver with iterative refinement",
+                   "[gesv_ir][mixed]",
+                   TEST_TYPES_GESV_IR)
+{
+    using T = typename std::tuple_element<0, TestType>::type;
+    using Tlow = typename std::tuple_element<1, TestType>::type;
+
+    using matrix_t = LegacyMatrix<T, std::size_t, Layout::ColMajor>;
+    using matrixLow_t = LegacyMatrix<Tlow, std::size_t, Layout::ColMajor>;
+
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using real_low_t = real_type<Tlow>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functors
+    Create<matrix_t> new_matrix;
+    Create<matrixLow_t> new_matrixLow;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = GENERATE(1, 20, 100);
+    const idx_t nrhs = GENERATE(1, 3);
+    const std::string kind = GENERATE("well", "ill", "no_gmres");
+
+    DYNAMIC_SECTION("n = " << n << " nrhs = " << nrhs << " kind = " << kind)
+    {
+        const T zero(0);
+        const T one(1);
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(10) * sqrt(real_t(n)) * eps;
+
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> A0_;
+        auto A0 = new_matrix(A0_, n, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, nrhs);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, n, nrhs);
+        std::vector<Tlow> LU_;
+        auto LU = new_matrixLow(LU_, n, n);
+        std::vector<idx_t> piv(n);
+
+        if (kind == "well") {
+            // Diagonally dominant matrix
+            mm.random(A);
+            for (idx_t i = 0; i < n; ++i)
+                A(i, i) += real_t(n);
+        }
+        else {
+            // A = Q1 * diag(sigma) * Q2 with a condition number beyond the
+            // reach of the classical refinement in the low precision
+            const real_t kappa =
+                real_t(1.0e2) / real_t(uroundoff<real_low_t>());
+            std::vector<T> Q1_;
+            auto Q1 = new_matrix(Q1_, n, n);
+            std::vector<T> Q2_;
+            auto Q2 = new_matrix(Q2_, n, n);
+            std::vector<T> tau(n);
+            mm.random(Q1);
+            geqrf(Q1, tau);
+            ungqr(Q1, tau);
+            mm.random(Q2);
+            geqrf(Q2, tau);
+            ungqr(Q2, tau);
+            for (idx_t j = 0; j < n; ++j) {
+                const real_t sigma =
+                    (n > 1) ? pow(kappa, -real_t(j) / real_t(n - 1))
+                            : real_t(1);
+                for (idx_t i = 0; i < n; ++i)
+                    Q1(i, j) *= sigma;
+            }
+            gemm(NO_TRANS, NO_TRANS, one, Q1, Q2, zero, A);
+        }
+        mm.random(B);
+        lacpy(GENERAL, A, A0);
+
+        RefinementOpts opts;
+        if (kind == "no_gmres") opts.use_gmres = false;
+        REQUIRE(gesv_ir(A, LU, piv, B, X, opts) == 0);
+
+        if (kind == "well") {
+            CHECK(opts.solver == RefinementSolver::Refinement);
+            CHECK(opts.backward_error <= tol);
+        }
+        // For n = 1, the ill-conditioned matrix has condition number one
+        if (n > 1) {
+            if (kind == "ill")
+                CHECK(opts.solver == RefinementSolver::GMRES);
+            if (kind == "no_gmres")
+                CHECK(opts.solver == RefinementSolver::FullPrecision);
+        }
+        if (opts.solver != RefinementSolver::FullPrecision) {
+            // A is unchanged
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < n; ++i)
+                    CHECK(A(i, j) == A0(i, j));
+        }
+        if (kind == "no_gmres") CHECK(opts.n_gmres_iter == 0);
+
+        // Residual B - A X
+        std::vector<T> R_;
+        auto R = new_matrix(R_, n, nrhs);
+        lacpy(GENERAL, B, R);
+        gemm(NO_TRANS, NO_TRANS, -one, A0, X, one, R);
+        const real_t normA = lange(INF_NORM, A0);
+        for (idx_t j = 0; j < nrhs; ++j) {
+            const real_t rnrm = lange(MAX_NORM, cols(R, range(j, j + 1)));
+            const real_t xnrm = lange(MAX_NORM, cols(X, range(j, j + 1)));
+            CHECK(rnrm <= tol * normA * xnrm);
+        }
+    }
+}
+
+TEST_CASE("mixed-precision LU solver without fallback", "[gesv_ir][mixed]")
+{
+    using matrix_t = LegacyMatrix<double, std::size_t, Layout::ColMajor>;
+    using matrixLow_t = LegacyMatrix<float, std::size_t, Layout::ColMajor>;
+    using idx_t = size_type<matrix_t>;
+
+    // Functors
+    Create<matrix_t> new_matrix;
+    Create<matrixLow_t> new_matrixLow;
+
+    const idx_t n = 3;
+
+    std::vector<double> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<double> B_;
+    auto B = new_matrix(B_, n, 1);
+    std::vector<double> X_;
+    auto X = new_matrix(X_, n, 1);
+    std::vector<float> LU_;
+    auto LU = new_matrixLow(LU_, n, n);
+    std::vector<idx_t> piv(n);
+
+    RefinementOpts opts;
+    opts.fallback = false;
+
+    for (idx_t i = 0; i < n; ++i) {
+        B(i, 0) = 1;
+        X(i, 0) = -1;
+    }
+
+    SECTION("A overflows in the low precision")
+    {
+        laset(GENERAL, 0.0, 1.0e300, A);
+        CHECK(gesv_ir(A, LU, piv, B, X, opts) == int(n + 2));
+    }
+    SECTION("A is singular in the low precision")
+    {
+        laset(GENERAL, 1.0, 1.0, A);
+        A(1, 1) += 1.0e-10;
+        A(2, 2) += 2.0e-10;
+        CHECK(gesv_ir(A, LU, piv, B, X, opts) == int(n + 2));
+    }
+
+    // X is not modified
+    for (idx_t i = 0; i < n; ++i)
+        CHECK(X(i, 0) == -1);
+}
@@ -45,6 +45,8 @@ TEMPLATE_TEST_CASE("svd with small unitary matrix is backward stable",
     idx_t k = min(m, n);
 
     const int seed = GENERATE(2, 3, 4, 5, 6, 7, 8, 9, 10);
+    const GesvdVariant variant =
+        GENERATE(GesvdVariant::QRIteration, GesvdVariant::DivideConquer);
     PCG32 gen;
     gen.seed(seed);
 
@@ -72,9 +74,13 @@ TEMPLATE_TEST_CASE("svd with small unitary matrix is backward stable",
     lacpy(Uplo::General, A, A_copy);
     real_t normA = lange(Norm::Max, A);
 
-    DYNAMIC_SECTION("m = " << m << " n = " << n << " seed = " << seed)
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " seed = " << seed
+                           << " variant = " << (char)variant)
     {
-        int err = gesvd(true, true, A, s, U, Vt);
+        GesvdOpts opts;
+        opts.variant = variant;
+        opts.smlsiz = 2;
+        int err = gesvd(true, true, A, s, U, Vt, opts);
         CHECK(err == 0);
 
         // Check that singular values are positive and sorted in decreasing
@@ -140,6 +146,8 @@ TEMPLATE_TEST_CASE("svd with full unitary matrix is backward stable",
     idx_t k = min(m, n);
 
     const int seed = GENERATE(2, 3, 4, 5, 6, 7, 8, 9, 10);
+    const GesvdVariant variant =
+        GENERATE(GesvdVariant::QRIteration, GesvdVariant::DivideConquer);
     PCG32 gen;
     gen.seed(seed);
 
@@ -167,9 +175,13 @@ TEMPLATE_TEST_CASE("svd with full unitary matrix is backward stable",
     lacpy(Uplo::General, A, A_copy);
     real_t normA = lange(Norm::Max, A);
 
-    DYNAMIC_SECTION("m = " << m << " n = " << n << " seed = " << seed)
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " seed = " << seed
+                           << " variant = " << (char)variant)
     {
-        int err = gesvd(true, true, A, s, U, Vt);
+        GesvdOpts opts;
+        opts.variant = variant;
+        opts.smlsiz = 2;
+        int err = gesvd(true, true, A, s, U, Vt, opts);
         REQUIRE(err == 0);
 
         // Check that singular values are positive and sorted in decreasing
@@ -210,4 +222,90 @@ TEMPLATE_TEST_CASE("svd with full unitary matrix is backward stable",
         real_t repres = lange(Norm::Max, A_copy);
         CHECK(repres <= tol * normA);
     }
-}
\ No newline at end of file
+}
+
+TEMPLATE_TEST_CASE("svd of tall and wide matrices with QR preprocessing",
+                   "[svd]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    const auto [m, n] = GENERATE(std::pair<idx_t, idx_t>{60, 3},
+                                 std::pair<idx_t, idx_t>{3, 60},
+                                 std::pair<idx_t, idx_t>{40, 15},
+                                 std::pair<idx_t, idx_t>{15, 40});
+    const idx_t k = min(m, n);
+
+    PCG32 gen;
+    gen.seed(3);
+
+    const real_t eps = ulp<real_t>();
+    real_t tol = real_t(20. * max(m, n)) * eps;
+    // Use a slightly larger tolerance for half precision
+    if (eps > real_t(1.0e-6)) tol = tol * real_t(5.);
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, m, n);
+    std::vector<T> A_copy_;
+    auto A_copy = new_matrix(A_copy_, m, n);
+    std::vector<T> U_;
+    auto U = new_matrix(U_, m, k);
+    std::vector<T> Vt_;
+    auto Vt = new_matrix(Vt_, k, n);
+
+    std::vector<real_t> s(k);
+    std::vector<real_t> s_ref(k);
+
+    // Generate random m-by-n matrix
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < m; ++i)
+            A(i, j) = rand_helper<T>(gen);
+
+    lacpy(Uplo::General, A, A_copy);
+    real_t normA = lange(Norm::Max, A);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n)
+    {
+        // Singular values without the QR or LQ preprocessing
+        GesvdOpts opts;
+        opts.shapethresh = 1.0e30;
+        int err = gesvd(false, false, A, s_ref, U, Vt, opts);
+        REQUIRE(err == 0);
+
+        // Economy-size SVD with the QR or LQ preprocessing
+        lacpy(Uplo::General, A_copy, A);
+        err = gesvd(true, true, A, s, U, Vt);
+        REQUIRE(err == 0);
+
+        for (idx_t i = 0; i < k; ++i)
+            CHECK(abs(s[i] - s_ref[i]) <= tol * normA);
+
+        // Test for U's orthogonality
+        std::vector<T> Wu_;
+        auto Wu = new_matrix(Wu_, k, k);
+        auto orth_U = check_orthogonality(U, Wu);
+        CHECK(orth_U <= tol);
+
+        // Test for Vt's orthogonality
+        std::vector<T> Wvt_;
+        auto Wvt = new_matrix(Wvt_, k, k);
+        auto orth_Vt = check_orthogonality(Vt, Wvt);
+        CHECK(orth_Vt <= tol);
+
+        // Test U * S * V^H = A
+        std::vector<T> K_;
+        auto K = new_matrix(K_, m, k);
+        for (idx_t j = 0; j < k; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                K(i, j) = U(i, j) * s[j];
+        gemm(Op::NoTrans, Op::NoTrans, real_t(1.), K, Vt, real_t(-1.), A_copy);
+        real_t repres = lange(Norm::Max, A_copy);
+        CHECK(repres <= tol * normA);
+    }
+}
@@ -0,0 +1,85 @@
+/// @file test_getrs.cpp
+/// @brief Test the solution of linear systems with the LU factorization
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/getrf.hpp>
+#include <tlapack/lapack/getrs.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("Solution of op(A) X = B with the LU factorization",
+                   "[getrs]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = GENERATE(1, 5, 20, 100);
+    const idx_t nrhs = GENERATE(1, 3);
+    const Op trans = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+
+    DYNAMIC_SECTION("n = " << n << " nrhs = " << nrhs << " trans = " << trans)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(n) * eps;
+
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> LU_;
+        auto LU = new_matrix(LU_, n, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, nrhs);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, n, nrhs);
+
+        // Diagonally dominant matrix, so that op(A) is well conditioned
+        mm.random(A);
+        for (idx_t i = 0; i < n; ++i)
+            A(i, i) += real_t(n);
+        mm.random(B);
+
+        lacpy(GENERAL, A, LU);
+        lacpy(GENERAL, B, X);
+
+        std::vector<idx_t> piv(n);
+        REQUIRE(getrf(LU, piv) == 0);
+        REQUIRE(getrs(trans, LU, piv, X) == 0);
+
+        // R <----- B - op(A) X
+        std::vector<T> R_;
+        auto R = new_matrix(R_, n, nrhs);
+        lacpy(GENERAL, B, R);
+        gemm(trans, NO_TRANS, real_t(-1), A, X, real_t(1), R);
+
+        // error is || B - op(A) x || / ( ||A|| * ||x|| ) for each column
+        const real_t normA = lange(INF_NORM, A);
+        for (idx_t j = 0; j < nrhs; ++j) {
+            const real_t rnrm = lange(MAX_NORM, cols(R, range(j, j + 1)));
+            const real_t xnrm = lange(MAX_NORM, cols(X, range(j, j + 1)));
+            CHECK(rnrm <= tol * normA * xnrm);
+        }
+    }
+}
@@ -0,0 +1,108 @@
+/// @file test_heev.cpp
+/// @brief Test the Hermitian eigenvalue driver HEEV
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/heev.hpp>
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/lanhe.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("heev computes the eigendecomposition of a Hermitian matrix",
+                   "[symmetriceigenvalues][heev]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // Generators
+    const idx_t n = GENERATE(1, 9, 40);
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const HeevVariant variant =
+        GENERATE(HeevVariant::QRIteration, HeevVariant::DivideConquer);
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    DYNAMIC_SECTION("n = " << n << " uplo = " << uplo
+                           << " variant = " << (char)variant)
+    {
+        // Constants
+        const real_t one(1);
+        const real_t eps = ulp<real_t>();
+        real_t tol = real_t(20 * n) * eps;
+        // Use a slightly larger tolerance for half precision
+        if (eps > real_t(1.0e-6)) tol = tol * real_t(5.);
+
+        // Small blocks to exercise the blocked reduction and the recursion
+        HeevOpts opts;
+        opts.variant = variant;
+        opts.nb = 4;
+        opts.nx_switch = 8;
+        opts.smlsiz = 4;
+
+        // Matrices and vectors
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> Z_;
+        auto Z = new_matrix(Z_, n, n);
+        std::vector<real_t> w(n), w2(n);
+
+        // Fill A with random values and make it Hermitian
+        mm.random(A);
+        for (idx_t j = 0; j < n; ++j) {
+            for (idx_t i = j + 1; i < n; ++i)
+                A(i, j) = conj(A(j, i));
+            A(j, j) = real(A(j, j));
+        }
+        const real_t normA = lanhe(FROB_NORM, uplo, A);
+
+        // Eigenvalues and eigenvectors
+        lacpy(uplo, A, Z);
+        int info = heev(true, uplo, Z, w, opts);
+        REQUIRE(info == 0);
+
+        // Eigenvalues only
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, n);
+        lacpy(uplo, A, B);
+        info = heev(false, uplo, B, w2, opts);
+        REQUIRE(info == 0);
+
+        // The eigenvalues are sorted and do not depend on want_z
+        for (idx_t i = 0; i + 1 < n; ++i)
+            CHECK(w[i] <= w[i + 1]);
+        for (idx_t i = 0; i < n; ++i)
+            CHECK(abs(w[i] - w2[i]) <= tol * normA);
+
+        // Z is unitary
+        CHECK(check_orthogonality(Z) <= tol);
+
+        // A - Z * diag(w) * Z^H = 0
+        std::vector<T> R_;
+        auto R = new_matrix(R_, n, n);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                R(i, j) = Z(i, j) * w[j];
+        gemm(NO_TRANS, CONJ_TRANS, -one, R, Z, one, A);
+        CHECK(lange(FROB_NORM, A) <= tol * normA);
+    }
+}
@@ -48,6 +48,8 @@ TEMPLATE_TEST_CASE("QR, RQ, QL, LQ factorization of a general m-by-n matrix",
                  (variant_t(HouseholderQRVariant::Blocked, 2)),
                  (variant_t(HouseholderQRVariant::Blocked, 4)),
                  (variant_t(HouseholderQRVariant::Blocked, 5)),
+                 (variant_t(HouseholderQRVariant::Recursive, 4)),
+                 (variant_t(HouseholderQRVariant::Recursive, 30)),
                  (variant_t(HouseholderQRVariant::Level2, 1)));
     const idx_t m = GENERATE(5, 10, 20, 30);
     const idx_t n = GENERATE(5, 10, 20, 30);
@@ -57,15 +59,15 @@ TEMPLATE_TEST_CASE("QR, RQ, QL, LQ factorization of a general m-by-n matrix",
     // Variants for QR, QL, RQ, LQ
     const HouseholderQRVariant variant_qr = variant.first;
     const HouseholderQLVariant variant_ql =
-        (variant.first == HouseholderQRVariant::Blocked)
+        (variant.first != HouseholderQRVariant::Level2)
             ? HouseholderQLVariant::Blocked
             : HouseholderQLVariant::Level2;
     const HouseholderLQVariant variant_lq =
-        (variant.first == HouseholderQRVariant::Blocked)
+        (variant.first != HouseholderQRVariant::Level2)
             ? HouseholderLQVariant::Blocked
             : HouseholderLQVariant::Level2;
     const HouseholderRQVariant variant_rq =
-        (variant.first == HouseholderQRVariant::Blocked)
+        (variant.first != HouseholderQRVariant::Level2)
             ? HouseholderRQVariant::Blocked
             : HouseholderRQVariant::Level2;
 
@@ -1,6 +1,5 @@
-/// @file test_laed4.cpp
-/// @author Brian Dang, University of Colorado Denver, USA
-/// @brief Test LAED4.
+/// @file test_laed2.cpp
+/// @brief Test the deflation step of the divide and conquer method, LAED2.
 //
 // Copyright (c) 2025, University of Colorado Denver. All rights reserved.
 //
@@ -11,92 +10,125 @@
 // Test utilities and definitions (must come before <T>LAPACK headers)
 #include "testutils.hpp"
 
-// Auxiliary routines
-#include <algorithm>
-
 // Other routines
+#include <tlapack/blas/gemm.hpp>
 #include <tlapack/lapack/laed2.hpp>
+#include <tlapack/lapack/lange.hpp>
 #include <tlapack/lapack/laset.hpp>
 
 using namespace tlapack;
-using namespace std;
 
-template <typename matrix_t>
-void printMatrix(const matrix_t& A)
-{
-    using idx_t = tlapack::size_type<matrix_t>;
-    const idx_t m = tlapack::nrows(A);
-    const idx_t n = tlapack::ncols(A);
-
-    for (idx_t i = 0; i < n; ++i) {
-        std::cout << std::endl;
-        for (idx_t j = 0; j < n; ++j)
-            std::cout << A(i, j) << " ";
-    }
-}
-
-TEMPLATE_TEST_CASE(
-    "LAED4",
-    "[stedc,laed4]",
-    (tlapack::LegacyMatrix<double, std::size_t, tlapack::Layout::ColMajor>))
-// TLAPACK_TYPES_TO_TEST)
+TEMPLATE_TEST_CASE("LAED2 preserves the rank-one modified matrix",
+                   "[stedc,laed2]",
+                   TLAPACK_REAL_TYPES_TO_TEST)
 {
     using matrix_t = TestType;
-    using T = type_t<matrix_t>;
+    using real_t = type_t<matrix_t>;
     using idx_t = size_type<matrix_t>;
-    typedef real_type<T> real_t;  // equivalent to using real_t = real_type<T>;
 
     // Functor
     Create<matrix_t> new_matrix;
 
-    // MatrixMarket reader
-    MatrixMarket mm;
+    const real_t zero(0);
+    const real_t one(1);
 
-    // m and n represent no. rows and columns of the matrices we will be testing
-    // respectively
-    // idx_t n = GENERATE(2, 5, 30, 50, 100);
-    idx_t n = GENERATE(7);
+    const idx_t n = GENERATE(7, 20);
+    const real_t rho = real_t(GENERATE(-0.75, 2.5));
 
-    srand(3);
-    // real_t rho = real_t(GENERATE(15.7, 100));
-    real_t rho = real_t(GENERATE(15.7));
     DYNAMIC_SECTION("n = " << n << " rho = " << rho)
     {
-        // eps is the machine precision, and tol is the tolerance we accept
-        // for
-        // tests to pass
         const real_t eps = ulp<real_t>();
         const real_t tol = real_t(20 * n) * eps;
+        const idx_t n1 = n / 2;
 
-        const idx_t n1 = 3;
-        const idx_t ldq = n;
-
-        idx_t k = 0;
-
+        // Two sorted sets of eigenvalues with repeated entries, and an
+        // updating vector with a tiny entry. Both cause deflation.
         std::vector<real_t> d(n);
-        std::vector<real_t> Q_(n);
-        auto Q = new_matrix(Q_, n, n);
-        laset(GENERAL, real_t(0), real_t(1), Q);
-
-        // std::vector<real_t> Q2(n1 * n1 + (n - n1) * (n - n1));
-        std::vector<real_t> Q2(n * n);
-
         std::vector<real_t> z(n);
-        std::vector<real_t> w(n);
-        std::vector<idx_t> indxq(n), indx(n), indxc(n), indxp(n), coltyp(n);
-        for (idx_t i = 0; i < n; i++) {
-            indx[i] = i;
-            indxq[i] = i;
-            indxc[i] = i;
-            indxp[i] = i;
-            w[i] = real_t(0);
-            d[i] = i + 1;
-            z[i] = real_t(0.5 + i);
+        for (idx_t i = 0; i < n1; ++i)
+            d[i] = real_t(i);
+        for (idx_t i = n1; i < n; ++i)
+            d[i] = real_t(i - n1) + real_t(0.5) * real_t(i % 2);
+        for (idx_t i = 0; i < n; ++i)
+            z[i] = real_t(1 + i % 3);
+        z[1] = zero;
+
+        // Normalize each half of z
+        real_t s1(0), s2(0);
+        for (idx_t i = 0; i < n1; ++i)
+            s1 += z[i] * z[i];
+        for (idx_t i = n1; i < n; ++i)
+            s2 += z[i] * z[i];
+        for (idx_t i = 0; i < n1; ++i)
+            z[i] /= sqrt(s1);
+        for (idx_t i = n1; i < n; ++i)
+            z[i] /= sqrt(s2);
+
+        // A = diag(d) + |rho| * u * u^T, with u = [z1; sign(rho) * z2]
+        std::vector<real_t> A_;
+        auto A = new_matrix(A_, n, n);
+        for (idx_t j = 0; j < n; ++j) {
+            const real_t uj = (j < n1 || rho > zero) ? z[j] : -z[j];
+            for (idx_t i = 0; i < n; ++i) {
+                const real_t ui = (i < n1 || rho > zero) ? z[i] : -z[i];
+                A(i, j) = abs(rho) * ui * uj;
+            }
+            A(j, j) += d[j];
         }
+        const real_t normA = lange(MAX_NORM, A);
 
-        std::vector<real_t> dlambda(n);
-
-        int info = tlapack::laed2(k, n, n1, d, Q, ldq, indxq, rho, z, dlambda,
-                                  w, Q2, indx, indxc, indxp, coltyp);
+        std::vector<real_t> Q_;
+        auto Q = new_matrix(Q_, n, n);
+        laset(GENERAL, zero, one, Q);
+        std::vector<real_t> Q2_;
+        auto Q2 = new_matrix(Q2_, n, n);
+
+        std::vector<real_t> dlambda(n), w(n);
+        std::vector<idx_t> indxc(n);
+        std::array<idx_t, 4> ctot;
+        idx_t k;
+        real_t rho2 = rho;
+
+        int info = laed2(k, n1, d, Q, rho2, z, dlambda, w, Q2, indxc, ctot);
+        REQUIRE(info == 0);
+        CHECK(k < n);
+        CHECK(ctot[0] + ctot[1] + ctot[2] == k);
+        CHECK(ctot[3] == n - k);
+
+        // The poles of the secular equation are sorted
+        for (idx_t i = 0; i + 1 < k; ++i)
+            CHECK(dlambda[i] <= dlambda[i + 1]);
+
+        // P = Q2 with the columns in the same order as dlambda
+        std::vector<real_t> P_;
+        auto P = new_matrix(P_, n, n);
+        for (idx_t j = 0; j < k; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                P(i, indxc[j]) = Q2(i, j);
+        for (idx_t j = k; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                P(i, j) = Q(i, j);
+
+        // P is orthogonal
+        CHECK(check_orthogonality(P) <= tol);
+
+        // B = diag(dlambda, d[k:n]) + rho2 * [w; 0] * [w; 0]^T
+        std::vector<real_t> B_;
+        auto B = new_matrix(B_, n, n);
+        laset(GENERAL, zero, zero, B);
+        for (idx_t j = 0; j < k; ++j) {
+            for (idx_t i = 0; i < k; ++i)
+                B(i, j) = rho2 * w[i] * w[j];
+            B(j, j) += dlambda[j];
+        }
+        for (idx_t j = k; j < n; ++j)
+            B(j, j) = d[j];
+
+        // A - P * B * P^T = 0
+        std::vector<real_t> K_;
+        auto K = new_matrix(K_, n, n);
+        gemm(NO_TRANS, TRANSPOSE, one, B, P, K);
+        gemm(NO_TRANS, NO_TRANS, -one, P, K, one, A);
+        CHECK(lange(MAX_NORM, A) <= tol * normA);
     }
 }
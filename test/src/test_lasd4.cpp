@@ -0,0 +1,91 @@
+/// @file test_lasd4.cpp
+/// @brief Test LASD4.
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Other routines
+#include <tlapack/blas/her.hpp>
+#include <tlapack/lapack/hetd2.hpp>
+#include <tlapack/lapack/lasd4.hpp>
+#include <tlapack/lapack/steqr.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("LASD4", "[bdsdc][lasd4]", TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    const idx_t n = GENERATE(1, 2, 17, 59);
+    const real_t rho = real_t(GENERATE(0.25, 15.7));
+
+    DYNAMIC_SECTION("n = " << n << " rho = " << rho)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(20 * n) * eps;
+
+        std::vector<real_t> d(n);
+        std::vector<real_t> z(n);
+        std::vector<real_t> delta(n);
+        std::vector<real_t> work(n);
+        std::vector<real_t> sigma(n);
+        std::vector<real_t> lambda(n);
+        std::vector<real_t> e(n);
+        std::vector<real_t> tau(n);
+
+        // Poles in increasing order with d[0] = 0, as in lasd3(), and a z of
+        // norm 1
+        real_t sum(0);
+        for (idx_t i = 0; i < n; ++i) {
+            d[i] = real_t(i) / real_t(n) + real_t(i * i) / real_t(4 * n * n);
+            z[i] = real_t(2 * i + 1);
+            sum += z[i] * z[i];
+        }
+        for (idx_t i = 0; i < n; ++i)
+            z[i] /= sqrt(sum);
+
+        for (idx_t i = 0; i < n; ++i) {
+            REQUIRE(lasd4(i, d, z, delta, rho, sigma[i], work) == 0);
+
+            // delta and work are consistent with sigma
+            for (idx_t j = 0; j < n; ++j) {
+                CHECK(abs(delta[j] - (d[j] - sigma[i])) <= tol * sigma[i]);
+                CHECK(abs(work[j] - (d[j] + sigma[i])) <= tol * sigma[i]);
+            }
+        }
+
+        // The squares of the singular values are the eigenvalues of
+        // diag(d)**2 + rho * z * z**T
+        std::vector<real_t> A_;
+        auto A = new_matrix(A_, n, n);
+        laset(GENERAL, real_t(0), real_t(0), A);
+        her(LOWER_TRIANGLE, rho, z, A);
+        for (idx_t i = 0; i < n; ++i)
+            A(i, i) += d[i] * d[i];
+        hetd2(LOWER_TRIANGLE, A, tau);
+        for (idx_t i = 0; i < n; ++i)
+            lambda[i] = A(i, i);
+        for (idx_t i = 0; i + 1 < n; ++i)
+            e[i] = A(i + 1, i);
+        steqr(false, lambda, e, A);
+
+        const real_t maxLam = max(abs(lambda[0]), abs(lambda[n - 1]));
+        for (idx_t i = 0; i < n; ++i) {
+            CHECK(sigma[i] > d[i]);
+            if (i + 1 < n) CHECK(sigma[i] < d[i + 1]);
+            CHECK(abs(sigma[i] * sigma[i] - lambda[i]) <= tol * maxLam);
+        }
+    }
+}
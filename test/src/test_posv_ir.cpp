@@ -0,0 +1,203 @@
+/// @file test_posv_ir.cpp
+/// @brief Test the mixed-precision Cholesky solver with iterative refinement
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/laset.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/geqrf.hpp>
+#include <tlapack/lapack/posv_ir.hpp>
+#include <tlapack/lapack/ungqr.hpp>
+
+#if __has_include(<stdfloat>) && __cplusplus > 202002L
+    #define TEST_TYPES_POSV_IR                                      \
+        (std::tuple<double, float>),                                \
+            (std::tuple<std::complex<double>, std::complex<float>>), \
+            (std::tuple<float, std::bfloat16_t>)
+#else
+    #define TEST_TYPES_POSV_IR                                      \
+        (std::tuple<double, float>),                                \
+            (std::tuple<std::complex<double>, std::complex<float>>)
+#endif
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("mixed-precision Cholesky solver with iterative refinement",
+                   "[posv_ir][mixed]",
+                   TEST_TYPES_POSV_IR)
+{
+    using T = typename std::tuple_element<0, TestType>::type;
+    using Tlow = typename std::tuple_element<1, TestType>::type;
+
+    using matrix_t = LegacyMatrix<T, std::size_t, Layout::ColMajor>;
+    using matrixLow_t = LegacyMatrix<Tlow, std::size_t, Layout::ColMajor>;
+
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using real_low_t = real_type<Tlow>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functors
+    Create<matrix_t> new_matrix;
+    Create<matrixLow_t> new_matrixLow;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = GENERATE(1, 20, 100);
+    const idx_t nrhs = GENERATE(1, 3);
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const std::string kind = GENERATE("well", "ill", "no_gmres");
+
+    DYNAMIC_SECTION("n = " << n << " nrhs = " << nrhs << " uplo = " << uplo
+                           << " kind = " << kind)
+    {
+        const T zero(0);
+        const T one(1);
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(10) * sqrt(real_t(n)) * eps;
+
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> A0_;
+        auto A0 = new_matrix(A0_, n, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, nrhs);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, n, nrhs);
+        std::vector<Tlow> C_;
+        auto C = new_matrixLow(C_, n, n);
+
+        if (kind == "well") {
+            // Diagonally dominant Hermitian matrix
+            mm.random(A);
+            for (idx_t j = 0; j < n; ++j) {
+                for (idx_t i = 0; i < j; ++i)
+                    A(i, j) = conj(A(j, i));
+                A(j, j) = real(A(j, j)) + real_t(n);
+            }
+        }
+        else {
+            // A = Q * diag(sigma) * Q^H with a condition number beyond the
+            // reach of the classical refinement in the low precision
+            const real_t kappa =
+                real_t(1.0e2) / real_t(uroundoff<real_low_t>());
+            std::vector<T> Q_;
+            auto Q = new_matrix(Q_, n, n);
+            std::vector<T> QS_;
+            auto QS = new_matrix(QS_, n, n);
+            std::vector<T> tau(n);
+            mm.random(Q);
+            geqrf(Q, tau);
+            ungqr(Q, tau);
+            lacpy(GENERAL, Q, QS);
+            for (idx_t j = 0; j < n; ++j) {
+                const real_t sigma =
+                    (n > 1) ? pow(kappa, -real_t(j) / real_t(n - 1))
+                            : real_t(1);
+                for (idx_t i = 0; i < n; ++i)
+                    QS(i, j) *= sigma;
+            }
+            gemm(NO_TRANS, CONJ_TRANS, one, QS, Q, zero, A);
+            for (idx_t j = 0; j < n; ++j) {
+                for (idx_t i = 0; i < j; ++i)
+                    A(i, j) = conj(A(j, i));
+                A(j, j) = real(A(j, j));
+            }
+        }
+        mm.random(B);
+        lacpy(GENERAL, A, A0);
+
+        RefinementOpts opts;
+        if (kind == "no_gmres") opts.use_gmres = false;
+        REQUIRE(posv_ir(uplo, A, C, B, X, opts) == 0);
+
+        if (kind == "well") {
+            CHECK(opts.solver == RefinementSolver::Refinement);
+            CHECK(opts.backward_error <= tol);
+        }
+        if (opts.solver != RefinementSolver::FullPrecision) {
+            // A is unchanged
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < n; ++i)
+                    CHECK(A(i, j) == A0(i, j));
+        }
+        if (kind == "no_gmres") CHECK(opts.n_gmres_iter == 0);
+
+        // Residual B - A X
+        std::vector<T> R_;
+        auto R = new_matrix(R_, n, nrhs);
+        lacpy(GENERAL, B, R);
+        gemm(NO_TRANS, NO_TRANS, -one, A0, X, one, R);
+        const real_t normA = lange(INF_NORM, A0);
+        for (idx_t j = 0; j < nrhs; ++j) {
+            const real_t rnrm = lange(MAX_NORM, cols(R, range(j, j + 1)));
+            const real_t xnrm = lange(MAX_NORM, cols(X, range(j, j + 1)));
+            CHECK(rnrm <= tol * normA * xnrm);
+        }
+    }
+}
+
+TEST_CASE("mixed-precision Cholesky solver without fallback",
+          "[posv_ir][mixed]")
+{
+    using matrix_t = LegacyMatrix<double, std::size_t, Layout::ColMajor>;
+    using matrixLow_t = LegacyMatrix<float, std::size_t, Layout::ColMajor>;
+    using idx_t = size_type<matrix_t>;
+
+    // Functors
+    Create<matrix_t> new_matrix;
+    Create<matrixLow_t> new_matrixLow;
+
+    const idx_t n = 3;
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+
+    std::vector<double> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<double> B_;
+    auto B = new_matrix(B_, n, 1);
+    std::vector<double> X_;
+    auto X = new_matrix(X_, n, 1);
+    std::vector<float> C_;
+    auto C = new_matrixLow(C_, n, n);
+
+    RefinementOpts opts;
+    opts.fallback = false;
+
+    for (idx_t i = 0; i < n; ++i) {
+        B(i, 0) = 1;
+        X(i, 0) = -1;
+    }
+
+    SECTION("A overflows in the low precision")
+    {
+        laset(GENERAL, 0.0, 1.0e300, A);
+        CHECK(posv_ir(uplo, A, C, B, X, opts) == int(n + 2));
+    }
+    SECTION("A is not positive definite in the low precision")
+    {
+        laset(GENERAL, 1.0, 1.0, A);
+        A(1, 1) += 1.0e-10;
+        A(2, 2) += 2.0e-10;
+        CHECK(posv_ir(uplo, A, C, B, X, opts) == int(n + 2));
+    }
+
+    // X is not modified
+    for (idx_t i = 0; i < n; ++i)
+        CHECK(X(i, 0) == -1);
+}
@@ -19,6 +19,7 @@
 
 // Other routines
 #include <tlapack/lapack/gehrd.hpp>
+#include <tlapack/lapack/multishift_qr.hpp>
 #include <tlapack/lapack/qr_iteration.hpp>
 
 using namespace tlapack;
@@ -49,13 +50,15 @@ TEMPLATE_TEST_CASE("QR algorithm",
         (test_tuple_t("Random", 30)));
     const int seed = GENERATE(2, 3);
 
-    using variant_t = std::tuple<QRIterationVariant, idx_t, idx_t>;
+    using variant_t = std::tuple<QRIterationVariant, idx_t, idx_t, int>;
     const variant_t variant =
-        GENERATE((variant_t(QRIterationVariant::DoubleShift, 0, 0)),
-                 (variant_t(QRIterationVariant::MultiShift, 4, 4)),
-                 (variant_t(QRIterationVariant::MultiShift, 4, 2)),
-                 (variant_t(QRIterationVariant::MultiShift, 2, 4)),
-                 (variant_t(QRIterationVariant::MultiShift, 2, 2)));
+        GENERATE((variant_t(QRIterationVariant::DoubleShift, 0, 0, 1)),
+                 (variant_t(QRIterationVariant::MultiShift, 4, 4, 1)),
+                 (variant_t(QRIterationVariant::MultiShift, 4, 2, 1)),
+                 (variant_t(QRIterationVariant::MultiShift, 2, 4, 1)),
+                 (variant_t(QRIterationVariant::MultiShift, 2, 2, 1)),
+                 (variant_t(QRIterationVariant::MultiShift, 4, 4, 3)),
+                 (variant_t(QRIterationVariant::MultiShift, 2, 2, 3)));
 
     const std::string matrix_type = std::get<0>(test_tuple);
     const idx_t n = std::get<1>(test_tuple);
@@ -65,6 +68,7 @@ TEMPLATE_TEST_CASE("QR algorithm",
     const real_t one(1);
     const idx_t ns = std::get<1>(variant);
     const idx_t nw = std::get<2>(variant);
+    const int nthreads = std::get<3>(variant);
 
     // Only run the large random test once
     if (matrix_type == "Large Random" && seed != 2) SKIP_TEST;
@@ -122,6 +126,7 @@ TEMPLATE_TEST_CASE("QR algorithm",
     DYNAMIC_SECTION("matrix = " << matrix_type << " n = " << n << " ilo = "
                                 << ilo << " ihi = " << ihi << " ns = " << ns
                                 << " nw = " << nw << " seed = " << seed
+                                << " nthreads = " << nthreads
                                 << " variant = " << (char)std::get<0>(variant))
     {
         QRIterationOpts opts;
@@ -133,6 +138,7 @@ TEMPLATE_TEST_CASE("QR algorithm",
             return nw;
         };
         opts.nmin = 15;
+        opts.nthreads = nthreads;
 
         int ierr = qr_iteration(true, true, ilo, ihi, H, s, Q, opts);
         CHECK(ierr == 0);
@@ -193,3 +199,98 @@ TEMPLATE_TEST_CASE("QR algorithm",
         }
     }
 }
+
+TEMPLATE_TEST_CASE("multishift QR with AED reports its timers",
+                   "[eigenvalues][multishift_qr]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using complex_t = complex_type<real_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = 150;
+    const real_t zero(0);
+    const real_t one(1);
+    const idx_t nmin_aed_reorder = GENERATE(4, 384);
+
+    DYNAMIC_SECTION("n = " << n << " nmin_aed_reorder = " << nmin_aed_reorder)
+    {
+        mm.gen.seed(4);
+
+        // Define the matrices
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> H_;
+        auto H = new_matrix(H_, n, n);
+        std::vector<T> Q_;
+        auto Q = new_matrix(Q_, n, n);
+
+        mm.hessenberg(A);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = j + 2; i < n; ++i)
+                A(i, j) = zero;
+
+        lacpy(GENERAL, A, H);
+        std::vector<complex_t> s(n);
+        laset(GENERAL, zero, one, Q);
+
+        // The timers are reset on entry and set on exit. The recommenders
+        // also serve the recursive calls on the AED windows.
+        FrancisOpts opts;
+        opts.nshift_recommender = [](idx_t n, idx_t nh) -> idx_t {
+            return (n < 30) ? 2 : 10;
+        };
+        opts.deflation_window_recommender = [](idx_t n, idx_t nh) -> idx_t {
+            return (n < 30) ? 4 : 24;
+        };
+        opts.nmin = 15;
+        opts.nmin_aed_reorder = nmin_aed_reorder;
+        opts.t_aed = -1;
+        opts.t_aed_schur = -1;
+        opts.t_aed_deflate = -1;
+        opts.t_aed_update = -1;
+        opts.t_sweep = -1;
+
+        int ierr = multishift_qr(true, true, 0, n, H, s, Q, opts);
+        REQUIRE(ierr == 0);
+
+        CHECK(opts.n_aed > 0);
+        CHECK(opts.n_sweep > 0);
+        CHECK(opts.t_aed > 0);
+        CHECK(opts.t_aed_schur >= 0);
+        CHECK(opts.t_aed_deflate >= 0);
+        CHECK(opts.t_aed_update >= 0);
+        CHECK(opts.t_sweep > 0);
+        CHECK(opts.t_aed_schur + opts.t_aed_deflate + opts.t_aed_update <=
+              opts.t_aed);
+
+        // Clean the lower triangular part that was used a workspace
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = j + 2; i < n; ++i)
+                H(i, j) = zero;
+
+        const real_t eps = uroundoff<real_t>();
+        const real_t tol = real_t(n * 1.0e2) * eps;
+
+        std::vector<T> res_;
+        auto res = new_matrix(res_, n, n);
+        std::vector<T> work_;
+        auto work = new_matrix(work_, n, n);
+
+        // Calculate residuals
+        auto orth_res_norm = check_orthogonality(Q, res);
+        CHECK(orth_res_norm <= tol);
+
+        auto normA = tlapack::lange(tlapack::FROB_NORM, A);
+        auto simil_res_norm = check_similarity_transform(A, Q, H, res, work);
+        CHECK(simil_res_norm <= tol * normA);
+    }
+}
@@ -45,15 +45,22 @@ TEMPLATE_TEST_CASE("Application of rotation sequence is accurate",
     const Side side = GENERATE(Side::Left, Side::Right);
     const Direction direction =
         GENERATE(Direction::Forward, Direction::Backward);
-    const idx_t n = GENERATE(1, 2, 3, 4, 5, 10, 13);
-    const idx_t m = GENERATE(1, 2, 3, 4, 5, 10, 13);
+    const idx_t n = GENERATE(1, 2, 3, 4, 5, 10, 13, 300);
+    const idx_t m = GENERATE(1, 2, 3, 4, 5, 10, 13, 300);
     const idx_t l = GENERATE(1, 2, 3, 4);
+    const SimdIsa isa = GENERATE(SimdIsa::Generic, SimdIsa::SSE2,
+                                 SimdIsa::NEON, SimdIsa::AVX2, SimdIsa::AVX512);
 
     DYNAMIC_SECTION("m = " << m << " n = " << n << " l = " << l << " side = "
-                           << side << " direction = " << direction)
+                           << side << " direction = " << direction
+                           << " isa = " << isa)
     {
         const idx_t k = (side == Side::Left) ? m - 1 : n - 1;
 
+        if (!is_simd_isa_supported(isa)) SKIP_TEST;
+        const SimdIsa default_isa = simd_isa();
+        simd_isa() = isa;
+
         const real_t eps = ulp<real_t>();
         const real_t tol = real_t(k) * eps;
 
@@ -100,5 +107,7 @@ TEMPLATE_TEST_CASE("Application of rotation sequence is accurate",
         real_t res_norm = lange(MAX_NORM, B);
 
         CHECK(res_norm <= tol * bnorm);
+
+        simd_isa() = default_isa;
     }
 }
@@ -0,0 +1,229 @@
+/// @file test_schur_reorder.cpp
+/// @brief Test the blocked reordering of the Schur form
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lahqr_eig22.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/lapack/schur_reorder.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("blocked reordering of the Schur form",
+                   "[eigenvalues]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using complex_t = complex_type<real_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const T zero(0);
+    const T one(1);
+
+    const idx_t n = GENERATE(1, 10, 45, 120);
+    const idx_t nb_window = GENERATE(4, 9, 64);
+    const idx_t nb_select = GENERATE(1, 3, 32);
+    const int seed = GENERATE(1, 2);
+
+    DYNAMIC_SECTION("n = " << n << " nb_window = " << nb_window
+                           << " nb_select = " << nb_select
+                           << " seed = " << seed)
+    {
+        mm.gen.seed(seed);
+
+        const real_t eps = uroundoff<real_t>();
+        const real_t tol = real_t(1.0e2 * n) * eps;
+
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> Q_;
+        auto Q = new_matrix(Q_, n, n);
+        std::vector<T> A_copy_;
+        auto A_copy = new_matrix(A_copy_, n, n);
+
+        // Generate random matrix in Schur form
+        mm.random(A);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = j + 1; i < n; ++i)
+                A(i, j) = zero;
+
+        // Add standardized 2x2 blocks in the real case
+        if (is_real<T>) {
+            for (idx_t i = 0; i + 1 < n; i += 5) {
+                A(i + 1, i + 1) = A(i, i);
+                A(i + 1, i) = -A(i, i + 1);
+            }
+        }
+
+        lacpy(GENERAL, A, A_copy);
+        laset(GENERAL, zero, one, Q);
+
+        // Eigenvalues of the diagonal blocks of A in rows i0:i1
+        auto eigenvalues = [&](idx_t i0, idx_t i1) {
+            std::vector<complex_t> ev;
+            idx_t i = i0;
+            while (i < i1) {
+                if (is_real<T> && i + 1 < n && A(i + 1, i) != zero) {
+                    complex_t s1, s2;
+                    lahqr_eig22(A(i, i), A(i, i + 1), A(i + 1, i),
+                                A(i + 1, i + 1), s1, s2);
+                    ev.push_back(s1);
+                    ev.push_back(s2);
+                    i = i + 2;
+                }
+                else {
+                    ev.push_back(complex_t(A(i, i)));
+                    i = i + 1;
+                }
+            }
+            return ev;
+        };
+
+        // Select about two thirds of the eigenvalues
+        std::vector<bool> select(n, false);
+        for (idx_t i = 0; i < n; ++i)
+            select[i] = (rand_helper<real_t>(mm.gen) > real_t(0.33));
+
+        // Selected eigenvalues, in order
+        std::vector<complex_t> ev_selected;
+        {
+            idx_t i = 0;
+            while (i < n) {
+                idx_t nb = (is_real<T> && i + 1 < n && A(i + 1, i) != zero)
+                               ? 2
+                               : 1;
+                if (select[i] || (nb == 2 && select[i + 1])) {
+                    auto ev = eigenvalues(i, i + nb);
+                    ev_selected.insert(ev_selected.end(), ev.begin(),
+                                       ev.end());
+                }
+                i = i + nb;
+            }
+        }
+
+        SchurReorderOpts opts;
+        opts.nb_window = nb_window;
+        opts.nb_select = nb_select;
+        idx_t m;
+        int info = schur_reorder(true, A, Q, select, m, opts);
+        REQUIRE(info == 0);
+        REQUIRE(m == (idx_t)ev_selected.size());
+
+        // A is still in Schur form
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = j + 2; i < n; ++i)
+                CHECK(A(i, j) == zero);
+        if (m > 0 && m < n) CHECK(A(m, m - 1) == zero);
+
+        // The selected eigenvalues appear first and keep their order
+        const real_t normA = lange(FROB_NORM, A_copy);
+        auto ev = eigenvalues(0, m);
+        for (idx_t i = 0; i < m; ++i)
+            CHECK(abs(ev[i] - ev_selected[i]) <= tol * normA);
+
+        // Calculate residuals
+        std::vector<T> res_;
+        auto res = new_matrix(res_, n, n);
+        std::vector<T> work_;
+        auto work = new_matrix(work_, n, n);
+        auto orth_res_norm = check_orthogonality(Q, res);
+        CHECK(orth_res_norm <= tol);
+
+        auto simil_res_norm =
+            check_similarity_transform(A_copy, Q, A, res, work);
+        CHECK(simil_res_norm <= tol * normA);
+    }
+}
+
+TEMPLATE_TEST_CASE("reordering moves a 2x2 block wider than nb_select",
+                   "[eigenvalues]",
+                   TLAPACK_REAL_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const T zero(0);
+    const T one(1);
+    const idx_t n = 6;
+
+    const real_t eps = uroundoff<real_t>();
+    const real_t tol = real_t(1.0e2 * n) * eps;
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<T> Q_;
+    auto Q = new_matrix(Q_, n, n);
+    std::vector<T> A_copy_;
+    auto A_copy = new_matrix(A_copy_, n, n);
+
+    // Upper triangular matrix with a standardized 2x2 block in rows 3:5
+    mm.random(A);
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = j + 1; i < n; ++i)
+            A(i, j) = zero;
+    A(4, 4) = A(3, 3);
+    A(4, 3) = -A(3, 4);
+
+    lacpy(GENERAL, A, A_copy);
+    laset(GENERAL, zero, one, Q);
+
+    // Only the 2x2 block is selected, and it is wider than nb_select
+    std::vector<bool> select(n, false);
+    select[3] = true;
+
+    SchurReorderOpts opts;
+    opts.nb_select = 1;
+    idx_t m;
+    int info = schur_reorder(true, A, Q, select, m, opts);
+    REQUIRE(info == 0);
+    REQUIRE(m == 2);
+
+    // The 2x2 block is now in the top left corner
+    CHECK(A(1, 0) != zero);
+    CHECK(A(2, 1) == zero);
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = j + 2; i < n; ++i)
+            CHECK(A(i, j) == zero);
+
+    // Calculate residuals
+    const real_t normA = lange(FROB_NORM, A_copy);
+    std::vector<T> res_;
+    auto res = new_matrix(res_, n, n);
+    std::vector<T> work_;
+    auto work = new_matrix(work_, n, n);
+    auto orth_res_norm = check_orthogonality(Q, res);
+    CHECK(orth_res_norm <= tol);
+
+    auto simil_res_norm = check_similarity_transform(A_copy, Q, A, res, work);
+    CHECK(simil_res_norm <= tol * normA);
+}
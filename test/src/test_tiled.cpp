@@ -0,0 +1,329 @@
+/// @file test_tiled.cpp
+/// @brief Test the tiled factorizations that run on a TaskRuntime
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <thread>
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/lanhe.hpp>
+#include <tlapack/lapack/laset.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/blas/swap.hpp>
+#include <tlapack/lapack/geqrf_tiled.hpp>
+#include <tlapack/lapack/getrf_tiled.hpp>
+#include <tlapack/lapack/mult_llh.hpp>
+#include <tlapack/lapack/mult_uhu.hpp>
+#include <tlapack/lapack/potrf_tiled.hpp>
+
+using namespace tlapack;
+
+TEST_CASE("TaskRuntime respects the order of the accesses", "[tiled]")
+{
+    TaskRuntime rt(4);
+
+    // Each task appends to x the value it reads from y, so that the final
+    // content of x depends only on the order of the accesses
+    for (int rep = 0; rep < 20; ++rep) {
+        std::vector<int> x;
+        int y = 0;
+        for (int k = 0; k < 50; ++k) {
+            rt.submit([&y, k] { y = y * 3 % 1009 + k; },
+                      {{&y, TaskRuntime::Access::ReadWrite}});
+            rt.submit([&x, &y] { x.push_back(y); },
+                      {{&y, TaskRuntime::Access::Read},
+                       {&x, TaskRuntime::Access::ReadWrite}});
+        }
+        rt.wait();
+
+        int z = 0;
+        REQUIRE(x.size() == 50);
+        for (int k = 0; k < 50; ++k) {
+            z = z * 3 % 1009 + k;
+            CHECK(x[k] == z);
+        }
+    }
+
+    // Exceptions are rethrown by wait()
+    rt.submit([] { throw std::runtime_error("task"); }, {});
+    CHECK_THROWS_AS(rt.wait(), std::runtime_error);
+}
+
+TEST_CASE("Tiled routines can be called from several threads", "[tiled]")
+{
+    using matrix_t = LegacyMatrix<double, std::size_t, Layout::ColMajor>;
+    using idx_t = size_type<matrix_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    const idx_t n = 60;
+    const int nthreads = 4;
+    const double tol = double(n) * ulp<double>();
+
+    // Each thread factors its own matrix with the default runtime. CHECK is
+    // only used in the main thread.
+    std::vector<double> error(nthreads, 0);
+    std::vector<int> info(nthreads, 0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nthreads; ++t) {
+        threads.emplace_back([&, t] {
+            MatrixMarket mm;
+            mm.gen.seed(t + 1);
+
+            std::vector<double> A_;
+            auto A = new_matrix(A_, n, n);
+            std::vector<double> C_;
+            auto C = new_matrix(C_, n, n);
+
+            TiledOpts opts;
+            opts.nb = 8;
+            for (int rep = 0; rep < 5; ++rep) {
+                mm.random(Uplo::Lower, A);
+                for (idx_t j = 0; j < n; ++j)
+                    A(j, j) += double(n);
+                lacpy(GENERAL, A, C);
+
+                info[t] += potrf_tiled(Uplo::Lower, C, opts);
+                mult_llh(C);
+                for (idx_t j = 0; j < n; j++)
+                    for (idx_t i = j; i < n; i++)
+                        C(i, j) -= A(i, j);
+                error[t] = max(error[t], lanhe(MAX_NORM, Uplo::Lower, C) /
+                                             lanhe(MAX_NORM, Uplo::Lower, A));
+            }
+        });
+    }
+    for (auto& th : threads)
+        th.join();
+
+    for (int t = 0; t < nthreads; ++t) {
+        CHECK(info[t] == 0);
+        CHECK(error[t] <= tol);
+    }
+}
+
+TEMPLATE_TEST_CASE("Tiled Cholesky factorization",
+                   "[potrf][tiled]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    TaskRuntime rt(3);
+
+    const idx_t n = GENERATE(10, 19, 30);
+    const idx_t nb = GENERATE(4, 5, 32);
+    const Uplo uplo = GENERATE(Uplo::Upper, Uplo::Lower);
+
+    DYNAMIC_SECTION("n = " << n << " nb = " << nb << " uplo = " << uplo)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(n) * eps;
+
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> C_;
+        auto C = new_matrix(C_, n, n);
+
+        // Random Hermitian positive definite matrix
+        mm.random(uplo, A);
+        for (idx_t j = 0; j < n; ++j)
+            A(j, j) += real_t(n);
+
+        lacpy(GENERAL, A, C);
+        const real_t normA = lanhe(MAX_NORM, uplo, A);
+
+        TiledOpts opts;
+        opts.nb = nb;
+        opts.runtime = &rt;
+        REQUIRE(potrf_tiled(uplo, C, opts) == 0);
+
+        // Do L*L^H or U^H*U
+        (uplo == LOWER_TRIANGLE) ? mult_llh(C) : mult_uhu(C);
+
+        for (idx_t i = 0; i < n; i++)
+            for (idx_t j = 0; j < n; j++) {
+                if (uplo == LOWER_TRIANGLE && i >= j)
+                    C(i, j) -= A(i, j);
+                else if (uplo == UPPER_TRIANGLE && i <= j)
+                    C(i, j) -= A(i, j);
+            }
+
+        CHECK(lanhe(MAX_NORM, uplo, C) / normA <= tol);
+    }
+}
+
+TEMPLATE_TEST_CASE("Tiled LU factorization",
+                   "[getrf][tiled]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    TaskRuntime rt(3);
+
+    const idx_t m = GENERATE(10, 23);
+    const idx_t n = GENERATE(10, 17, 30);
+    const idx_t nb = GENERATE(4, 5, 32);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " nb = " << nb)
+    {
+        const T zero(0);
+        const T one(1);
+        const idx_t k = min(m, n);
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(max(m, n)) * eps;
+
+        std::vector<T> A_;
+        auto A = new_matrix(A_, m, n);
+        std::vector<T> LU_;
+        auto LU = new_matrix(LU_, m, n);
+
+        mm.random(A);
+        lacpy(GENERAL, A, LU);
+        const real_t normA = lange(MAX_NORM, A);
+
+        TiledOpts opts;
+        opts.nb = nb;
+        opts.runtime = &rt;
+        std::vector<idx_t> piv(k, idx_t(0));
+        REQUIRE(getrf_tiled(LU, piv, opts) == 0);
+
+        // Split the factors
+        std::vector<T> L_;
+        auto L = new_matrix(L_, m, k);
+        std::vector<T> U_;
+        auto U = new_matrix(U_, k, n);
+        laset(GENERAL, zero, one, L);
+        laset(GENERAL, zero, zero, U);
+        for (idx_t j = 0; j < k; ++j)
+            for (idx_t i = j + 1; i < m; ++i)
+                L(i, j) = LU(i, j);
+        lacpy(UPPER_TRIANGLE, rows(LU, range{0, k}), U);
+
+        // P A - L U
+        for (idx_t j = 0; j < k; ++j) {
+            CHECK(piv[j] >= j);
+            CHECK(piv[j] < m);
+            if (piv[j] != j) {
+                auto vect1 = row(A, j);
+                auto vect2 = row(A, piv[j]);
+                tlapack::swap(vect1, vect2);
+            }
+        }
+        gemm(NO_TRANS, NO_TRANS, -one, L, U, one, A);
+
+        CHECK(lange(MAX_NORM, A) / normA <= tol);
+    }
+}
+
+TEMPLATE_TEST_CASE("Tiled QR factorization",
+                   "[qr][tiled]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    TaskRuntime rt(3);
+
+    const idx_t m = GENERATE(10, 23);
+    const idx_t n = GENERATE(7, 10, 17);
+    const idx_t nb = GENERATE(4, 5, 32);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " nb = " << nb)
+    {
+        const T zero(0);
+        const T one(1);
+        const idx_t k = min(m, n);
+        const real_t eps = ulp<real_t>();
+        real_t tol = real_t(20 * max(m, n)) * eps;
+        // Use a slightly larger tolerance for half precision
+        if (eps > real_t(1.0e-6)) tol = tol * real_t(5.);
+
+        TiledOpts opts;
+        opts.nb = nb;
+        opts.runtime = &rt;
+        const idx_t nx = (m + nb - 1) / nb;
+
+        std::vector<T> A_;
+        auto A = new_matrix(A_, m, n);
+        std::vector<T> QR_;
+        auto QR = new_matrix(QR_, m, n);
+        std::vector<T> TT_;
+        auto TT = new_matrix(TT_, nx * nb, n);
+
+        mm.random(A);
+        lacpy(GENERAL, A, QR);
+        const real_t normA = lange(FROB_NORM, A);
+
+        REQUIRE(geqrf_tiled(QR, TT, opts) == 0);
+
+        // Full Q = Q * I
+        std::vector<T> Q_;
+        auto Q = new_matrix(Q_, m, m);
+        laset(GENERAL, zero, one, Q);
+        REQUIRE(unmqr_tiled(LEFT_SIDE, NO_TRANS, QR, TT, Q, opts) == 0);
+        CHECK(check_orthogonality(Q) <= tol);
+
+        // A = Q R
+        std::vector<T> R_;
+        auto R = new_matrix(R_, m, n);
+        laset(GENERAL, zero, zero, R);
+        auto Rk = rows(R, range{0, k});
+        lacpy(UPPER_TRIANGLE, rows(QR, range{0, k}), Rk);
+        std::vector<T> E_;
+        auto E = new_matrix(E_, m, n);
+        lacpy(GENERAL, A, E);
+        gemm(NO_TRANS, NO_TRANS, -one, Q, R, one, E);
+        CHECK(lange(FROB_NORM, E) <= tol * normA);
+
+        // Q^H A = R
+        lacpy(GENERAL, A, E);
+        REQUIRE(unmqr_tiled(LEFT_SIDE, CONJ_TRANS, QR, TT, E, opts) == 0);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                CHECK(abs1(E(i, j) - R(i, j)) <= tol * normA);
+    }
+}
@@ -99,3 +99,91 @@ TEMPLATE_TEST_CASE("Transpose gives correct result",
                 CHECK(B(j, i) == A(i, j));
     }
 }
+
+TEMPLATE_TEST_CASE("Blocked transpose of larger matrices gives correct result",
+                   "[util]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    // Sizes that are and are not multiples of the vector tiles
+    idx_t n = GENERATE(8, 17, 64, 71);
+    idx_t m = GENERATE(16, 33, 70);
+    const bool conjA = GENERATE(false, true);
+
+    // Define the matrices
+    std::vector<T> A_;
+    auto A = new_matrix(A_, m, n);
+    std::vector<T> B_;
+    auto B = new_matrix(B_, n, m);
+
+    // Generate a random matrix in A
+    mm.random(A);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " conj = " << conjA)
+    {
+        if (conjA)
+            conjtranspose(A, B);
+        else
+            transpose(A, B);
+
+        for (idx_t i = 0; i < m; ++i)
+            for (idx_t j = 0; j < n; ++j)
+                CHECK(B(j, i) == (conjA ? conj(A(i, j)) : A(i, j)));
+    }
+}
+
+TEMPLATE_TEST_CASE("In-place transpose gives correct result",
+                   "[util]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    // Generate n
+    idx_t n = GENERATE(1, 2, 3, 5, 10, 16, 37, 64);
+    // Generate nx
+    const size_t nx = GENERATE(3, 16);
+    const bool conjA = GENERATE(false, true);
+
+    // Define the matrices
+    std::vector<T> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<T> A0_;
+    auto A0 = new_matrix(A0_, n, n);
+
+    // Generate a random matrix in A
+    mm.random(A);
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            A0(i, j) = A(i, j);
+
+    DYNAMIC_SECTION("n = " << n << " nx = " << nx << " conj = " << conjA)
+    {
+        TransposeOpts opts;
+        opts.nx = nx;
+        if (conjA)
+            conjtranspose_inplace(A, opts);
+        else
+            transpose_inplace(A, opts);
+
+        for (idx_t i = 0; i < n; ++i)
+            for (idx_t j = 0; j < n; ++j)
+                CHECK(A(j, i) == (conjA ? conj(A0(i, j)) : A0(i, j)));
+    }
+}
@@ -17,6 +17,7 @@
 // Auxiliary <T>LAPACK headers
 #include <tlapack/blas/trmm.hpp>
 #include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
 #include <tlapack/lapack/lantr.hpp>
 
 #if __has_include(<stdfloat>) && __cplusplus > 202002L
@@ -146,3 +147,95 @@ TEMPLATE_TEST_CASE("TRMM blocked mixed works",
         CHECK(normE1 <= delta2m);
     }
 }
+
+TEMPLATE_TEST_CASE("TRMM blocked mixed works for all cases",
+                   "[blas][trmm_blocked_mixed][trmm][blocked][mixed]",
+                   TEST_TYPES_bTRMM)
+{
+    using T = typename std::tuple_element<0, TestType>::type;
+    using Tlow = typename std::tuple_element<1, TestType>::type;
+
+    using matrix_t =
+        tlapack::LegacyMatrix<T, std::size_t, tlapack::Layout::ColMajor>;
+    using matrixLow_t =
+        tlapack::LegacyMatrix<Tlow, std::size_t, tlapack::Layout::ColMajor>;
+
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+    typedef real_type<Tlow> realLow_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+    Create<matrixLow_t> new_matrixLow;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const Side side = GENERATE(Side::Left, Side::Right);
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const Op trans = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+    const Diag diag = GENERATE(Diag::NonUnit, Diag::Unit);
+    const idx_t m = GENERATE(1, 40, 67);
+    const idx_t n = GENERATE(1, 33);
+    const idx_t nb = 16;
+
+    DYNAMIC_SECTION("side = " << side << " uplo = " << uplo
+                              << " trans = " << trans << " diag = " << diag
+                              << " m = " << m << " n = " << n)
+    {
+        const idx_t k = (side == Side::Left) ? m : n;
+        const real_t alpha(2);
+
+        std::vector<Tlow> Alow_;
+        auto Alow = new_matrixLow(Alow_, k, k);
+        std::vector<T> A_;
+        auto A = new_matrix(A_, k, k);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, m, n);
+        std::vector<T> C_;
+        auto C = new_matrix(C_, m, n);
+        std::vector<T> D_;
+        auto D = new_matrix(D_, m, n);
+
+        // Workspaces in the working and in the low precision
+        std::vector<T> W_;
+        auto W = (side == Side::Left) ? new_matrix(W_, nb, n)
+                                      : new_matrix(W_, m, nb);
+        std::vector<Tlow> Wlow_;
+        auto Wlow = (side == Side::Left) ? new_matrixLow(Wlow_, nb, n)
+                                         : new_matrixLow(Wlow_, m, nb);
+
+        // A is exactly representable in the low precision
+        mm.randn(Alow);
+        lacpy(GENERAL, Alow, A);
+        mm.randn(B);
+        lacpy(GENERAL, B, C);
+        lacpy(GENERAL, B, D);
+
+        // Reference
+        trmm(side, uplo, trans, diag, alpha, A, B);
+        const real_t normB = lange(ONE_NORM, B);
+
+        // Blocked algorithm with workspace in the working precision
+        trmm_blocked_mixed(side, uplo, trans, diag, alpha, Alow, C, W,
+                           TrmmBlockedOpts{nb});
+
+        // Blocked algorithm with workspace in the low precision
+        trmm_blocked_mixed(side, uplo, trans, diag, alpha, Alow, D, Wlow,
+                           TrmmBlockedOpts{nb});
+
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i) {
+                C(i, j) -= B(i, j);
+                D(i, j) -= B(i, j);
+            }
+        const real_t errC = lange(ONE_NORM, C) / normB;
+        const real_t errD = lange(ONE_NORM, D) / normB;
+
+        INFO("Relative error with workspace in T = " << errC);
+        INFO("Relative error with workspace in Tlow = " << errD);
+
+        CHECK(errC <= real_t(4 * k) * uroundoff<real_t>());
+        CHECK(errD <= real_t(4 * k) * real_t(uroundoff<realLow_t>()));
+    }
+}
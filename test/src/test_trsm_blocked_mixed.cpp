@@ -0,0 +1,126 @@
+/// @file test_trsm_blocked_mixed.cpp
+/// @brief Test TRSM blocked mixed
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Main <T>LAPACK header
+#include <tlapack/lapack/trsm_blocked_mixed.hpp>
+
+// Auxiliary <T>LAPACK headers
+#include <tlapack/blas/trmm.hpp>
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+#if __has_include(<stdfloat>) && __cplusplus > 202002L
+    #define TEST_TYPES_bTRSM \
+        (std::tuple<double, float>), (std::tuple<float, std::bfloat16_t>)
+#else
+    #define TEST_TYPES_bTRSM (std::tuple<double, float>)
+#endif
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("TRSM blocked mixed works",
+                   "[blas][trsm_blocked_mixed][trsm][blocked][mixed]",
+                   TEST_TYPES_bTRSM)
+{
+    using T = typename std::tuple_element<0, TestType>::type;
+    using Tlow = typename std::tuple_element<1, TestType>::type;
+
+    using matrix_t =
+        tlapack::LegacyMatrix<T, std::size_t, tlapack::Layout::ColMajor>;
+    using matrixLow_t =
+        tlapack::LegacyMatrix<Tlow, std::size_t, tlapack::Layout::ColMajor>;
+
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+    typedef real_type<Tlow> realLow_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+    Create<matrixLow_t> new_matrixLow;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const Side side = GENERATE(Side::Left, Side::Right);
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const Op trans = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+    const Diag diag = GENERATE(Diag::NonUnit, Diag::Unit);
+    const idx_t m = GENERATE(1, 40, 67);
+    const idx_t n = GENERATE(1, 33);
+    const idx_t nb = 16;
+
+    DYNAMIC_SECTION("side = " << side << " uplo = " << uplo
+                              << " trans = " << trans << " diag = " << diag
+                              << " m = " << m << " n = " << n)
+    {
+        const idx_t k = (side == Side::Left) ? m : n;
+        const real_t alpha(2);
+
+        std::vector<Tlow> Alow_;
+        auto Alow = new_matrixLow(Alow_, k, k);
+        std::vector<T> A_;
+        auto A = new_matrix(A_, k, k);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, m, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, m, n);
+        std::vector<T> C_;
+        auto C = new_matrix(C_, m, n);
+
+        // Workspaces in the working and in the low precision
+        std::vector<T> W_;
+        auto W = (side == Side::Left) ? new_matrix(W_, nb, n)
+                                      : new_matrix(W_, m, nb);
+        std::vector<Tlow> Wlow_;
+        auto Wlow = (side == Side::Left) ? new_matrixLow(Wlow_, nb, n)
+                                         : new_matrixLow(Wlow_, m, nb);
+
+        // Well-conditioned triangular A, exactly representable in the low
+        // precision. Unit diagonal matrices are kept well-conditioned by the
+        // scaling of the off-diagonal entries.
+        mm.randn(Alow);
+        for (idx_t j = 0; j < k; ++j)
+            for (idx_t i = 0; i < k; ++i)
+                Alow(i, j) = (i == j) ? Tlow(real_t(k))
+                                      : Tlow(real_t(Alow(i, j)) / real_t(k));
+        lacpy(GENERAL, Alow, A);
+
+        // B = op(A) X / alpha or B = X op(A) / alpha
+        mm.randn(X);
+        lacpy(GENERAL, X, B);
+        trmm(side, uplo, trans, diag, real_t(1) / alpha, A, B);
+        lacpy(GENERAL, B, C);
+        const real_t normX = lange(ONE_NORM, X);
+
+        // Blocked algorithm with workspace in the working precision
+        trsm_blocked_mixed(side, uplo, trans, diag, alpha, Alow, B, W,
+                           TrsmBlockedOpts{nb});
+
+        // Blocked algorithm with workspace in the low precision
+        trsm_blocked_mixed(side, uplo, trans, diag, alpha, Alow, C, Wlow,
+                           TrsmBlockedOpts{nb});
+
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i) {
+                B(i, j) -= X(i, j);
+                C(i, j) -= X(i, j);
+            }
+        const real_t errB = lange(ONE_NORM, B) / normX;
+        const real_t errC = lange(ONE_NORM, C) / normX;
+
+        INFO("Relative error with workspace in T = " << errB);
+        INFO("Relative error with workspace in Tlow = " << errC);
+
+        CHECK(errB <= real_t(4 * k) * uroundoff<real_t>());
+        CHECK(errC <= real_t(4 * k) * real_t(uroundoff<realLow_t>()));
+    }
+}
@@ -0,0 +1,125 @@
+/// @file test_tsqr.cpp
+/// @brief Test the tall-skinny QR factorization TSQR
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/laset.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/tsqr.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("TSQR factorization of a tall-skinny matrix",
+                   "[qr][tsqr]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+    typedef real_type<T> real_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t m = GENERATE(40, 203);
+    const idx_t n = GENERATE(1, 7);
+    const idx_t mb = GENERATE(8, 20, 0);
+    const idx_t nc = 3;
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " mb = " << mb)
+    {
+        // Constants
+        const T zero(0);
+        const T one(1);
+        const real_t eps = ulp<real_t>();
+        real_t tol = real_t(20 * m) * eps;
+        // Use a slightly larger tolerance for half precision
+        if (eps > real_t(1.0e-6)) tol = tol * real_t(5.);
+
+        TsqrOpts opts;
+        opts.mb = mb;
+        opts.nb = 4;
+
+        // Matrices
+        std::vector<T> A_;
+        auto A = new_matrix(A_, m, n);
+        std::vector<T> QR_;
+        auto QR = new_matrix(QR_, m, n);
+        std::vector<T> tau(tsqr_tausize(m, n, opts));
+
+        mm.random(A);
+        lacpy(GENERAL, A, QR);
+        const real_t normA = lange(FROB_NORM, A);
+
+        REQUIRE(tsqr(QR, tau, opts) == 0);
+
+        std::vector<T> R_;
+        auto R = new_matrix(R_, n, n);
+        laset(LOWER_TRIANGLE, zero, zero, R);
+        lacpy(UPPER_TRIANGLE, slice(QR, range{0, n}, range{0, n}), R);
+
+        // Full Q = Q * I
+        std::vector<T> Q_;
+        auto Q = new_matrix(Q_, m, m);
+        laset(GENERAL, zero, one, Q);
+        REQUIRE(unmqr_tsqr(LEFT_SIDE, NO_TRANS, QR, tau, Q, opts) == 0);
+        CHECK(check_orthogonality(Q) <= tol);
+
+        // A = Q(:,0:n) * R, with Q(:,0:n) formed by ungqr_tsqr
+        std::vector<T> Qn_;
+        auto Qn = new_matrix(Qn_, m, n);
+        lacpy(GENERAL, QR, Qn);
+        REQUIRE(ungqr_tsqr(Qn, tau, opts) == 0);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                CHECK(abs1(Qn(i, j) - Q(i, j)) <= tol);
+        std::vector<T> E_;
+        auto E = new_matrix(E_, m, n);
+        lacpy(GENERAL, A, E);
+        gemm(NO_TRANS, NO_TRANS, -one, Qn, R, one, E);
+        CHECK(lange(FROB_NORM, E) <= tol * normA);
+
+        // Q^H * A = [R; 0]
+        lacpy(GENERAL, A, E);
+        REQUIRE(unmqr_tsqr(LEFT_SIDE, CONJ_TRANS, QR, tau, E, opts) == 0);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                CHECK(abs1(E(i, j) - ((i < n) ? R(i, j) : zero)) <=
+                      tol * normA);
+
+        // C * Q and C * Q^H
+        std::vector<T> C_;
+        auto C = new_matrix(C_, nc, m);
+        mm.random(C);
+        const real_t normC = lange(FROB_NORM, C);
+        std::vector<T> D_;
+        auto D = new_matrix(D_, nc, m);
+        for (const Op trans : {Op::NoTrans, Op::ConjTrans}) {
+            lacpy(GENERAL, C, D);
+            REQUIRE(unmqr_tsqr(RIGHT_SIDE, trans, QR, tau, D, opts) == 0);
+            gemm(NO_TRANS, trans, -one, C, Q, one, D);
+            CHECK(lange(FROB_NORM, D) <= tol * normC);
+        }
+    }
+}
@@ -0,0 +1,130 @@
+/// @file test_tsqrt.cpp
+/// @brief Test the triangular-on-top-of-square QR kernels tsqrt and tsmqr
+//
+// Copyright (c) 2025, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/laset.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/tsmqr.hpp>
+#include <tlapack/lapack/tsqrt.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("QR factorization of a triangular-on-top-of-square matrix",
+                   "[qr][tsqrt]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+    typedef real_type<T> real_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = GENERATE(1, 5, 12);
+    const idx_t m = GENERATE(0, 4, 12, 30);
+    const idx_t nc = 3;
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n)
+    {
+        // Constants
+        const T zero(0);
+        const T one(1);
+        const idx_t mn = m + n;
+        const real_t eps = ulp<real_t>();
+        real_t tol = real_t(20 * mn) * eps;
+        // Use a slightly larger tolerance for half precision
+        if (eps > real_t(1.0e-6)) tol = tol * real_t(5.);
+
+        // A = [A1; A2] with A1 upper triangular
+        std::vector<T> A_;
+        auto A = new_matrix(A_, mn, n);
+        mm.random(A);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = j + 1; i < n; ++i)
+                A(i, j) = zero;
+        const real_t normA = lange(FROB_NORM, A);
+
+        std::vector<T> QR_;
+        auto QR = new_matrix(QR_, mn, n);
+        lacpy(GENERAL, A, QR);
+        auto R = rows(QR, range{0, n});
+        auto V = rows(QR, range{n, mn});
+
+        std::vector<T> TT_;
+        auto TT = new_matrix(TT_, n, n);
+
+        REQUIRE(tsqrt(R, V, TT) == 0);
+
+        // Full Q = Q * I
+        std::vector<T> Q_;
+        auto Q = new_matrix(Q_, mn, mn);
+        laset(GENERAL, zero, one, Q);
+        {
+            auto Q1 = rows(Q, range{0, n});
+            auto Q2 = rows(Q, range{n, mn});
+            REQUIRE(tsmqr(LEFT_SIDE, NO_TRANS, V, TT, Q1, Q2) == 0);
+        }
+        CHECK(check_orthogonality(Q) <= tol);
+
+        // A = Q(:,0:n) * R
+        std::vector<T> E_;
+        auto E = new_matrix(E_, mn, n);
+        lacpy(GENERAL, A, E);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = j + 1; i < n; ++i)
+                R(i, j) = zero;
+        gemm(NO_TRANS, NO_TRANS, -one, cols(Q, range{0, n}), R, one, E);
+        CHECK(lange(FROB_NORM, E) <= tol * normA);
+
+        // Q^H * A = [R; 0]
+        lacpy(GENERAL, A, E);
+        {
+            auto E1 = rows(E, range{0, n});
+            auto E2 = rows(E, range{n, mn});
+            REQUIRE(tsmqr(LEFT_SIDE, CONJ_TRANS, V, TT, E1, E2) == 0);
+        }
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < mn; ++i)
+                CHECK(abs1(E(i, j) - ((i < n) ? R(i, j) : zero)) <=
+                      tol * normA);
+
+        // C * Q and C * Q^H
+        std::vector<T> C_;
+        auto C = new_matrix(C_, nc, mn);
+        mm.random(C);
+        const real_t normC = lange(FROB_NORM, C);
+        std::vector<T> D_;
+        auto D = new_matrix(D_, nc, mn);
+        for (const Op trans : {Op::NoTrans, Op::ConjTrans}) {
+            lacpy(GENERAL, C, D);
+            auto D1 = cols(D, range{0, n});
+            auto D2 = cols(D, range{n, mn});
+            REQUIRE(tsmqr(RIGHT_SIDE, trans, V, TT, D1, D2) == 0);
+            gemm(NO_TRANS, trans, -one, C, Q, one, D);
+            CHECK(lange(FROB_NORM, D) <= tol * normC);
+        }
+    }
+}
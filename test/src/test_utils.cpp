@@ -51,3 +51,35 @@ TEST_CASE("is_matrix and is_vector work", "[utils]")
     CHECK(!is_vector<float>);
     CHECK(!is_vector<std::complex<double> >);
 }
+
+TEST_CASE("Workspace arena reuses its buffers", "[utils]")
+{
+    WorkspaceArena<double> arena;
+    const double* data;
+
+    {
+        auto buffer = arena.get(WorkInfo(10, 3));
+        CHECK(buffer.vector().empty());
+        CHECK(buffer.vector().capacity() >= 30);
+        buffer.vector().resize(30);
+        data = buffer.vector().data();
+
+        // Nested buffers do not share memory
+        auto nested = arena.get(5);
+        nested.vector().resize(5);
+        CHECK(nested.vector().data() != data);
+    }
+
+    // Smaller requests get the largest size seen so far
+    {
+        auto buffer = arena.get(4);
+        CHECK(arena.max_size() == 30);
+        CHECK(buffer.vector().capacity() >= 30);
+        buffer.vector().resize(30);
+        CHECK(buffer.vector().data() == data);
+    }
+
+    arena.reset();
+    CHECK(arena.max_size() == 0);
+    CHECK(&workspace_arena<float>() == &workspace_arena<float>());
+}